@@ -168,6 +168,26 @@ int BuildFromSequence(const Zaki::String::Directory &wrk_dir,
 					  Output &out,
 					  const Options &opt = Options());
 
+/**
+ * @brief Build the DUrca 0/1 mask of a radial profile (Fermi-momentum condition).
+ *
+ * This is the same test that BuildFromSequence() applies when
+ * Options::compute_durca_mask is set, exposed so that evolution drivers can
+ * rebuild the mask on any radial profile (e.g. a StarProfile's radial DataSet).
+ *
+ * Requires column 5 (total baryon density) and species fraction columns
+ * labelled "10" (n), "11" (p) and "0" (e).
+ *
+ * @param prof        radial profile
+ * @param mask        filled with 1 for r < r_DUrca and 0 outside
+ * @param r_durca_km  set to the threshold radius
+ *
+ * @return false (mask untouched) if the required columns are missing.
+ */
+bool BuildDurcaMask(const Zaki::Vector::DataSet &prof,
+					Zaki::Vector::DataColumn &mask,
+					double &r_durca_km);
+
 } // namespace StarBuilder
 } // namespace Core
 } // namespace CompactStar
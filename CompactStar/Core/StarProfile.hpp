@@ -665,6 +665,40 @@ struct StarProfileView
 	const Zaki::Vector::DataColumn *GetMetricNu() const { return GetPtr(StarProfile::Column::MetricNu); }
 };
 
+//==============================================================
+//                      Radial quadrature
+//==============================================================
+/**
+ * @brief Trapezoid weights Δr_i of a (possibly non-uniform) radial grid.
+ *
+ * ∫ f dr ≈ Σ_i f_i Δr_i, with Δr_i = (r_{i+1} − r_{i−1}) / 2 at interior
+ * nodes and the half intervals at the two ends. Shared by every radial
+ * integral over a profile (GeometryCache, BNV rates and analysis).
+ *
+ * @param r   Radial grid (n values, increasing).
+ * @param out Receives the n weights (all zero if n < 2).
+ */
+inline void TrapezoidWeights(const double *r, std::size_t n, double *out)
+{
+	if (n < 2)
+	{
+		std::fill(out, out + n, 0.0);
+		return;
+	}
+	out[0] = 0.5 * (r[1] - r[0]);
+	out[n - 1] = 0.5 * (r[n - 1] - r[n - 2]);
+	for (std::size_t i = 1; i + 1 < n; ++i)
+		out[i] = 0.5 * (r[i + 1] - r[i - 1]);
+}
+
+/// Same as above, returning the weights of @p r.
+inline std::vector<double> TrapezoidWeights(const std::vector<double> &r)
+{
+	std::vector<double> w(r.size());
+	TrapezoidWeights(r.data(), r.size(), w.data());
+	return w;
+}
+
 } // namespace CompactStar::Core
 
 #endif /* CompactStar_Core_StarProfile_H */
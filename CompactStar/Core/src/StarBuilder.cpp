@@ -46,15 +46,16 @@ static bool HasLabel(const Zaki::Vector::DataSet &ds, const std::string &label)
  *
  * If any are missing, we just leave the mask empty.
  */
-static void BuildDurcaMask(const Zaki::Vector::DataSet &prof,
-						   Output &out)
+bool BuildDurcaMask(const Zaki::Vector::DataSet &prof,
+					Zaki::Vector::DataColumn &mask,
+					double &r_durca_km)
 {
 	// Basic presence check
 	if (prof.Dim().size() < 6)
-		return; // no baryon-density column
+		return false; // no baryon-density column
 
 	if (!HasLabel(prof, "10") || !HasLabel(prof, "11") || !HasLabel(prof, "0"))
-		return;
+		return false;
 
 	// Grab what we need
 	const Zaki::Vector::DataColumn &r = prof[0];
@@ -78,13 +79,24 @@ static void BuildDurcaMask(const Zaki::Vector::DataSet &prof,
 	// threshold index
 	int durca_idx = kF_diff.GetClosestIdx(0.0);
 
-	out.r_durca_km = r[durca_idx];
+	r_durca_km = r[durca_idx];
 
 	// build 0/1 column
-	out.durca_mask.Resize(r.Size());
-	out.durca_mask.Fill(0.0);
+	mask.Resize(r.Size());
+	mask.Fill(0.0);
 	for (std::size_t i = 0; i < static_cast<std::size_t>(durca_idx); ++i)
-		out.durca_mask[i] = 1.0;
+		mask[i] = 1.0;
+
+	return true;
+}
+
+/**
+ * @brief Fill Output::durca_mask / Output::r_durca_km (see public overload).
+ */
+static void BuildDurcaMask(const Zaki::Vector::DataSet &prof,
+						   Output &out)
+{
+	BuildDurcaMask(prof, out.durca_mask, out.r_durca_km);
 }
 
 /**
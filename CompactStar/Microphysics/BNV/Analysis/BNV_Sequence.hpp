@@ -94,6 +94,44 @@ class BNV_Sequence : public Core::Prog
 
 	Beta_Idx beta_idx;
 
+	// -----------------------------------------------------
+	//  Lookup table of the beta columns against B
+	// -----------------------------------------------------
+	//   Every time-dependent quantity is a linear interpolant
+	//   in the baryon number B(time), which is monotone along
+	//   the sequence. The columns are copied once (EvalBeta)
+	//   into contiguous vectors, and the bracket of the last
+	//   lookup is remembered: successive ODE steps move by at
+	//   most a few rows, so the hunt is O(1) amortized.
+	//   The cursor makes lookups on one object not thread-safe.
+	struct BetaTable
+	{
+		// Baryon number (the evolution parameter)
+		std::vector<double> B;
+
+		// beta columns, cols[o_idx][i]
+		std::vector<std::vector<double>> cols;
+
+		// Whether B increases with the row index
+		bool ascending = true;
+
+		// Lower row of the last bracket
+		mutable size_t cursor = 0;
+	};
+
+	BetaTable beta_tab;
+
+	// Rebuilds beta_tab from beta
+	void BuildBetaTable();
+
+	// Returns i such that B_val lies in [B_i, B_{i+1}]
+	// (clamped to the first/last interval), hunting from
+	// the last bracket
+	size_t HuntB(const double &B_val) const;
+
+	// Returns column o_idx linearly interpolated at B_val
+	double LookupB(const int &o_idx, const double &B_val) const;
+
 	//  The initial index based on beta dataset
 	int init_idx = 0;
 
@@ -248,14 +286,15 @@ class BNV_Sequence : public Core::Prog
 		// This is the index
 		int idx;
 
-		// weight to the left of idx
+		// weight of row idx-1
 		double w_L;
 
-		// weight to the right of idx
+		// weight of row idx
 		double w_R;
 	};
 
-	/// Returns the weighted index corrsponding to time
+	/// Returns the weighted index corrsponding to time, such that
+	///  O(time) = w_L * O[idx-1] + w_R * O[idx]
 	weighted_idx Time_to_Weighted_Idx(const double &time) const;
 
 	/// Returns Radius
@@ -359,6 +398,20 @@ class BNV_Sequence : public Core::Prog
 	// ......................
 	static int ODE(double t, const double y[], double f[], void *params);
 
+	// Parameters of ODE_Batch
+	struct ODE_Batch_Params
+	{
+		const BNV_Sequence *seq;
+		size_t dim;
+	};
+
+	// ......................
+	// Dictionary :
+	// y[k] = Omega_k(t), one per initial omega
+	// f[k] = Omega_k'(t)
+	// ......................
+	static int ODE_Batch(double t, const double y[], double f[], void *params);
+
 	void Solve(const double t_0, const double t_f);
 
 	void SetInitOmegaSet(const std::vector<std::pair<double, std::string>> &init_omegas);
@@ -53,46 +53,62 @@ void MicroBNVAna::BNV_Analysis::Analyze(Core::NStar *in_star)
 
 	// double m_chi = 0.8*Zaki::Physics::NEUTRON_M_FM ;
 
-	Zaki::Vector::DataColumn r_set = *in_star->Profile().GetRadius();
-	Zaki::Vector::DataColumn M_r = *in_star->Profile().GetMass();
-	Zaki::Vector::DataColumn nu_r = *in_star->Profile().GetMetricNu();
-
-	// This is for making evaluations faster
-	// we still need to multiply this by the
-	// individual species baryon density
-	// A.K.A "b_den", in the loop below.
-	Zaki::Vector::DataColumn integ_fr_0 = 4 * M_PI * r_set.pow(2);
-	integ_fr_0 *= (1. - 2 * M_r / r_set).pow(-0.5);
-
-	Zaki::Vector::DataColumn integ_b_dot_0 = integ_fr_0 * exp(nu_r);
-	// integ_b_dot *= exp( nu_r ) ;
+	const std::vector<double> &r_set = in_star->Profile().GetRadius()->vals;
+	const std::vector<double> &M_r = in_star->Profile().GetMass()->vals;
+	const std::vector<double> &nu_r = in_star->Profile().GetMetricNu()->vals;
+	const std::vector<double> &n_tot = in_star->Profile().GetBaryonDensity()->vals;
+
+	// Species fractions (a species missing from the
+	// profile has a zero density)
+	std::vector<const std::vector<double> *> frac(bar_list.size(), nullptr);
+	for (size_t i = 0; i < bar_list.size(); i++)
+	{
+		const Zaki::Vector::DataColumn *rho_i = in_star->GetRho_i(bar_list[i].label);
+		if (rho_i && rho_i->Size() == r_set.size())
+			frac[i] = &rho_i->vals;
+	}
 
-	bnv_rate_seq.emplace_back(in_star->GetSequence().b,
-							  in_star->GetSequence().m,
-							  in_star->GetSequence().ec);
+	std::vector<double> fr_result(bar_list.size(), 0.0);
+	std::vector<double> b_dot_result(bar_list.size(), 0.0);
 
-	for (size_t i = 0; i < bar_list.size(); i++)
+	// One pass over the radial grid for all species.
+	// The weights are those of the trapezoid rule, i.e., the
+	// integral of the linear interpolant of the integrand.
+	const size_t n_r = r_set.size();
+	const std::vector<double> dr = Core::TrapezoidWeights(r_set);
+	for (size_t j = 0; j < n_r; j++)
 	{
-		// std::cout << "\n -> crit. den. = " << bar_list[i].crit_chi_den << "\n";
-		// std::cout << "\n -> Rho dark min = " << in_star->GetRho_Dark()->Min() << "\n";
-		// std::cout << "\n -> Rho dark max = " << in_star->GetRho_Dark()->Max() << "\n";
+		// This is the species-independent part of the
+		// integrand; we still need to multiply this by the
+		// individual species baryon density A.K.A "b_den".
+		double w_fr = 4 * M_PI * r_set[j] * r_set[j];
+		w_fr *= pow(1. - 2 * M_r[j] / r_set[j], -0.5);
+		w_fr *= dr[j];
 
-		Zaki::Vector::DataColumn b_den = *in_star->GetRho_i(bar_list[i].label) *
-										 *in_star->Profile().GetBaryonDensity();
+		double w_b_dot = w_fr * exp(nu_r[j]);
 
-		Zaki::Vector::DataColumn integ_fr = integ_fr_0 * b_den;
-		Zaki::Vector::DataColumn integ_b_dot = integ_b_dot_0 * b_den;
+		for (size_t i = 0; i < bar_list.size(); i++)
+		{
+			if (!frac[i])
+				continue;
 
-		Zaki::Vector::DataSet integrand({r_set, integ_fr, integ_b_dot});
+			double b_den = (*frac[i])[j] * n_tot[j];
 
-		integrand.Interpolate(0, {1, 2});
-		double fr_result = integrand.Integrate(1, {r_set[0], r_set[-1]});
-		double b_dot_result = integrand.Integrate(2, {r_set[0], r_set[-1]});
+			fr_result[i] += w_fr * b_den;
+			b_dot_result[i] += w_b_dot * b_den;
+		}
+	}
+
+	bnv_rate_seq.emplace_back(in_star->GetSequence().b,
+							  in_star->GetSequence().m,
+							  in_star->GetSequence().ec);
 
+	for (size_t i = 0; i < bar_list.size(); i++)
+	{
 		bnv_rate_seq[bnv_rate_seq.size() - 1].Append(
 			{bar_list[i],
-			 fr_result * 1e54,
-			 b_dot_result * 1e54});
+			 fr_result[i] * 1e54,
+			 b_dot_result[i] * 1e54});
 	}
 
 	// double critical_rho_val = pow(m_n - m_chi*m_chi/m_n, 3)
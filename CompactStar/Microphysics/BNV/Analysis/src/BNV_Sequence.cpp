@@ -492,11 +492,7 @@ double MicroBNVAna::BNV_Sequence::O(const double &time, const int &o_idx) const
 	//       o += (beta[beta_idx.B][i] - B_val) * beta[o_idx][i] ;
 	//       o /= beta[beta_idx.B][i] - beta[beta_idx.B][i-1] ;
 
-	weighted_idx w_idx = Time_to_Weighted_Idx(time);
-
-	double o = w_idx.w_L * beta[o_idx][w_idx.idx - 1] + w_idx.w_R * beta[o_idx][w_idx.idx];
-
-	return o;
+	return LookupB(o_idx, B(time));
 }
 
 // ------------------------------------------------------------
@@ -515,9 +511,7 @@ double MicroBNVAna::BNV_Sequence::M(const double &time) const
 	// int i = beta[beta_idx.B].GetClosestIdx( B_val ) ;
 	// return M()[i] ; // pre Sep 29, 2023 version!
 
-	weighted_idx w_idx = Time_to_Weighted_Idx(time);
-
-	return w_idx.w_L * M()[w_idx.idx - 1] + w_idx.w_R * M()[w_idx.idx];
+	return LookupB(beta_idx.M, B(time));
 
 	// if(B_val > beta[beta_idx.B][i])
 	// {
@@ -549,9 +543,7 @@ double MicroBNVAna::BNV_Sequence::R(const double &time) const
 	// int idx = B().GetClosestIdx( B(time) ) ;
 
 	// return R()[Time_to_Idx(time)] ;
-	weighted_idx w_idx = Time_to_Weighted_Idx(time);
-
-	return w_idx.w_L * R()[w_idx.idx - 1] + w_idx.w_R * R()[w_idx.idx];
+	return LookupB(beta_idx.R, B(time));
 }
 
 // ------------------------------------------------------------
@@ -570,9 +562,7 @@ double MicroBNVAna::BNV_Sequence::I(const double &time) const
 	// int idx = B().GetClosestIdx( B(time) ) ;
 
 	// return I()[Time_to_Idx(time)] ;
-	weighted_idx w_idx = Time_to_Weighted_Idx(time);
-
-	return w_idx.w_L * I()[w_idx.idx - 1] + w_idx.w_R * I()[w_idx.idx];
+	return LookupB(beta_idx.I, B(time));
 }
 
 // ------------------------------------------------------------
@@ -589,9 +579,9 @@ double MicroBNVAna::BNV_Sequence::B(const double &time) const
 {
 	// Adding a cut-off for BNV
 	if (time > bnv_cutoff_time)
-		return B()[init_idx] * exp(-gamma_bnv * bnv_cutoff_time);
+		return beta_tab.B[init_idx] * exp(-gamma_bnv * bnv_cutoff_time);
 
-	return B()[init_idx] * exp(-gamma_bnv * time);
+	return beta_tab.B[init_idx] * exp(-gamma_bnv * time);
 }
 
 // ------------------------------------------------------------
@@ -662,6 +652,8 @@ void MicroBNVAna::BNV_Sequence::EvalBeta()
 	beta.Import("B_Factors.tsv");
 	beta.Interpolate(0, beta_idx.B);
 
+	BuildBetaTable();
+
 	// D_eps_B :
 	// beta = {seq[0],               // 0-eps
 	//         seq[1],               // 1-M
@@ -763,9 +755,7 @@ double MicroBNVAna::BNV_Sequence::b_I(const double &time) const
 
 	// return b_I()[Time_to_Idx(time)] ;
 
-	weighted_idx w_idx = Time_to_Weighted_Idx(time);
-
-	return w_idx.w_L * b_I()[w_idx.idx - 1] + w_idx.w_R * b_I()[w_idx.idx];
+	return LookupB(beta_idx.b_I, B(time));
 
 	// double B_val = B(time) ;
 	// int i = beta[beta_idx.B].GetClosestIdx( B_val ) ;
@@ -798,9 +788,7 @@ double MicroBNVAna::BNV_Sequence::b_beta_I(const double &time) const
 
 	// return b_beta_I()[Time_to_Idx(time)] ;
 
-	weighted_idx w_idx = Time_to_Weighted_Idx(time);
-
-	return w_idx.w_L * b_beta_I()[w_idx.idx - 1] + w_idx.w_R * b_beta_I()[w_idx.idx];
+	return LookupB(beta_idx.b_beta_I, B(time));
 
 	// double B_val = B(time) ;
 	// int i = beta[beta_idx.B].GetClosestIdx( B_val ) ;
@@ -832,9 +820,7 @@ double MicroBNVAna::BNV_Sequence::b_R(const double &time) const
 
 	// return b_R()[Time_to_Idx(time)] ;
 
-	weighted_idx w_idx = Time_to_Weighted_Idx(time);
-
-	return w_idx.w_L * b_R()[w_idx.idx - 1] + w_idx.w_R * b_R()[w_idx.idx];
+	return LookupB(beta_idx.b_R, B(time));
 
 	// double B_val = B(time) ;
 	// int i = beta[beta_idx.B].GetClosestIdx( B_val ) ;
@@ -890,7 +876,9 @@ double MicroBNVAna::BNV_Sequence::b(const Zaki::Vector::DataColumn &in_dc, const
 
 	weighted_idx w_idx = Time_to_Weighted_Idx(time);
 
-	return w_idx.w_L * b(in_dc)[w_idx.idx - 1] + w_idx.w_R * b(in_dc)[w_idx.idx];
+	Zaki::Vector::DataColumn b_o = b(in_dc);
+
+	return w_idx.w_L * b_o[w_idx.idx - 1] + w_idx.w_R * b_o[w_idx.idx];
 
 	// double B_val = B(time) ;
 	// int i = beta[beta_idx.B].GetClosestIdx( B_val ) ;
@@ -910,7 +898,13 @@ double MicroBNVAna::BNV_Sequence::b(const Zaki::Vector::DataColumn &in_dc, const
 // Returns the closest index corrsponding to time
 int MicroBNVAna::BNV_Sequence::Time_to_Idx(const double &time) const
 {
-	return B().GetClosestIdx(B(time));
+	double B_val = B(time);
+	size_t i = HuntB(B_val);
+
+	if (std::abs(B_val - beta_tab.B[i]) <= std::abs(beta_tab.B[i + 1] - B_val))
+		return i;
+
+	return i + 1;
 }
 
 // ------------------------------------------------------------
@@ -921,23 +915,120 @@ MicroBNVAna::BNV_Sequence::weighted_idx MicroBNVAna::BNV_Sequence::Time_to_Weigh
 
 	double B_val = B(time);
 
-	w_idx.idx = B().GetClosestIdx(B_val);
+	size_t i = HuntB(B_val);
+
+	w_idx.idx = i + 1;
+
+	w_idx.w_R = B_val - beta_tab.B[i];
+	w_idx.w_R /= beta_tab.B[i + 1] - beta_tab.B[i];
+
+	w_idx.w_L = 1 - w_idx.w_R;
 
-	if (B_val > beta[beta_idx.B][w_idx.idx])
+	return w_idx;
+}
+
+// ------------------------------------------------------------
+// Copies the beta columns into the lookup table
+void MicroBNVAna::BNV_Sequence::BuildBetaTable()
+{
+	beta_tab = BetaTable();
+
+	if (beta.data_set.size() <= (size_t)beta_idx.b_M || beta[beta_idx.B].Size() < 2)
 	{
-		w_idx.idx++;
+		throw std::runtime_error("BNV_Sequence::BuildBetaTable: 'B_Factors.tsv' is missing columns or rows.");
 	}
 
-	w_idx.w_L = B_val - beta[beta_idx.B][w_idx.idx - 1];
-	w_idx.w_L /= beta[beta_idx.B][w_idx.idx] - beta[beta_idx.B][w_idx.idx - 1];
+	beta_tab.cols.reserve(beta.data_set.size());
+	for (const auto &col : beta.data_set)
+	{
+		beta_tab.cols.emplace_back(col.vals);
+	}
+	beta_tab.B = beta_tab.cols[beta_idx.B];
 
-	w_idx.w_R = beta[beta_idx.B][w_idx.idx] - B_val;
-	w_idx.w_R /= beta[beta_idx.B][w_idx.idx] - beta[beta_idx.B][w_idx.idx - 1];
+	const std::vector<double> &B_col = beta_tab.B;
+	beta_tab.ascending = B_col.back() > B_col.front();
 
-	return w_idx;
-	// double b_i = (B_val - beta[beta_idx.B][i-1]) * b_I()[i-1] ;
-	//       b_i += (beta[beta_idx.B][i] - B_val) * b_I()[i] ;
-	//       b_i /= beta[beta_idx.B][i] - beta[beta_idx.B][i-1] ;
+	for (size_t i = 1; i < B_col.size(); i++)
+	{
+		if ((B_col[i] > B_col[i - 1]) != beta_tab.ascending)
+		{
+			Z_LOG_WARNING("B is not strictly monotone along the sequence; time lookups may pick the wrong branch.");
+			break;
+		}
+	}
+}
+
+// ------------------------------------------------------------
+// Hunts for the bracket of B_val starting from the last one
+size_t MicroBNVAna::BNV_Sequence::HuntB(const double &B_val) const
+{
+	const std::vector<double> &xs = beta_tab.B;
+	const size_t n = xs.size();
+
+	if (n < 2)
+	{
+		throw std::runtime_error("BNV_Sequence::HuntB: EvalBeta() has not been called.");
+	}
+
+	// Whether B_val is at or beyond row i, along the sequence
+	auto past = [&](const size_t &i)
+	{ return beta_tab.ascending ? B_val >= xs[i] : B_val <= xs[i]; };
+
+	size_t lo = std::min(beta_tab.cursor, n - 2);
+	size_t hi = lo + 1;
+	size_t step = 1;
+
+	if (past(lo))
+	{
+		// Hunting forward
+		while (hi < n - 1 && past(hi))
+		{
+			lo = hi;
+			step *= 2;
+			hi = std::min(lo + step, n - 1);
+		}
+	}
+	else
+	{
+		// Hunting backward
+		hi = lo;
+		while (lo > 0)
+		{
+			lo = (lo > step) ? lo - step : 0;
+			if (past(lo))
+				break;
+			hi = lo;
+			step *= 2;
+		}
+		if (hi == lo)
+			hi = lo + 1;
+	}
+
+	// Bisection within [lo, hi]
+	while (hi - lo > 1)
+	{
+		size_t mid = (lo + hi) / 2;
+		if (past(mid))
+			lo = mid;
+		else
+			hi = mid;
+	}
+
+	beta_tab.cursor = lo;
+	return lo;
+}
+
+// ------------------------------------------------------------
+// Returns column o_idx interpolated at B_val
+double MicroBNVAna::BNV_Sequence::LookupB(const int &o_idx, const double &B_val) const
+{
+	size_t i = HuntB(B_val);
+
+	const std::vector<double> &o = beta_tab.cols[o_idx];
+
+	double w = (B_val - beta_tab.B[i]) / (beta_tab.B[i + 1] - beta_tab.B[i]);
+
+	return (1 - w) * o[i] + w * o[i + 1];
 }
 
 // ------------------------------------------------------------
@@ -983,11 +1074,11 @@ double MicroBNVAna::BNV_Sequence::BrIdx(const double &t, const double &omega) co
 	// int idx = Time_to_Idx(t) ;
 	weighted_idx w_idx = Time_to_Weighted_Idx(t);
 
-	double b_I_val = w_idx.w_L * b_I()[w_idx.idx - 1] + w_idx.w_R * b_I()[w_idx.idx];
+	double b_I_val = w_idx.w_L * beta_tab.cols[beta_idx.b_I][w_idx.idx - 1] + w_idx.w_R * beta_tab.cols[beta_idx.b_I][w_idx.idx];
 
-	double b_R_val = w_idx.w_L * b_R()[w_idx.idx - 1] + w_idx.w_R * b_R()[w_idx.idx];
+	double b_R_val = w_idx.w_L * beta_tab.cols[beta_idx.b_R][w_idx.idx - 1] + w_idx.w_R * beta_tab.cols[beta_idx.b_R][w_idx.idx];
 
-	double b_beta_I_val = w_idx.w_L * b_beta_I()[w_idx.idx - 1] + w_idx.w_R * b_beta_I()[w_idx.idx];
+	double b_beta_I_val = w_idx.w_L * beta_tab.cols[beta_idx.b_beta_I][w_idx.idx - 1] + w_idx.w_R * beta_tab.cols[beta_idx.b_beta_I][w_idx.idx];
 
 	double n = 3 + b_I_val * delta / (1 - b_I_val * delta);
 	// n += (6 * b_R_val * delta - b_I_val * pow(delta, 2) * (1+b(Beta_I(), t)) ) / pow(1 - b_I_val * delta, 2) ;
@@ -1229,6 +1320,28 @@ int MicroBNVAna::BNV_Sequence::ODE(double t, const double y[], double f[], void
 	return GSL_SUCCESS;
 }
 
+// ------------------------------------------------------------
+int MicroBNVAna::BNV_Sequence::ODE_Batch(double t, const double y[], double f[], void *params)
+{
+	const ODE_Batch_Params *par = (const ODE_Batch_Params *)params;
+	const BNV_Sequence *ns_obj = par->seq;
+
+	// Shared by every trajectory
+	double coeff = ns_obj->ODE_Coeff(t);
+	double spin_up = ns_obj->b_I(t) * ns_obj->Gamma_BNV(t);
+
+	for (size_t k = 0; k < par->dim; k++)
+	{
+		f[k] = coeff;
+
+		f[k] *= -pow(y[k], 3);
+
+		f[k] += spin_up * y[k];
+	}
+
+	return GSL_SUCCESS;
+}
+
 // ------------------------------------------------------------
 void MicroBNVAna::BNV_Sequence::Solve(const double t_0, const double t_f)
 {
@@ -1308,157 +1421,215 @@ void MicroBNVAna::BNV_Sequence::Solve(const double t_0, const double t_f)
 	M_Omega_ds_plt_labels.emplace_back(4,
 									   (std::map<std::string, std::string>){{"label", "$\\Omega_{D-II}$"}, {"ls", "--"}});
 	//---------------------------------------------------
-	//    Loop over initial omega values
+	//    All initial omega values are integrated together
+	//    as one system, so the sequence lookups (ODE_Coeff,
+	//    b_I, Gamma_BNV) are shared by every trajectory.
+	//    If a shared step fails, the remaining steps are
+	//    redone per trajectory from the last common state,
+	//    so only the failing trajectory stops early.
 	//---------------------------------------------------
-	for (size_t i = 0; i < init_omega_set.size(); i++)
-	{
-
-		double omega[1];
-		omega[0] = init_omega_set[i].first;
-		double in_t = t_0;
+	const size_t n_omega = init_omega_set.size();
 
+	std::vector<double> omega(n_omega);
+	for (size_t i = 0; i < n_omega; i++)
+	{
+		omega[i] = init_omega_set[i].first;
+	}
+	double in_t = t_0;
+
+	double log_t_0 = log10(t_0);
+	double log_t_f = log10(t_f);
+
+	double step = (log_t_f - log_t_0) / time_res;
+	double alpha = ODE_Coeff(t_0);
+
+	//----------------------------------------
+	//          Recording Data
+	//----------------------------------------
+	// Time columns (once per time step)
+	auto record_time = [&](double log_t_i, double t_i) {
+		omega_ds[0].vals.emplace_back(t_i / Zaki::Physics::YR_2_SEC);
+		br_idx_ds[0].vals.emplace_back(t_i / Zaki::Physics::YR_2_SEC);
+		P_Pdot_ds[0].vals.emplace_back(t_i / Zaki::Physics::YR_2_SEC);
+		P_Pdot_ds[1].vals.emplace_back(M(t_i));
+		M_Omega_ds[0].vals.emplace_back(t_i / Zaki::Physics::YR_2_SEC);
+		M_Omega_ds[1].vals.emplace_back(M(t_i));
+		M_Omega_ds[2].vals.emplace_back(ExtremumOmega(t_i));
+		M_Omega_ds[3].vals.emplace_back(Omega_Death_Central(t_i));
+		M_Omega_ds[4].vals.emplace_back(Omega_Death_Twisted(t_i));
+
+		M_Omega_ds[0].label = "t[yr]";
+		M_Omega_ds[1].label = "M";
+		M_Omega_ds[2].label = "Omega_ext";
+		M_Omega_ds[3].label = "Omega_D_I";
+		M_Omega_ds[4].label = "Omega_D_II";
+
+		for (size_t k = 0; k < time_stamps.size(); k++)
+		{
+			if (abs(log_t_i - log10(time_stamps[k])) < step / 2.)
+			{
+				time_mass_stamps.emplace_back(M(t_i));
+			}
+		}
+	};
+
+	// Columns of trajectory i
+	auto record_omega = [&](size_t i, double t_i, double w) {
+		omega_ds[1 + 2 * i].vals.emplace_back(w / init_omega_set[i].first);
+
+		// .....................
+		// Analytical Solution
+		// .....................
+		omega_ds[2 + 2 * i].vals.emplace_back(
+			sqrt(1. /
+				 (2 * alpha * (t_i - t_0) + pow(init_omega_set[i].first, -2))) /
+			init_omega_set[i].first);
+		// .....................
+
+		// .....................
+		//    Braking index
+		// .....................
+		br_idx_ds[2 + 2 * i].vals.emplace_back(BrIdx(t_i, w));
+		// .....................
+
+		// .....................
+		//    P, P_dot
+		// .....................
+		P_Pdot_ds[2 + 3 * i].vals.emplace_back(2 * M_PI / w);
+		P_Pdot_ds[3 + 3 * i].vals.emplace_back(-2 * M_PI * Omega_1stDer(t_i, w) / pow(w, 2));
+		P_Pdot_ds[4 + 3 * i].vals.emplace_back(-w / (2 * Zaki::Physics::YR_2_SEC * Omega_1stDer(t_i, w)));
+		P_Pdot_ds[2 + 3 * i].label = "P[" + init_omega_set[i].second + "]";
+		P_Pdot_ds[3 + 3 * i].label = "P_dot[" + init_omega_set[i].second + "]";
+		P_Pdot_ds[4 + 3 * i].label = "SD_Age[" + init_omega_set[i].second + "]";
+		// .....................
+
+		// .....................
+		//    M_Omega
+		// .....................
+		M_Omega_ds[5 + i].vals.emplace_back(w);
+		M_Omega_ds[5 + i].label = "Omega[" + init_omega_set[i].second + "]";
+		// .....................
+	};
+
+	// First time step not completed by the shared system
+	size_t j_split = time_res;
+
+	if (n_omega > 0)
+	{
 		//----------------------------------------
 		//          GSL ODE SYSTEM SETUP
 		//----------------------------------------
-		gsl_odeiv2_system ode_sys = {MicroBNVAna::BNV_Sequence::ODE, nullptr, 1, this};
+		ODE_Batch_Params ode_par = {this, n_omega};
+		gsl_odeiv2_system ode_sys = {MicroBNVAna::BNV_Sequence::ODE_Batch, nullptr, n_omega, &ode_par};
 
 		gsl_odeiv2_driver *tmp_driver = gsl_odeiv2_driver_alloc_y_new(&ode_sys, gsl_odeiv2_step_rk8pd,
 																	  1e-3, 1e-10, 1e-10);
-		//----------------------------------------
-		double log_t_0 = log10(t_0);
-		double log_t_f = log10(t_f);
-
-		double step = (log_t_f - log_t_0) / time_res;
-		double alpha = ODE_Coeff(t_0);
+		std::vector<double> omega_prev(n_omega);
 
 		//----------------------------------------
 		//            Loop over time
 		//----------------------------------------
 		for (size_t j = 0; j < time_res; j++)
-		// for (double log_t_i = log_t_0; log_t_i < log_t_f; log_t_i += step )
 		{
-
 			double log_t_i = log_t_0 + j * step;
 
 			double t_i = pow(10, log_t_i);
 
 			SetBNVCuttoff(t_i);
 
-			int status = gsl_odeiv2_driver_apply(tmp_driver, &in_t, t_i, omega);
+			omega_prev = omega;
+			double t_prev = in_t;
 
-			//----------------------------------------
-			//          Recording Data
-			//----------------------------------------
-			// Recording the time has to be done only once!
-			if (i == 0)
-			{
-				omega_ds[0].vals.emplace_back(t_i / Zaki::Physics::YR_2_SEC);
-				br_idx_ds[0].vals.emplace_back(t_i / Zaki::Physics::YR_2_SEC);
-				P_Pdot_ds[0].vals.emplace_back(t_i / Zaki::Physics::YR_2_SEC);
-				P_Pdot_ds[1].vals.emplace_back(M(t_i));
-				M_Omega_ds[0].vals.emplace_back(t_i / Zaki::Physics::YR_2_SEC);
-				M_Omega_ds[1].vals.emplace_back(M(t_i));
-				// std::cout<< "\t t_i = '" << t_i << "', B = " << B(t_i) << ", " << " M(t_i) = '" << M(t_i) << "'.\n" ;
-				M_Omega_ds[2].vals.emplace_back(ExtremumOmega(t_i));
-				M_Omega_ds[3].vals.emplace_back(Omega_Death_Central(t_i));
-				M_Omega_ds[4].vals.emplace_back(Omega_Death_Twisted(t_i));
-
-				M_Omega_ds[0].label = "t[yr]";
-				M_Omega_ds[1].label = "M";
-				M_Omega_ds[2].label = "Omega_ext";
-				M_Omega_ds[3].label = "Omega_D_I";
-				M_Omega_ds[4].label = "Omega_D_II";
-
-				for (size_t k = 0; k < time_stamps.size(); k++)
-				{
-					if (abs(log_t_i - log10(time_stamps[k])) < step / 2.)
-					{
-						time_mass_stamps.emplace_back(M(t_i));
-					}
-				}
-			}
-
-			omega_ds[1 + 2 * i].vals.emplace_back(omega[0] / init_omega_set[i].first);
-
-			// .....................
-			// Analytical Solution
-			// .....................
-			omega_ds[2 + 2 * i].vals.emplace_back(
-				sqrt(1. /
-					 (2 * alpha * (t_i - t_0) + pow(init_omega_set[i].first, -2))) /
-				init_omega_set[i].first);
-			// .....................
-
-			// .....................
-			//    Braking index
-			// .....................
-			// br_idx_ds[1 + 2 * i].vals.emplace_back(Omega_2ndDer(t_i, omega[0]) * omega[0]
-			//                                  / pow(Omega_1stDer(t_i, omega[0]),2)) ;
-			br_idx_ds[2 + 2 * i].vals.emplace_back(BrIdx(t_i, omega[0]));
-			// br_idx_ds[1 + 2 * i].vals.emplace_back(b_R(t_i)) ;
-			// br_idx_ds[1 + 2 * i].vals.emplace_back(ODE_Coeff(t_i)) ;
-			// br_idx_ds[2 + 2 * i].vals.emplace_back(b_beta_I(t_i)) ;
-
-			// .....................
-
-			// .....................
-			//    P, P_dot
-			// .....................
-			P_Pdot_ds[2 + 3 * i].vals.emplace_back(2 * M_PI / omega[0]);
-			P_Pdot_ds[3 + 3 * i].vals.emplace_back(-2 * M_PI * Omega_1stDer(t_i, omega[0]) / pow(omega[0], 2));
-			// P_Pdot_ds[3 + 3 * i].vals.emplace_back( - Pdot_sign * omega[0] / ( 2 * Zaki::Physics::YR_2_SEC
-			// * Omega_1stDer(t_i, omega[0]) )  ) ;
-			P_Pdot_ds[4 + 3 * i].vals.emplace_back(-omega[0] / (2 * Zaki::Physics::YR_2_SEC * Omega_1stDer(t_i, omega[0])));
-			P_Pdot_ds[2 + 3 * i].label = "P[" + init_omega_set[i].second + "]";
-			P_Pdot_ds[3 + 3 * i].label = "P_dot[" + init_omega_set[i].second + "]";
-			P_Pdot_ds[4 + 3 * i].label = "SD_Age[" + init_omega_set[i].second + "]";
-
-			// .....................
-
-			// .....................
-			//    M_Omega
-			// .....................
-			M_Omega_ds[5 + i].vals.emplace_back(omega[0]);
-			M_Omega_ds[5 + i].label = "Omega[" + init_omega_set[i].second + "]";
-			// .....................
-
-			//----------------------------------------
+			int status = gsl_odeiv2_driver_apply(tmp_driver, &in_t, t_i, omega.data());
 
 			if (status != GSL_SUCCESS)
 			{
-				printf("\t-------------------%s-------------------\n", "GSL");
-				printf("error, return value=%d\n.", status);
-				printf("Omega = %2.2e.\n", omega[0]);
-				printf("T = %2.2e.\n", t_i);
+				// Back to the last common state (GSL leaves y mid-step)
+				omega = omega_prev;
+				in_t = t_prev;
+				j_split = j;
 				break;
 			}
+
+			record_time(log_t_i, t_i);
+			for (size_t i = 0; i < n_omega; i++)
+			{
+				record_omega(i, t_i, omega[i]);
+			}
 		}
 		//----------------------------------------
 		//          End of loop over time
 		//----------------------------------------
+		gsl_odeiv2_driver_free(tmp_driver);
+	}
+
+	//---------------------------------------------------
+	//    Per-trajectory fallback after a failed shared step
+	//---------------------------------------------------
+	if (j_split < time_res)
+	{
+		printf("\t-------------------%s-------------------\n", "GSL");
+		printf("Shared step failed at T = %2.2e; continuing per initial omega.\n",
+			   pow(10, log_t_0 + j_split * step));
+
+		for (size_t j = j_split; j < time_res; j++)
+		{
+			double log_t_i = log_t_0 + j * step;
+			double t_i = pow(10, log_t_i);
+
+			SetBNVCuttoff(t_i);
+			record_time(log_t_i, t_i);
+		}
+
+		for (size_t i = 0; i < n_omega; i++)
+		{
+			double w[1] = {omega[i]};
+			double t_w = in_t;
+
+			gsl_odeiv2_system ode_sys = {MicroBNVAna::BNV_Sequence::ODE, nullptr, 1, this};
+
+			gsl_odeiv2_driver *tmp_driver = gsl_odeiv2_driver_alloc_y_new(&ode_sys, gsl_odeiv2_step_rk8pd,
+																		  1e-3, 1e-10, 1e-10);
+
+			for (size_t j = j_split; j < time_res; j++)
+			{
+				double t_i = pow(10, log_t_0 + j * step);
+
+				int status = gsl_odeiv2_driver_apply(tmp_driver, &t_w, t_i, w);
+
+				record_omega(i, t_i, w[0]);
+
+				if (status != GSL_SUCCESS)
+				{
+					printf("\t-------------------%s-------------------\n", "GSL");
+					printf("error, return value=%d\n.", status);
+					printf("Omega = %2.2e.\n", w[0]);
+					printf("T = %2.2e.\n", t_i);
+					break;
+				}
+			}
+
+			gsl_odeiv2_driver_free(tmp_driver);
+
+			omega[i] = w[0];
+		}
+	}
+
+	for (size_t i = 0; i < n_omega; i++)
+	{
 		printf("* ---------------H = %2.1e gauss---------------- *\n"
 			   "\tOmega_i = %2.2e.\n",
 			   mag_field, init_omega_set[i].first);
 		printf("\tOmega_f = %2.2e.\n"
 			   "* ------------------------------- *\n",
-			   omega[0]);
-
-		gsl_odeiv2_driver_free(tmp_driver);
+			   omega[i]);
 
 		omega_ds_plt_labels.emplace_back(1 + 2 * i, omega_ds[1 + 2 * i].label);
 		omega_ds_plt_labels.emplace_back(2 + 2 * i, omega_ds[2 + 2 * i].label);
 
-		// br_idx_ds_plt_labels.emplace_back(2 + 2 * i,
-		//   (std::map<std::string, std::string>){
-		//     {"label", "(33)_" + init_omega_set[i].second}, {"ls", "-"}
-		//                                       }) ;
 		br_idx_ds_plt_labels.emplace_back(2 + 2 * i,
 										  (std::map<std::string, std::string>){
 											  {"label", init_omega_set[i].second}, {"ls", "--"}});
-		// br_idx_ds_plt_labels.emplace_back(1 + 2 * i,
-		//   (std::map<std::string, std::string>){
-		//     {"label", init_omega_set[i].second},
-		//                                       }) ;
 
 		P_Pdot_ds_plt_labels.emplace_back(3 + 3 * i,
 										  (std::map<std::string, std::string>){
@@ -1469,8 +1640,6 @@ void MicroBNVAna::BNV_Sequence::Solve(const double t_0, const double t_f)
 											   {"label", init_omega_set[i].second}});
 	}
 	//---------------------------------------------------
-	//      End of loop over omega initial values
-	//---------------------------------------------------
 
 	//---------------------------------------------------
 	//            Plotting Data
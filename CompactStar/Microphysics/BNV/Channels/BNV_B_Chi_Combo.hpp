@@ -110,6 +110,19 @@ class BNV_B_Chi_Combo : public Internal::BNV_Chi
 									const bool &gen_plots = false)
 		override;
 
+	/// Sum of the reactions' Rate_vs_R_Batch matrices, so each
+	///  reaction keeps its own batched kernel
+	RateMatrix Rate_vs_R_Batch(const std::vector<double> &m_chi,
+							   const Baryon &B,
+							   const bool &integrate = false) override;
+
+	/// Includes the reactions' versions, so reconfiguring one of
+	///  them also invalidates the combined rates
+	std::uint64_t RateCacheVersion() const override;
+
+	/// True if every reaction's Rate_vs_R is
+	bool ConcurrentRate() const override;
+
 	void AddChiReaction(BNV_Chi *);
 };
 
@@ -52,10 +52,15 @@
 #ifndef CompactStar_BNV_B_Chi_Photon_H
 #define CompactStar_BNV_B_Chi_Photon_H
 
+#include <memory>
+#include <string>
+#include <vector>
+
 #include <Zaki/Vector/DataSet.hpp>
 
 #include "CompactStar/Core/Pulsar.hpp"
 #include <CompactStar/EOS/CompOSE_EOS.hpp>
+#include <CompactStar/Microphysics/BNV/Channels/BNV_Chi_Photon_PhaseTable.hpp>
 #include <CompactStar/Microphysics/BNV/Internal/BNV_Chi.hpp>
 
 //==============================================================
@@ -70,6 +75,9 @@ class BNV_B_Chi_Photon : public Internal::BNV_Chi
 	// Pulsar pulsar ;
 	bool cgs_units = false;
 
+	/// Tabulated phase-space integral (null: always QAG)
+	std::shared_ptr<const BNV_Chi_Photon_PhaseTable> phase_table;
+
 	// /// The resolution of plot vs m_chi
 	// int m_chi_res = 750 ;
 
@@ -331,15 +339,59 @@ class BNV_B_Chi_Photon : public Internal::BNV_Chi
 	// double Eps_From_Beta_Imbalance_Eq(const double& x) ;
 	// -----------------------------------------------
 
+	/// Parameters of the decay phase-space integrand, passed by value
+	/// to each integration (no shared object state, so thread-safe).
+	struct PhaseSpaceParams
+	{
+		double mu_chi = 0;	///< m_chi / m_B
+		double sigma_0 = 0; ///< Sigma_0 / m_B
+	};
+
+	/// Phase space integrand (dim-less part) for explicit parameters
+	static double PhaseSpace_Integrand(const double &x, const PhaseSpaceParams &par);
+
+	/// Same, with the parameters taken from phase_int_mu_chi / phase_int_sigma_0
 	double PhaseSpace_Integrand(const double &x) override;
+
+	/// Use the phase-space table cached in 'cache_file' (built and
+	/// saved there if missing or built for another domain).
+	/// PhaseSpace_Integral then interpolates inside the table domain
+	/// and falls back to QAG outside it.
+	/// Each overload drops the cached rates (ClearRateCache).
+	void UsePhaseSpaceTable(const std::string &cache_file);
+
+	/// Same, with explicit table domain and tolerance
+	void UsePhaseSpaceTable(const std::string &cache_file,
+							const BNV_Chi_Photon_PhaseTable::Options &opts);
+
+	/// Use an already built table (nullptr: always QAG)
+	void UsePhaseSpaceTable(std::shared_ptr<const BNV_Chi_Photon_PhaseTable> table);
+
+	/// The phase-space table in use (may be null)
+	std::shared_ptr<const BNV_Chi_Photon_PhaseTable> GetPhaseSpaceTable() const;
+
+	/// The full phase-space integral in MeV^4.
+	/// Thread-safe: one QAG workspace per thread, no member state written.
+	/// Interpolated from the phase-space table when one is set and
+	/// the point lies inside its domain.
 	double PhaseSpace_Integral(const Baryon &B,
 							   const double &m,
 							   const double &m_chi,
 							   const double &Sigma_0,
 							   const double &x_F) override;
 
+	/// PhaseSpace_Integral evaluated (in parallel) at every row of
+	/// the m_B, Sigma_0 and x_F columns
+	std::vector<double> PhaseSpace_Integrals(const Baryon &B,
+											 const double &m_chi,
+											 const Zaki::Vector::DataColumn &m_B,
+											 const Zaki::Vector::DataColumn &Sigma_0,
+											 const Zaki::Vector::DataColumn &x_F);
+
 	/// Returns rate per unit volume
 	///  as a function of density in units of s^-1/fm^3
+	///  (density points are integrated in parallel; the result
+	///   is identical to a serial run)
 	Zaki::Vector::DataSet Rate_vs_Density(
 		const double &m_chi,
 		const Baryon &B,
@@ -352,6 +404,10 @@ class BNV_B_Chi_Photon : public Internal::BNV_Chi
 									const Baryon &B,
 									const bool &gen_plots = false)
 		override;
+
+	/// Rate_vs_R only reads shared tables (the phase-space
+	///  quadrature has per-thread workspaces)
+	bool ConcurrentRate() const override { return true; }
 	/// Returns rate per unit volume
 	///  as a function of radius in units of s^-1/fm^3
 	Zaki::Vector::DataSet Rate_vs_R_Slow(const double &m_chi,
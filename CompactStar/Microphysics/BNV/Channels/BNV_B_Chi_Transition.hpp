@@ -106,6 +106,19 @@ class BNV_B_Chi_Transition : public Internal::BNV_Chi
 									const bool &gen_plots = false)
 		override;
 
+	/// Rate_vs_R only reads shared tables
+	bool ConcurrentRate() const override { return true; }
+
+	/// Rate_vs_R for every mass in 'm_chi' (s^-1/fm^3).
+	/// The mass-independent radial terms (k_F^2, m*, Sigma_0) are
+	///  computed once; the two transition conditions are applied as
+	///  masks in a branch-free radial loop, parallel over masses.
+	///  Entries agree with Rate_vs_R to rounding.
+	RateMatrix Rate_vs_R_Batch(const std::vector<double> &m_chi,
+							   const Baryon &B,
+							   const bool &integrate = false)
+		override;
+
 	/// Plots the transition conditions
 	/// for a given m_chi as a function of density
 	void PlotTransCond(const double &m_chi,
@@ -0,0 +1,199 @@
+// -*- lsst-c++ -*-
+/*
+ * CompactStar
+ * See License file at the top of the source tree.
+ *
+ * Copyright (c) 2025
+ * Mohammadreza Zakeri
+ *
+ * MIT License — see LICENSE at repo root.
+ */
+
+/**
+ * @file BNV_Chi_Photon_PhaseTable.hpp
+ * @brief Tabulated emulator of the B -> chi gamma phase-space integral.
+ *
+ * The dimensionless part of BNV_B_Chi_Photon::PhaseSpace_Integral,
+ *
+ *   I(mu, sigma, x_F) = ∫_1^{x_F} f(x; mu, sigma) dx,
+ *   mu = m_chi / m_B*,  sigma = Sigma_0 / m_B*,  x_F = E_F / m_B*,
+ *
+ * is recomputed by QAG for every radius, m_chi and species. Expanding the
+ * integrand (D = 1 + sigma² + 2 x sigma, a = 1 + x sigma),
+ *
+ *   f = sqrt(x² − 1) [ a + 2 mu − 2 mu³ / D − mu⁴ a / D² ],
+ *
+ * shows that it is a polynomial in mu whose coefficients depend only on
+ * (sigma, x). With u = sqrt(x² − 1) = k / m_B*, the four cumulative
+ * coefficient integrals
+ *
+ *   G_k(sigma, u) = ∫_0^u g_k(sigma, u') du',   k = 0, 1, 3, 4,
+ *
+ * are smooth in (sigma, u) and are tabulated once on a uniform grid
+ * (bicubic interpolation). Then, for any mu,
+ *
+ *   I = Σ_k mu^k [ G_k(sigma, u_F) − G_k(sigma, u_lo) ],
+ *
+ * where u_lo is the kinematic threshold of the integrand. An m_chi scan
+ * therefore reuses the same table for every mass.
+ *
+ * The grid is refined (doubled) until the interpolation error, checked
+ * against direct quadrature at cell centres, is below Options::rtol. The
+ * table is saved to a binary file and reloaded on the next run if its
+ * domain and tolerance match.
+ *
+ * Evaluate() returns false outside the (sigma, u) domain, or when the mu
+ * polynomial cancels too strongly for the table error (near threshold); the
+ * caller then falls back to QAG.
+ *
+ * @ingroup BNV
+ */
+
+#ifndef CompactStar_BNV_Chi_Photon_PhaseTable_H
+#define CompactStar_BNV_Chi_Photon_PhaseTable_H
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+//==============================================================
+namespace CompactStar::Microphysics::BNV::Channels
+{
+
+//==============================================================
+//                BNV_Chi_Photon_PhaseTable Class
+//==============================================================
+/**
+ * @class BNV_Chi_Photon_PhaseTable
+ * @brief Error-controlled (sigma, k_F/m_B*) table of the chi gamma phase space.
+ *
+ * Immutable after construction, so one instance can be shared by threads.
+ */
+class BNV_Chi_Photon_PhaseTable
+{
+  public:
+	/// Number of tabulated mu coefficients (powers 0, 1, 3, 4).
+	static constexpr std::size_t kNumCoeffs = 4;
+
+	/**
+	 * @struct Options
+	 * @brief Validity domain and accuracy target.
+	 */
+	struct Options
+	{
+		double sigma_min = -0.15; ///< lower bound of Sigma_0 / m_B*
+		double sigma_max = 1.5;	  ///< upper bound of Sigma_0 / m_B*
+		double u_max = 1.5;		  ///< upper bound of k_F / m_B*
+
+		/// Interpolation error of each G_k relative to max|G_k|.
+		double rtol = 1.0e-6;
+
+		/// Initial nodes per axis (>= 4), doubled until rtol is met.
+		std::size_t n_init = 33;
+
+		/// Maximum nodes per axis (rtol is relaxed with a warning if reached).
+		std::size_t n_max = 1025;
+
+		/// Evaluate() defers to quadrature if its error estimate exceeds
+		/// query_rtol * |I| (cancellation between the mu powers).
+		double query_rtol = 1.0e-5;
+	};
+
+	/**
+	 * @brief Build the table.
+	 * @throws std::runtime_error if the domain is empty or D = 1 + sigma² +
+	 *         2 x sigma vanishes inside it.
+	 */
+	explicit BNV_Chi_Photon_PhaseTable(const Options &opts);
+
+	/// Same, with default Options.
+	BNV_Chi_Photon_PhaseTable() : BNV_Chi_Photon_PhaseTable(Options{}) {}
+
+	/**
+	 * @brief Load the table from @p path if it was built for the same
+	 *        domain and tolerance, otherwise build it and save it there.
+	 *
+	 * A failed save is logged and otherwise ignored.
+	 */
+	static std::shared_ptr<const BNV_Chi_Photon_PhaseTable>
+	LoadOrBuild(const std::string &path, const Options &opts);
+
+	/// Same, with default Options.
+	static std::shared_ptr<const BNV_Chi_Photon_PhaseTable>
+	LoadOrBuild(const std::string &path) { return LoadOrBuild(path, Options{}); }
+
+	/**
+	 * @brief Write the table to @p path (binary).
+	 * @throws std::runtime_error if the file cannot be written.
+	 */
+	void Save(const std::string &path) const;
+
+	/**
+	 * @brief Read a table written by Save().
+	 * @throws std::runtime_error if the file is missing or malformed.
+	 */
+	static std::shared_ptr<const BNV_Chi_Photon_PhaseTable> Load(const std::string &path);
+
+	//--------------------------------------------------------------
+	/// Whether (sigma, x_F) lies inside the tabulated domain.
+	bool InDomain(const double &sigma_0, const double &x_F) const;
+
+	/**
+	 * @brief Dimensionless phase-space integral I(mu, sigma, x_F).
+	 *
+	 * @param[out] out The integral (same normalisation as the QAG result
+	 *                 before the m^4 C / pi^2 prefactor).
+	 * @return false if the query is outside the domain or too close to a
+	 *         cancellation for the table accuracy; @p out is then untouched.
+	 */
+	bool Evaluate(const double &mu_chi, const double &sigma_0,
+				  const double &x_F, double &out) const;
+
+	/// Options the table was built with.
+	const Options &GetOptions() const { return opts_; }
+
+	/// Nodes per axis (sigma, u).
+	std::size_t NumSigma() const { return n_s_; }
+	std::size_t NumU() const { return n_u_; }
+
+	/// Achieved interpolation error of G_k relative to max|G_k|.
+	double MaxError() const;
+
+  private:
+	/// Uninitialised table (used by Load).
+	struct NoBuild
+	{
+	};
+	BNV_Chi_Photon_PhaseTable(const Options &opts, NoBuild) : opts_(opts) {}
+
+	/// Load() returning a mutable table (LoadOrBuild adjusts query_rtol).
+	static std::shared_ptr<BNV_Chi_Photon_PhaseTable> Read_(const std::string &path);
+
+	/// Fill the node values on an n_s x n_u grid.
+	void Fill_(std::size_t n_s, std::size_t n_u);
+
+	/// Worst relative interpolation error per coefficient at cell centres.
+	std::array<double, kNumCoeffs> Check_() const;
+
+	/// Bicubic interpolation of every G_k at (sigma, u).
+	void Interp_(const double &sigma, const double &u, double (&G)[kNumCoeffs]) const;
+
+	Options opts_;
+	std::size_t n_s_ = 0;
+	std::size_t n_u_ = 0;
+	double h_s_ = 0.0;
+	double h_u_ = 0.0;
+
+	/// G_k at node (i, j): g_[k][i * n_u_ + j].
+	std::array<std::vector<double>, kNumCoeffs> g_;
+
+	/// max|G_k| over the nodes and achieved relative error of G_k.
+	std::array<double, kNumCoeffs> scale_{};
+	std::array<double, kNumCoeffs> err_{};
+};
+
+} // namespace CompactStar::Microphysics::BNV::Channels
+
+#endif /* CompactStar_BNV_Chi_Photon_PhaseTable_H */
@@ -2,6 +2,8 @@
   BNV_B_Chi_Combo class
 */
 
+#include <stdexcept>
+
 #include <gsl/gsl_integration.h>
 
 #include <Zaki/Math/GSLFuncWrapper.hpp>
@@ -52,6 +54,8 @@ void MicroBNVCh::BNV_B_Chi_Combo::SetModel(const std::string &in_eos_model)
 {
 	model = in_eos_model;
 
+	ClearRateCache();
+
 	for (auto &&i : chi_reactions)
 	{
 		i->SetModel(in_eos_model);
@@ -95,6 +99,8 @@ void MicroBNVCh::BNV_B_Chi_Combo::ImportEOS(const Zaki::String::Directory &eos_d
 	{
 		i->ImportEOS(eos_dir);
 	}
+
+	ClearRateCache();
 }
 
 //--------------------------------------------------------------
@@ -127,6 +133,33 @@ void MicroBNVCh::BNV_B_Chi_Combo::FindPulsar(const bool &gen_plots)
 	{
 		i->FindPulsar(false);
 	}
+
+	ClearRateCache();
+}
+
+//--------------------------------------------------------------
+bool MicroBNVCh::BNV_B_Chi_Combo::ConcurrentRate() const
+{
+	for (auto &&i : chi_reactions)
+	{
+		if (!i->ConcurrentRate())
+			return false;
+	}
+
+	return true;
+}
+
+//--------------------------------------------------------------
+std::uint64_t MicroBNVCh::BNV_B_Chi_Combo::RateCacheVersion() const
+{
+	// Each version only grows, so the sum changes whenever any does
+	std::uint64_t ver = BNV_Chi::RateCacheVersion();
+	for (auto &&i : chi_reactions)
+	{
+		ver += i->RateCacheVersion();
+	}
+
+	return ver;
 }
 
 //--------------------------------------------------------------
@@ -143,6 +176,8 @@ void MicroBNVCh::BNV_B_Chi_Combo::OnWorkDirChanged(const Zaki::String::Directory
 void MicroBNVCh::BNV_B_Chi_Combo::AddChiReaction(BNV_Chi *bnv_chi_ptr)
 {
 	chi_reactions.emplace_back(bnv_chi_ptr);
+
+	ClearRateCache();
 }
 
 //--------------------------------------------------------------
@@ -176,8 +211,15 @@ Zaki::Vector::DataSet MicroBNVCh::BNV_B_Chi_Combo::Rate_vs_R(const double &m_chi
 															 const Baryon &B,
 															 const bool &gen_plots)
 {
+	const auto micro = MicroProfile(B);
+	if (!micro)
+	{
+		Z_LOG_ERROR("Pulsar profile is not set or empty.");
+		return Zaki::Vector::DataSet{};
+	}
+
 	Zaki::Vector::DataSet rate;
-	rate.data_set.emplace_back(*pulsar.GetProfile()->GetRadius());
+	rate.data_set.emplace_back(micro->r);
 	rate.AddColumn("rate", 0);
 	for (auto &&i : chi_reactions)
 	{
@@ -193,6 +235,37 @@ Zaki::Vector::DataSet MicroBNVCh::BNV_B_Chi_Combo::Rate_vs_R(const double &m_chi
 }
 
 //--------------------------------------------------------------
+MicroBNVInt::BNV_Chi::RateMatrix MicroBNVCh::BNV_B_Chi_Combo::Rate_vs_R_Batch(
+	const std::vector<double> &m_chi,
+	const Baryon &B,
+	const bool &integrate)
+{
+	if (chi_reactions.empty())
+		return BNV_Chi::Rate_vs_R_Batch(m_chi, B, integrate);
+
+	RateMatrix out;
+	for (size_t k = 0; k < chi_reactions.size(); k++)
+	{
+		RateMatrix part = chi_reactions[k]->Rate_vs_R_Batch(m_chi, B, false);
+
+		if (k == 0)
+		{
+			out = std::move(part);
+			continue;
+		}
+
+		if (part.r.size() != out.r.size() || part.rate.size() != out.rate.size())
+			throw std::runtime_error("BNV_B_Chi_Combo::Rate_vs_R_Batch: reactions use different radial grids.");
+
+		for (size_t i = 0; i < out.rate.size(); i++)
+			out.rate[i] += part.rate[i];
+	}
+
+	if (integrate)
+		IntegrateRateMatrix(out);
+
+	return out;
+}
 
 //--------------------------------------------------------------
 //==============================================================
@@ -2,6 +2,9 @@
   BNV_B_Chi_Photon class
 */
 
+#include <memory>
+#include <vector>
+
 #include <gsl/gsl_integration.h>
 
 #include <Zaki/Math/GSLFuncWrapper.hpp>
@@ -46,6 +49,29 @@ double Eps_From_Beta_Imbalance_Eq_Der(const double &x)
 	return 5 * x_5_coeff * pow(x, 4) + 7 * x_7_coeff * pow(x, 6) - 2.42 * x_242_coeff * pow(x, 1.42);
 }
 
+//==============================================================
+namespace
+{
+/// Size of the per-thread QAG workspace (same limit as the integrations)
+constexpr size_t kQAGLimit = 2000;
+
+/// One QAG workspace per thread, allocated on first use and reused
+gsl_integration_workspace *ThreadWorkspace()
+{
+	thread_local std::unique_ptr<gsl_integration_workspace,
+								 decltype(&gsl_integration_workspace_free)>
+		w(gsl_integration_workspace_alloc(kQAGLimit), &gsl_integration_workspace_free);
+	return w.get();
+}
+
+/// GSL callback for BNV_B_Chi_Photon::PhaseSpace_Integrand(x, par)
+double PhaseSpace_GSL(double x, void *params)
+{
+	return MicroBNVCh::BNV_B_Chi_Photon::PhaseSpace_Integrand(
+		x, *static_cast<const MicroBNVCh::BNV_B_Chi_Photon::PhaseSpaceParams *>(params));
+}
+} // namespace
+
 //==============================================================
 //==============================================================
 //                        BNV_B_Chi_Photon class
@@ -230,11 +256,19 @@ Zaki::Vector::DataSet MicroBNVCh::BNV_B_Chi_Photon::Escape_Rate_vs_R(const Baryo
 																	 const double &m_chi,
 																	 const bool &export_flag)
 {
-	Zaki::Vector::DataColumn kF_2 = (3 * M_PI * M_PI * micro_r["n_" + B.label]).pow(2.0 / 3.0);
+	// n_B(r), m*(r), Sigma_0(r) of the pulsar profile (shared cache)
+	const auto micro = MicroProfile(B);
+	if (!micro || micro->n_B.Size() != micro->r.Size())
+	{
+		Z_LOG_ERROR("Pulsar profile (or its " + B.name + " fraction) is not set.");
+		return Zaki::Vector::DataSet{};
+	}
+
+	Zaki::Vector::DataColumn kF_2 = (3 * M_PI * M_PI * micro->n_B).pow(2.0 / 3.0);
 	kF_2 /= pow(Zaki::Physics::MEV_2_INV_FM, 2);
 
-	Zaki::Vector::DataColumn m_B = micro_r["m_" + B.label];
-	Zaki::Vector::DataColumn Sigma_0 = micro_r["sig_" + B.label];
+	const Zaki::Vector::DataColumn &m_B = micro->m_eff;
+	const Zaki::Vector::DataColumn &Sigma_0 = micro->sigma_0;
 	Zaki::Vector::DataColumn x_F = (m_B * m_B + kF_2).sqrt() / m_B;
 
 	Zaki::Vector::DataColumn nu_r = *pulsar.GetProfile()->GetMetricNu();
@@ -249,7 +283,7 @@ Zaki::Vector::DataSet MicroBNVCh::BNV_B_Chi_Photon::Escape_Rate_vs_R(const Baryo
 		double escaped_rate = Escape_PhaseSpace_Integral(B, m_B[i], m_chi, Sigma_0[i], x_F[i]);
 		double total_rate = PhaseSpace_Integral(B, m_B[i], m_chi, Sigma_0[i], x_F[i]);
 
-		rate_vs_r.AppendRow({micro_r[0][i],
+		rate_vs_r.AppendRow({micro->r[i],
 							 escaped_rate,
 							 total_rate,
 							 escaped_rate / total_rate});
@@ -714,13 +748,18 @@ Zaki::Vector::DataSet MicroBNVCh::BNV_B_Chi_Photon::Thermal_Hole_E_Rate_vs_R(con
 																			 const Baryon &B,
 																			 const bool &gen_plots)
 {
+	// r and n(r) of the pulsar profile (shared cache)
+	const auto micro = MicroProfile(B);
+	if (!micro)
+	{
+		Z_LOG_ERROR("Pulsar profile is not set or empty.");
+		return Zaki::Vector::DataSet{};
+	}
+
 	Zaki::Vector::DataSet rate_vs_n = Thermal_Hole_E_Rate_vs_Density(m_chi, B);
 	rate_vs_n.Interpolate(0, 1);
 
-	Zaki::Vector::DataColumn n_r = *pulsar.GetProfile()->GetBaryonDensity();
-
-	Zaki::Vector::DataSet rate_vs_r({*pulsar.GetProfile()->GetRadius(),
-									 rate_vs_n.Evaluate(1, n_r)});
+	Zaki::Vector::DataSet rate_vs_r({micro->r, rate_vs_n.Evaluate(1, micro->n_tot)});
 
 	if (gen_plots)
 	{
@@ -1049,13 +1088,18 @@ Zaki::Vector::DataSet MicroBNVCh::BNV_B_Chi_Photon::Thermal_Photon_E_Rate_vs_R(c
 																			   const Baryon &B,
 																			   const bool &gen_plots)
 {
+	// r and n(r) of the pulsar profile (shared cache)
+	const auto micro = MicroProfile(B);
+	if (!micro)
+	{
+		Z_LOG_ERROR("Pulsar profile is not set or empty.");
+		return Zaki::Vector::DataSet{};
+	}
+
 	Zaki::Vector::DataSet rate_vs_n = Thermal_Photon_E_Rate_vs_Density(m_chi, B);
 	rate_vs_n.Interpolate(0, 1);
 
-	Zaki::Vector::DataColumn n_r = *pulsar.GetProfile()->GetBaryonDensity();
-
-	Zaki::Vector::DataSet rate_vs_r({*pulsar.GetProfile()->GetRadius(),
-									 rate_vs_n.Evaluate(1, n_r)});
+	Zaki::Vector::DataSet rate_vs_r({micro->r, rate_vs_n.Evaluate(1, micro->n_tot)});
 
 	if (gen_plots)
 	{
@@ -1359,8 +1403,15 @@ void MicroBNVCh::BNV_B_Chi_Photon::Plot_Limited_Thermal_E_Rate() const
 //
 double MicroBNVCh::BNV_B_Chi_Photon::PhaseSpace_Integrand(const double &x)
 {
-	double mu_chi = phase_int_mu_chi;
-	double sigma_0 = phase_int_sigma_0;
+	return PhaseSpace_Integrand(x, {phase_int_mu_chi, phase_int_sigma_0});
+}
+
+//--------------------------------------------------------------
+double MicroBNVCh::BNV_B_Chi_Photon::PhaseSpace_Integrand(const double &x,
+														  const PhaseSpaceParams &par)
+{
+	const double mu_chi = par.mu_chi;
+	const double sigma_0 = par.sigma_0;
 
 	if (x <= (mu_chi * mu_chi - 1 - sigma_0 * sigma_0) / (2 * sigma_0))
 	{
@@ -1394,6 +1445,40 @@ double MicroBNVCh::BNV_B_Chi_Photon::PhaseSpace_Integrand(const double &x)
 	return out;
 }
 
+//--------------------------------------------------------------
+void MicroBNVCh::BNV_B_Chi_Photon::UsePhaseSpaceTable(const std::string &cache_file)
+{
+	phase_table = BNV_Chi_Photon_PhaseTable::LoadOrBuild(cache_file);
+
+	ClearRateCache();
+}
+
+//--------------------------------------------------------------
+void MicroBNVCh::BNV_B_Chi_Photon::UsePhaseSpaceTable(
+	const std::string &cache_file,
+	const BNV_Chi_Photon_PhaseTable::Options &opts)
+{
+	phase_table = BNV_Chi_Photon_PhaseTable::LoadOrBuild(cache_file, opts);
+
+	ClearRateCache();
+}
+
+//--------------------------------------------------------------
+void MicroBNVCh::BNV_B_Chi_Photon::UsePhaseSpaceTable(
+	std::shared_ptr<const BNV_Chi_Photon_PhaseTable> table)
+{
+	phase_table = std::move(table);
+
+	ClearRateCache();
+}
+
+//--------------------------------------------------------------
+std::shared_ptr<const MicroBNVCh::BNV_Chi_Photon_PhaseTable>
+MicroBNVCh::BNV_B_Chi_Photon::GetPhaseSpaceTable() const
+{
+	return phase_table;
+}
+
 //--------------------------------------------------------------
 // The full phase-space integral
 // The output is in MeV^4
@@ -1407,20 +1492,22 @@ double MicroBNVCh::BNV_B_Chi_Photon::PhaseSpace_Integral(const Baryon &B,
 	double q_e = Zaki::Physics::Q_E;
 	// double eps = 1e-10 ;
 
-	phase_int_mu_chi = m_chi / m;
-	// phase_int_sigma_0 = -Sigma_0 / m ;
-	phase_int_sigma_0 = Sigma_0 / m;
+	// Per-call integrand context (members are not touched, so concurrent
+	// calls from several threads are independent).
+	// par.sigma_0 = -Sigma_0 / m ;
+	PhaseSpaceParams par{m_chi / m, Sigma_0 / m};
 
-	gsl_integration_workspace *w = gsl_integration_workspace_alloc(2000);
 	double err, result;
 
-	Zaki::Math::GSLFuncWrapper<BNV_B_Chi_Photon, double (MicroBNVCh::BNV_B_Chi_Photon::*)(const double &)>
-		Fp(this, &MicroBNVCh::BNV_B_Chi_Photon::PhaseSpace_Integrand);
-
-	gsl_function F = static_cast<gsl_function>(Fp);
+	// Tabulated integral if available, QAG otherwise
+	if (!phase_table || !phase_table->Evaluate(par.mu_chi, par.sigma_0, x_F, result))
+	{
+		gsl_function F;
+		F.function = &PhaseSpace_GSL;
+		F.params = &par;
 
-	gsl_integration_qag(&F, 1, x_F, 1e-10, 1e-10, 2000, 1, w, &result, &err);
-	gsl_integration_workspace_free(w);
+		gsl_integration_qag(&F, 1, x_F, 1e-10, 1e-10, 2000, 1, ThreadWorkspace(), &result, &err);
+	}
 
 	// C
 	double C = pow(B.g * default_eps * q_e, 2) / (128 * M_PI * m * m);
@@ -1584,6 +1671,30 @@ double MicroBNVCh::BNV_B_Chi_Photon::PhaseSpace_Integral(const Baryon &B,
 //   return res_integral ;
 // }
 
+//--------------------------------------------------------------
+// PhaseSpace_Integral at every point of the (m_B, Sigma_0, x_F) columns.
+// The points are independent, so they are integrated in parallel; each
+// point runs the same QAG as in a serial loop, hence identical results.
+std::vector<double> MicroBNVCh::BNV_B_Chi_Photon::PhaseSpace_Integrals(
+	const Baryon &B,
+	const double &m_chi,
+	const Zaki::Vector::DataColumn &m_B,
+	const Zaki::Vector::DataColumn &Sigma_0,
+	const Zaki::Vector::DataColumn &x_F)
+{
+	const std::ptrdiff_t n = static_cast<std::ptrdiff_t>(m_B.Size());
+	std::vector<double> out(m_B.Size(), 0.0);
+
+#pragma omp parallel for schedule(dynamic)
+	for (std::ptrdiff_t i = 0; i < n; i++)
+	{
+		out[i] = BNV_B_Chi_Photon::PhaseSpace_Integral(B, m_B.vals[i], m_chi,
+													   Sigma_0.vals[i], x_F.vals[i]);
+	}
+
+	return out;
+}
+
 //--------------------------------------------------------------
 /// The decay rate per unit volume
 /// Out put is in s^-1/fm^3
@@ -1603,10 +1714,11 @@ Zaki::Vector::DataSet MicroBNVCh::BNV_B_Chi_Photon::Rate_vs_Density(
 	Zaki::Vector::DataSet rate;
 	rate.Reserve(2, n_B["n_tot"].Size());
 
+	const std::vector<double> gamma = PhaseSpace_Integrals(B, m_chi, m_B, Sigma_0, x_F);
+
 	for (size_t i = 0; i < m_B.Size(); i++)
 	{
-		rate.AppendRow({n_B["n_tot"][i],
-						PhaseSpace_Integral(B, m_B[i], m_chi, Sigma_0[i], x_F[i])});
+		rate.AppendRow({n_B["n_tot"][i], gamma[i]});
 	}
 
 	// Converting "MeV^4" into "MeV/fm^3"
@@ -1643,15 +1755,20 @@ Zaki::Vector::DataSet MicroBNVCh::BNV_B_Chi_Photon::Rate_vs_R(const double &m_ch
 															  const Baryon &B,
 															  const bool &gen_plots)
 {
+	// r and n(r) of the pulsar profile (shared cache)
+	const auto micro = MicroProfile(B);
+	if (!micro)
+	{
+		Z_LOG_ERROR("Pulsar profile is not set or empty.");
+		return Zaki::Vector::DataSet{};
+	}
+
 	Zaki::Vector::DataSet rate_vs_n = Rate_vs_Density(m_chi, B);
 	rate_vs_n.Interpolate(0, 1);
 
-	Zaki::Vector::DataColumn n_r = *pulsar.GetProfile()->GetBaryonDensity();
-
 	// Zaki::Vector::DataSet ds_B_chi_photon_rate_n ({EOS_ds[2], B_chi_photon_rate}) ;
 
-	Zaki::Vector::DataSet rate_vs_r({*pulsar.GetProfile()->GetRadius(),
-									 rate_vs_n.Evaluate(1, n_r)});
+	Zaki::Vector::DataSet rate_vs_r({micro->r, rate_vs_n.Evaluate(1, micro->n_tot)});
 
 	// // Converting "MeV^4" into "MeV/fm^3"
 	// rate_vs_r[1] *= pow(Zaki::Physics::MEV_2_INV_FM, 3) ;
@@ -1674,20 +1791,29 @@ Zaki::Vector::DataSet MicroBNVCh::BNV_B_Chi_Photon::Rate_vs_R_Slow(const double
 																   const Baryon &B,
 																   const bool &gen_plots)
 {
-	Zaki::Vector::DataColumn kF_2 = (3 * M_PI * M_PI * micro_r["n_" + B.label]).pow(2.0 / 3.0);
+	// n_B(r), m*(r), Sigma_0(r) of the pulsar profile (shared cache)
+	const auto micro = MicroProfile(B);
+	if (!micro || micro->n_B.Size() != micro->r.Size())
+	{
+		Z_LOG_ERROR("Pulsar profile (or its " + B.name + " fraction) is not set.");
+		return Zaki::Vector::DataSet{};
+	}
+
+	Zaki::Vector::DataColumn kF_2 = (3 * M_PI * M_PI * micro->n_B).pow(2.0 / 3.0);
 	kF_2 /= pow(Zaki::Physics::MEV_2_INV_FM, 2);
 
-	Zaki::Vector::DataColumn m_B = micro_r["m_" + B.label];
-	Zaki::Vector::DataColumn Sigma_0 = micro_r["sig_" + B.label];
+	const Zaki::Vector::DataColumn &m_B = micro->m_eff;
+	const Zaki::Vector::DataColumn &Sigma_0 = micro->sigma_0;
 	Zaki::Vector::DataColumn x_F = (m_B * m_B + kF_2).sqrt() / m_B;
 
 	Zaki::Vector::DataSet rate_vs_r;
 	rate_vs_r.Reserve(2, m_B.Size());
 
+	const std::vector<double> gamma = PhaseSpace_Integrals(B, m_chi, m_B, Sigma_0, x_F);
+
 	for (size_t i = 0; i < m_B.Size(); i++)
 	{
-		rate_vs_r.AppendRow({micro_r[0][i],
-							 PhaseSpace_Integral(B, m_B[i], m_chi, Sigma_0[i], x_F[i])});
+		rate_vs_r.AppendRow({micro->r[i], gamma[i]});
 	}
 
 	// Converting "MeV^4" into "MeV/fm^3"
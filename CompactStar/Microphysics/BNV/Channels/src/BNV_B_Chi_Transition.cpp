@@ -10,6 +10,7 @@
 
 #include <Zaki/Math/GSLFuncWrapper.hpp>
 #include <Zaki/Physics/Constants.hpp>
+#include <Zaki/Util/Instrumentor.hpp>
 #include <Zaki/Vector/DataSet.hpp>
 
 #include "CompactStar/Core/TOVSolver.hpp"
@@ -136,36 +137,24 @@ Zaki::Vector::DataSet MicroBNVCh::BNV_B_Chi_Transition::Rate_vs_R(
 {
 	// double eps = 1e-10 ;
 
-	const Core::StarProfile *prof = pulsar.GetProfile();
-	if (!prof || prof->empty())
+	// r, n_B(r), m*(r) and Sigma_0(r), evaluated once per (EoS, profile, B)
+	const auto micro = MicroProfile(B);
+	if (!micro)
 	{
 		Z_LOG_ERROR("Pulsar profile is not set or empty. Cannot compute B -> chi decay rate vs radius.");
 		return Zaki::Vector::DataSet{};
 	}
 
-	// 1) total baryon density n(r)
-	const Zaki::Vector::DataColumn *n_r_col = prof->GetBaryonDensity();
-	// 2) radius column
-	const Zaki::Vector::DataColumn *r_col = prof->GetColumnPtr(Core::StarProfile::Column::Radius);
-	// 3) species fraction for this baryon
-	const Zaki::Vector::DataColumn *frac_col = prof->GetSpeciesPtr(B.label);
-
-	if (!n_r_col || !r_col || !frac_col)
+	// species fraction for this baryon
+	if (micro->n_B.Size() != micro->r.Size())
 	{
 		return Zaki::Vector::DataSet{};
 	}
 
-	// make local copies because we’re going to do arithmetic
-	Zaki::Vector::DataColumn n_r = *n_r_col;
-	Zaki::Vector::DataColumn r = *r_col;
-	Zaki::Vector::DataColumn n_B_r = n_r * (*frac_col);
-
-	Zaki::Vector::DataSet ds_m_B_n({n_B["n_tot"], eos.GetMeff(B.label)});
-	Zaki::Vector::DataSet sig0_n({n_B["n_tot"], eos.GetVeff(B.label)});
-	ds_m_B_n.Interpolate(0, 1);
-	sig0_n.Interpolate(0, 1);
-	Zaki::Vector::DataColumn m_B_r = ds_m_B_n.Evaluate(1, n_r);
-	Zaki::Vector::DataColumn sig0_r = sig0_n.Evaluate(1, n_r);
+	const Zaki::Vector::DataColumn &r = micro->r;
+	const Zaki::Vector::DataColumn &n_B_r = micro->n_B;
+	const Zaki::Vector::DataColumn &m_B_r = micro->m_eff;
+	const Zaki::Vector::DataColumn &sig0_r = micro->sigma_0;
 
 	Zaki::Vector::DataSet rate;
 	rate.Reserve(2, r.Size());
@@ -232,6 +221,95 @@ Zaki::Vector::DataSet MicroBNVCh::BNV_B_Chi_Transition::Rate_vs_R(
 //--------------------------------------------------------------
 // // This function returns the B -> chi decay rate
 // //  as a function of radius in units of s^-1/fm^3
+//--------------------------------------------------------------
+/// Returns the B -> chi decay rate per unit volume on a grid
+///  of dark masses, in units of s^-1/fm^3
+MicroBNVInt::BNV_Chi::RateMatrix MicroBNVCh::BNV_B_Chi_Transition::Rate_vs_R_Batch(
+	const std::vector<double> &m_chi,
+	const Baryon &B,
+	const bool &integrate)
+{
+	PROFILE_FUNCTION();
+
+	RateMatrix out;
+	out.m_chi = m_chi;
+
+	const auto micro = MicroProfile(B);
+	if (!micro || micro->n_B.Size() != micro->r.Size())
+	{
+		Z_LOG_ERROR("Pulsar profile is not set or has no '" + B.name + "' fraction. Cannot compute B -> chi decay rates vs radius.");
+		return out;
+	}
+
+	const size_t n_r = micro->r.Size();
+	const size_t n_m = m_chi.size();
+
+	out.r = micro->r.vals;
+	out.rate.assign(n_m * n_r, 0.0);
+
+	// Mass-independent radial terms, as in SigmaMinus
+	std::vector<double> kF_2(n_r), mB_kF_2(n_r);
+	for (size_t j = 0; j < n_r; j++)
+	{
+		kF_2[j] = pow(3 * M_PI * M_PI * micro->n_B[j], 2.0 / 3.0);
+		kF_2[j] /= pow(Zaki::Physics::MEV_2_INV_FM, 2);
+		mB_kF_2[j] = micro->m_eff[j] * micro->m_eff[j] + kF_2[j];
+	}
+
+	const double *m_B_r = micro->m_eff.vals.data();
+	const double *sig0_r = micro->sigma_0.vals.data();
+	const double *kF_2_r = kF_2.data();
+	const double *mB_kF_2_r = mB_kF_2.data();
+
+	const double eps_2 = default_eps * default_eps;
+	const double to_fm = pow(Zaki::Physics::MEV_2_INV_FM, 3);
+	const double to_s = 1e-3 * Zaki::Physics::GEV_2_S;
+
+#pragma omp parallel for schedule(static)
+	for (size_t i = 0; i < n_m; i++)
+	{
+		const double m = m_chi[i];
+		const double m_2 = m * m;
+		double *row = out.rate.data() + i * n_r;
+
+		// Same arithmetic as Rate_vs_R; the NaNs of the excluded
+		// points are discarded by the mask.
+#pragma omp simd
+		for (size_t j = 0; j < n_r; j++)
+		{
+			const double m_B = m_B_r[j];
+			const double sig0 = sig0_r[j];
+
+			double sig_minus = m_B * m_B + m_2 + 2 * kF_2_r[j];
+			sig_minus -= 2 * sqrt(mB_kF_2_r[j] * (kF_2_r[j] + m_2));
+			sig_minus = sqrt(sig_minus);
+
+			const bool allowed = !(sig0 < sig_minus) && !(sig0 > m - m_B);
+
+			const double abs_sig0 = std::abs(sig0);
+
+			double p = (sig0 - m_B) * (sig0 - m_B) - m_2;
+			p *= (sig0 + m_B) * (sig0 + m_B) - m_2;
+			p = sqrt(p);
+			p /= 2 * abs_sig0;
+
+			double amp_sqrd = (m + m_B) * (m + m_B) - sig0 * sig0;
+			amp_sqrd *= eps_2;
+
+			double rate_val = p * amp_sqrd / (2 * M_PI * abs_sig0);
+			rate_val *= to_fm;
+			rate_val *= to_s;
+
+			row[j] = allowed ? rate_val : 0.0;
+		}
+	}
+
+	if (integrate)
+		IntegrateRateMatrix(out);
+
+	return out;
+}
+
 // void MicroBNVCh::BNV_B_Chi_Transition::Rate_vs_R(const double& m_chi)
 // {
 //   Rate_vs_R(m_chi, neutron, true) ;
@@ -718,13 +718,18 @@ Zaki::Vector::DataSet MicroBNVCh::BNV_B_Psi_Pion::Rate_vs_R(const double &m_psi,
 															const Baryon &B,
 															const bool &gen_plots)
 {
+	// r and n(r) of the pulsar profile (shared cache)
+	const auto micro = MicroProfile(B);
+	if (!micro)
+	{
+		Z_LOG_ERROR("Pulsar profile is not set or empty.");
+		return Zaki::Vector::DataSet{};
+	}
+
 	Zaki::Vector::DataSet rate_vs_n = Rate_vs_Density(m_psi, B);
 	rate_vs_n.Interpolate(0, 1);
 
-	Zaki::Vector::DataColumn n_r = *pulsar.GetProfile()->GetBaryonDensity();
-
-	Zaki::Vector::DataSet rate_vs_r({*pulsar.GetProfile()->GetRadius(),
-									 rate_vs_n.Evaluate(1, n_r)});
+	Zaki::Vector::DataSet rate_vs_r({micro->r, rate_vs_n.Evaluate(1, micro->n_tot)});
 
 	if (gen_plots)
 	{
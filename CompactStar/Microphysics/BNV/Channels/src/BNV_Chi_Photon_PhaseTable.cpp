@@ -0,0 +1,415 @@
+// -*- lsst-c++ -*-
+/*
+ * CompactStar
+ * See License file at the top of the source tree.
+ *
+ * Copyright (c) 2025
+ * Mohammadreza Zakeri
+ *
+ * MIT License — see LICENSE at repo root.
+ */
+
+/**
+ * @file BNV_Chi_Photon_PhaseTable.cpp
+ * @brief Build, disk cache and bicubic evaluation of the chi gamma phase-space table.
+ */
+
+#include "CompactStar/Microphysics/BNV/Channels/BNV_Chi_Photon_PhaseTable.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+#include <gsl/gsl_integration.h>
+
+#include <Zaki/Util/Instrumentor.hpp>
+#include <Zaki/Util/Logger.hpp>
+
+//==============================================================
+namespace CompactStar::Microphysics::BNV::Channels
+{
+
+namespace
+{
+constexpr char kMagic[8] = {'C', 'S', 'C', 'H', 'I', 'P', 'T', '1'};
+
+/// Gauss–Legendre order per u panel (integrands are smooth polynomials/rationals).
+constexpr std::size_t kGLOrder = 16;
+
+/// mu powers of the tabulated coefficients.
+constexpr int kPower[BNV_Chi_Photon_PhaseTable::kNumCoeffs] = {0, 1, 3, 4};
+
+/// Shared Gauss–Legendre table (read-only after construction).
+const gsl_integration_glfixed_table *GLTable()
+{
+	static const std::unique_ptr<gsl_integration_glfixed_table,
+								 decltype(&gsl_integration_glfixed_table_free)>
+		t(gsl_integration_glfixed_table_alloc(kGLOrder), &gsl_integration_glfixed_table_free);
+	return t.get();
+}
+
+/**
+ * @brief The four coefficient integrands in u = sqrt(x² − 1) (dx = u/x du).
+ *
+ *   g_0 = u a,  g_1 = 2 u,  g_3 = −2 u / D,  g_4 = −u a / D²   (times u / x)
+ */
+void Coefficients(const double &sigma, const double &u, double (&h)[BNV_Chi_Photon_PhaseTable::kNumCoeffs])
+{
+	const double x = std::sqrt(1.0 + u * u);
+	const double a = 1.0 + x * sigma;
+	const double D = 1.0 + sigma * sigma + 2.0 * x * sigma;
+	const double base = u * u / x;
+
+	h[0] = base * a;
+	h[1] = 2.0 * base;
+	h[2] = -2.0 * base / D;
+	h[3] = -base * a / (D * D);
+}
+
+/// Adds ∫_{u_a}^{u_b} g_k du to @p G for every k.
+void AddPanel(const double &sigma, const double &u_a, const double &u_b,
+			  double (&G)[BNV_Chi_Photon_PhaseTable::kNumCoeffs])
+{
+	const gsl_integration_glfixed_table *t = GLTable();
+	double h[BNV_Chi_Photon_PhaseTable::kNumCoeffs];
+
+	for (std::size_t q = 0; q < kGLOrder; ++q)
+	{
+		double u_q = 0.0, w_q = 0.0;
+		gsl_integration_glfixed_point(u_a, u_b, q, &u_q, &w_q, t);
+		Coefficients(sigma, u_q, h);
+		for (std::size_t k = 0; k < BNV_Chi_Photon_PhaseTable::kNumCoeffs; ++k)
+			G[k] += w_q * h[k];
+	}
+}
+
+/// Short scientific notation for log messages.
+std::string Sci(const double &v)
+{
+	char buf[32];
+	std::snprintf(buf, sizeof(buf), "%.2e", v);
+	return buf;
+}
+
+/// Cubic Lagrange stencil start and weights for coordinate t on n nodes.
+std::size_t Stencil(const double &t, const std::size_t &n, double (&w)[4])
+{
+	const double i0f = std::clamp(std::floor(t) - 1.0, 0.0, static_cast<double>(n - 4));
+	const double p = t - i0f;
+
+	w[0] = -(p - 1.0) * (p - 2.0) * (p - 3.0) / 6.0;
+	w[1] = p * (p - 2.0) * (p - 3.0) / 2.0;
+	w[2] = -p * (p - 1.0) * (p - 3.0) / 2.0;
+	w[3] = p * (p - 1.0) * (p - 2.0) / 6.0;
+
+	return static_cast<std::size_t>(i0f);
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//  Construction
+// -----------------------------------------------------------------------------
+BNV_Chi_Photon_PhaseTable::BNV_Chi_Photon_PhaseTable(const Options &opts)
+	: opts_(opts)
+{
+	PROFILE_FUNCTION();
+
+	if (!(opts_.sigma_max > opts_.sigma_min) || !(opts_.u_max > 0.0) ||
+		opts_.n_init < 4 || opts_.n_max < opts_.n_init)
+		throw std::runtime_error("BNV_Chi_Photon_PhaseTable: invalid domain or node counts.");
+
+	// D = 1 + sigma² + 2 x sigma is increasing in sigma for sigma > -1 and
+	// linear in x, so its minimum over the domain is at sigma_min and one
+	// end of x ∈ [1, x_max].
+	const double x_max = std::sqrt(1.0 + opts_.u_max * opts_.u_max);
+	const double s = opts_.sigma_min;
+	if (!(s > -1.0) || !(1.0 + s * s + 2.0 * s > 0.0) || !(1.0 + s * s + 2.0 * x_max * s > 0.0))
+		throw std::runtime_error("BNV_Chi_Photon_PhaseTable: 1 + sigma^2 + 2 x sigma vanishes in the domain"
+								 " (raise sigma_min or lower u_max).");
+
+	std::size_t n = opts_.n_init;
+	double worst = 0.0;
+	while (true)
+	{
+		Fill_(n, n);
+		err_ = Check_();
+		worst = MaxError();
+
+		if (!(worst > opts_.rtol) || 2 * n - 1 > opts_.n_max)
+			break;
+		n = 2 * n - 1;
+	}
+
+	if (worst > opts_.rtol)
+	{
+		Z_LOG_WARNING("BNV_Chi_Photon_PhaseTable: n_max = " + std::to_string(opts_.n_max) +
+					  " reached with relative error " + Sci(worst) +
+					  " > rtol = " + Sci(opts_.rtol) + ".");
+	}
+
+	Z_LOG_INFO("BNV_Chi_Photon_PhaseTable: " + std::to_string(n_s_) + " x " + std::to_string(n_u_) +
+			   " nodes, max relative error " + Sci(worst) + ".");
+}
+
+//--------------------------------------------------------------
+void BNV_Chi_Photon_PhaseTable::Fill_(std::size_t n_s, std::size_t n_u)
+{
+	n_s_ = n_s;
+	n_u_ = n_u;
+	h_s_ = (opts_.sigma_max - opts_.sigma_min) / static_cast<double>(n_s_ - 1);
+	h_u_ = opts_.u_max / static_cast<double>(n_u_ - 1);
+
+	for (auto &g : g_)
+		g.assign(n_s_ * n_u_, 0.0);
+
+	const std::ptrdiff_t n_rows = static_cast<std::ptrdiff_t>(n_s_);
+
+	// Each sigma row is an independent cumulative quadrature in u.
+#pragma omp parallel for schedule(static)
+	for (std::ptrdiff_t i = 0; i < n_rows; ++i)
+	{
+		const double sigma = opts_.sigma_min + static_cast<double>(i) * h_s_;
+		double G[kNumCoeffs] = {0.0, 0.0, 0.0, 0.0};
+
+		for (std::size_t j = 1; j < n_u_; ++j)
+		{
+			AddPanel(sigma, static_cast<double>(j - 1) * h_u_, static_cast<double>(j) * h_u_, G);
+			for (std::size_t k = 0; k < kNumCoeffs; ++k)
+				g_[k][static_cast<std::size_t>(i) * n_u_ + j] = G[k];
+		}
+	}
+
+	for (std::size_t k = 0; k < kNumCoeffs; ++k)
+	{
+		scale_[k] = 0.0;
+		for (double v : g_[k])
+			scale_[k] = std::max(scale_[k], std::abs(v));
+	}
+}
+
+//--------------------------------------------------------------
+std::array<double, BNV_Chi_Photon_PhaseTable::kNumCoeffs> BNV_Chi_Photon_PhaseTable::Check_() const
+{
+	// Cell centres on a stride (at most ~48 per axis), against direct quadrature.
+	const std::size_t stride_s = std::max<std::size_t>(1, (n_s_ - 1) / 48);
+	const std::size_t stride_u = std::max<std::size_t>(1, (n_u_ - 1) / 48);
+
+	std::array<double, kNumCoeffs> err{};
+
+	for (std::size_t i = 0; i + 1 < n_s_; i += stride_s)
+	{
+		const double sigma = opts_.sigma_min + (static_cast<double>(i) + 0.5) * h_s_;
+
+		double G[kNumCoeffs] = {0.0, 0.0, 0.0, 0.0};
+		double u_prev = 0.0;
+		for (std::size_t j = 0; j + 1 < n_u_; j += stride_u)
+		{
+			const double u = (static_cast<double>(j) + 0.5) * h_u_;
+
+			// Exact G_k(sigma, u) by continuing the cumulative quadrature.
+			AddPanel(sigma, u_prev, u, G);
+			u_prev = u;
+
+			double T[kNumCoeffs];
+			Interp_(sigma, u, T);
+			for (std::size_t k = 0; k < kNumCoeffs; ++k)
+			{
+				if (scale_[k] > 0.0)
+					err[k] = std::max(err[k], std::abs(T[k] - G[k]) / scale_[k]);
+			}
+		}
+	}
+	return err;
+}
+
+// -----------------------------------------------------------------------------
+//  Evaluation
+// -----------------------------------------------------------------------------
+void BNV_Chi_Photon_PhaseTable::Interp_(const double &sigma, const double &u,
+										double (&G)[kNumCoeffs]) const
+{
+	double ws[4], wu[4];
+	const std::size_t i0 = Stencil((sigma - opts_.sigma_min) / h_s_, n_s_, ws);
+	const std::size_t j0 = Stencil(u / h_u_, n_u_, wu);
+
+	for (std::size_t k = 0; k < kNumCoeffs; ++k)
+	{
+		const double *g = g_[k].data();
+		double sum = 0.0;
+		for (std::size_t a = 0; a < 4; ++a)
+		{
+			const double *row = g + (i0 + a) * n_u_ + j0;
+			sum += ws[a] * (wu[0] * row[0] + wu[1] * row[1] + wu[2] * row[2] + wu[3] * row[3]);
+		}
+		G[k] = sum;
+	}
+}
+
+//--------------------------------------------------------------
+bool BNV_Chi_Photon_PhaseTable::InDomain(const double &sigma_0, const double &x_F) const
+{
+	if (!(x_F >= 1.0) || !(sigma_0 >= opts_.sigma_min) || !(sigma_0 <= opts_.sigma_max))
+		return false;
+	return std::sqrt(x_F * x_F - 1.0) <= opts_.u_max;
+}
+
+//--------------------------------------------------------------
+bool BNV_Chi_Photon_PhaseTable::Evaluate(const double &mu_chi, const double &sigma_0,
+										 const double &x_F, double &out) const
+{
+	if (n_s_ < 4 || !InDomain(sigma_0, x_F) || !std::isfinite(mu_chi))
+		return false;
+
+	// The integrand vanishes for x <= x_th (same test as PhaseSpace_Integrand,
+	// including sigma = 0, where x_th is ±inf or NaN).
+	const double x_th = (mu_chi * mu_chi - 1 - sigma_0 * sigma_0) / (2 * sigma_0);
+	const double x_lo = (x_th >= 1.0) ? x_th : 1.0;
+	if (x_lo >= x_F)
+	{
+		out = 0.0;
+		return true;
+	}
+
+	double G_F[kNumCoeffs], G_lo[kNumCoeffs] = {0.0, 0.0, 0.0, 0.0};
+	Interp_(sigma_0, std::sqrt(x_F * x_F - 1.0), G_F);
+	if (x_lo > 1.0)
+		Interp_(sigma_0, std::sqrt(x_lo * x_lo - 1.0), G_lo);
+
+	double I = 0.0, err = 0.0;
+	for (std::size_t k = 0; k < kNumCoeffs; ++k)
+	{
+		const double mu_k = std::pow(mu_chi, kPower[k]);
+		I += mu_k * (G_F[k] - G_lo[k]);
+		err += 2.0 * std::abs(mu_k) * err_[k] * scale_[k];
+	}
+
+	if (!std::isfinite(I) || err > opts_.query_rtol * std::abs(I))
+		return false;
+
+	out = I;
+	return true;
+}
+
+//--------------------------------------------------------------
+double BNV_Chi_Photon_PhaseTable::MaxError() const
+{
+	return *std::max_element(err_.begin(), err_.end());
+}
+
+// -----------------------------------------------------------------------------
+//  Disk cache
+// -----------------------------------------------------------------------------
+void BNV_Chi_Photon_PhaseTable::Save(const std::string &path) const
+{
+	std::ofstream out(path, std::ios::out | std::ios::binary | std::ios::trunc);
+	if (!out)
+		throw std::runtime_error("BNV_Chi_Photon_PhaseTable::Save: cannot open '" + path + "'.");
+
+	const double dom[4] = {opts_.sigma_min, opts_.sigma_max, opts_.u_max, opts_.rtol};
+	const std::uint64_t n[2] = {n_s_, n_u_};
+
+	out.write(kMagic, sizeof(kMagic));
+	out.write(reinterpret_cast<const char *>(dom), sizeof(dom));
+	out.write(reinterpret_cast<const char *>(n), sizeof(n));
+	out.write(reinterpret_cast<const char *>(scale_.data()), sizeof(double) * kNumCoeffs);
+	out.write(reinterpret_cast<const char *>(err_.data()), sizeof(double) * kNumCoeffs);
+	for (const auto &g : g_)
+		out.write(reinterpret_cast<const char *>(g.data()), static_cast<std::streamsize>(g.size() * sizeof(double)));
+
+	if (!out)
+		throw std::runtime_error("BNV_Chi_Photon_PhaseTable::Save: write failed for '" + path + "'.");
+}
+
+//--------------------------------------------------------------
+std::shared_ptr<BNV_Chi_Photon_PhaseTable> BNV_Chi_Photon_PhaseTable::Read_(const std::string &path)
+{
+	std::ifstream in(path, std::ios::in | std::ios::binary);
+	if (!in)
+		throw std::runtime_error("BNV_Chi_Photon_PhaseTable::Load: cannot open '" + path + "'.");
+
+	char magic[sizeof(kMagic)] = {};
+	double dom[4] = {};
+	std::uint64_t n[2] = {};
+
+	in.read(magic, sizeof(magic));
+	in.read(reinterpret_cast<char *>(dom), sizeof(dom));
+	in.read(reinterpret_cast<char *>(n), sizeof(n));
+
+	if (!in || std::memcmp(magic, kMagic, sizeof(kMagic)) != 0 || n[0] < 4 || n[1] < 4)
+		throw std::runtime_error("BNV_Chi_Photon_PhaseTable::Load: '" + path + "' is not a phase-space table.");
+
+	Options opts;
+	opts.sigma_min = dom[0];
+	opts.sigma_max = dom[1];
+	opts.u_max = dom[2];
+	opts.rtol = dom[3];
+
+	std::shared_ptr<BNV_Chi_Photon_PhaseTable> t(new BNV_Chi_Photon_PhaseTable(opts, NoBuild{}));
+	t->n_s_ = static_cast<std::size_t>(n[0]);
+	t->n_u_ = static_cast<std::size_t>(n[1]);
+	t->h_s_ = (opts.sigma_max - opts.sigma_min) / static_cast<double>(t->n_s_ - 1);
+	t->h_u_ = opts.u_max / static_cast<double>(t->n_u_ - 1);
+
+	in.read(reinterpret_cast<char *>(t->scale_.data()), sizeof(double) * kNumCoeffs);
+	in.read(reinterpret_cast<char *>(t->err_.data()), sizeof(double) * kNumCoeffs);
+	for (auto &g : t->g_)
+	{
+		g.resize(t->n_s_ * t->n_u_);
+		in.read(reinterpret_cast<char *>(g.data()), static_cast<std::streamsize>(g.size() * sizeof(double)));
+	}
+
+	if (!in)
+		throw std::runtime_error("BNV_Chi_Photon_PhaseTable::Load: '" + path + "' is truncated.");
+
+	return t;
+}
+
+//--------------------------------------------------------------
+std::shared_ptr<const BNV_Chi_Photon_PhaseTable> BNV_Chi_Photon_PhaseTable::Load(const std::string &path)
+{
+	return Read_(path);
+}
+
+//--------------------------------------------------------------
+std::shared_ptr<const BNV_Chi_Photon_PhaseTable>
+BNV_Chi_Photon_PhaseTable::LoadOrBuild(const std::string &path, const Options &opts)
+{
+	if (std::ifstream(path, std::ios::in | std::ios::binary).good())
+	{
+		try
+		{
+			std::shared_ptr<BNV_Chi_Photon_PhaseTable> t = Read_(path);
+			const Options &o = t->opts_;
+			if (o.sigma_min == opts.sigma_min && o.sigma_max == opts.sigma_max &&
+				o.u_max == opts.u_max && o.rtol <= opts.rtol)
+			{
+				t->opts_.query_rtol = opts.query_rtol;
+				Z_LOG_INFO("BNV_Chi_Photon_PhaseTable: loaded '" + path + "'.");
+				return t;
+			}
+			Z_LOG_INFO("BNV_Chi_Photon_PhaseTable: '" + path + "' was built for another domain, rebuilding.");
+		}
+		catch (const std::exception &e)
+		{
+			Z_LOG_WARNING(std::string(e.what()) + " Rebuilding.");
+		}
+	}
+
+	auto t = std::make_shared<const BNV_Chi_Photon_PhaseTable>(opts);
+	try
+	{
+		t->Save(path);
+	}
+	catch (const std::exception &e)
+	{
+		Z_LOG_WARNING(e.what());
+	}
+	return t;
+}
+
+} // namespace CompactStar::Microphysics::BNV::Channels
@@ -45,9 +45,16 @@
 #ifndef CompactStar_Microphysics_BNV_Int_Chi_H
 #define CompactStar_Microphysics_BNV_Int_Chi_H
 
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+
 #include <Zaki/Vector/DataSet.hpp>
 
 #include "CompactStar/Core/Pulsar.hpp"
+#include "CompactStar/Microphysics/BNV/Internal/BNV_MicroCache.hpp"
 #include <CompactStar/EOS/CompOSE_EOS.hpp>
 
 //==============================================================
@@ -182,6 +189,21 @@ class BNV_Chi : public Core::Prog
 	/// [3]: m_n, [4]: m_lam, [5]: sig_n, [6]: sig_lam
 	Zaki::Vector::DataSet micro_r;
 
+	/// m*(n), Sigma_0(n), U(n) of 'B' for this EoS,
+	/// shared by all channels through BNV_MicroCache
+	std::shared_ptr<const BNV_MicroCache::Species> MicroSpecies(const Baryon &B) const;
+
+	/// r, n(r), n_B(r), m*(r) and Sigma_0(r) of 'B' on the pulsar
+	/// profile, evaluated once and shared through BNV_MicroCache
+	/// (nullptr if the pulsar has no profile)
+	std::shared_ptr<const BNV_MicroCache::Profile> MicroProfile(const Baryon &B) const;
+
+	/// BNV_MicroCache entries held per B.label, so repeated lookups skip
+	///  the cache's O(N) fingerprint; dropped by ClearRateCache()
+	mutable std::mutex micro_mtx;
+	mutable std::map<std::string, std::shared_ptr<const BNV_MicroCache::Species>> micro_species;
+	mutable std::map<std::string, std::shared_ptr<const BNV_MicroCache::Profile>> micro_profiles;
+
 	/// The EoS
 	CompactStar::CompOSE_EOS eos;
 
@@ -207,6 +229,21 @@ class BNV_Chi : public Core::Prog
 	/// The m_chi range
 	Zaki::Math::Axis m_chi_vals;
 
+	/// Per-baryon rates divided by eps^2 [yr^-1 MeV^-2], keyed by
+	///  (B.label, m_chi), for the current EoS and pulsar.
+	/// Rates scale as eps^2, so this is all a limit scan needs.
+	std::map<std::pair<std::string, double>, double> rate_cache;
+
+	/// Bumped by every ClearRateCache() (see RateCacheVersion)
+	std::uint64_t rate_cache_gen = 0;
+
+	/// RateCacheVersion() at which rate_cache was filled
+	std::uint64_t rate_cache_ver = 0;
+
+	/// Returns the limit on eps given the per-baryon rate [yr^-1]
+	///  evaluated at eps = default_eps
+	double EpsLim(const double &rate) const;
+
 	/// Plots the rate as a function of radius (ds) in units of s^-1/fm^3
 	void hidden_Plot_Rate_vs_R(const Baryon &B,
 							   const double &m_chi,
@@ -324,6 +361,53 @@ class BNV_Chi : public Core::Prog
 											const Baryon &B,
 											const bool &gen_plots = false) = 0;
 
+	//--------------------------------------------------------------
+	/// Rates on a grid of dark masses (see Rate_vs_R_Batch)
+	struct RateMatrix
+	{
+		/// Dark masses (rows)
+		std::vector<double> m_chi;
+
+		/// Radius in km (columns)
+		std::vector<double> r;
+
+		/// Rate in s^-1/fm^3: rate[i * r.size() + j] at (m_chi[i], r[j])
+		std::vector<double> rate;
+
+		/// Per-baryon rate integrated over the star (as in GetRate)
+		/// in yr^-1, one per mass; empty unless requested
+		std::vector<double> integrated;
+
+		/// Rate at (m_chi[i], r[j])
+		double operator()(const size_t &i, const size_t &j) const
+		{
+			return rate[i * r.size() + j];
+		}
+
+		/// Row of mass i (r.size() values)
+		const double *Row(const size_t &i) const
+		{
+			return rate.data() + i * r.size();
+		}
+	};
+
+	/// Returns the rate as a function of radius (s^-1/fm^3) for
+	///  every mass in 'm_chi', as a dense [mass x radius] matrix,
+	///  and optionally the per-baryon rate integrated over the star.
+	/// The default calls Rate_vs_R once per mass; channels with a
+	///  closed-form rate override it with a batched kernel.
+	virtual RateMatrix Rate_vs_R_Batch(const std::vector<double> &m_chi,
+									   const Baryon &B,
+									   const bool &integrate = false);
+
+	/// Weights w_j on the profile's radial grid such that
+	///  sum_j w_j Gamma(r_j) is the per-baryon rate of GetRate (yr^-1)
+	///  for Gamma in s^-1/fm^3 (empty if the profile is incomplete)
+	std::vector<double> RateVolumeWeights() const;
+
+	/// Fills RateMatrix::integrated from its rate rows
+	void IntegrateRateMatrix(RateMatrix &out) const;
+
 	// Plots rate
 	// as a function of radius in units of s^-1/fm^3
 	void Rate_vs_R(const double &m_chi);
@@ -355,6 +439,54 @@ class BNV_Chi : public Core::Prog
 	Rate_Eps GetRate_Eps(const double &m_chi,
 						 const Baryon &B);
 
+	//--------------------------------------------------------------
+	/// Per-baryon rates and limits on eps on a grid of dark masses
+	struct LimitCurve
+	{
+		/// Dark masses [MeV]
+		std::vector<double> m_chi;
+
+		/// Per-baryon rate (B_dot/B) at eps = eps_0 [yr^-1]
+		std::vector<double> rate;
+
+		/// Upper limit on eps [MeV]
+		std::vector<double> eps;
+
+		/// The coupling of 'rate' [MeV]
+		double eps_0 = 0;
+
+		/// Rate of mass i at coupling 'in_eps' (rate ∝ eps^2)
+		double RateAt(const size_t &i, const double &in_eps) const
+		{
+			return rate[i] * (in_eps / eps_0) * (in_eps / eps_0);
+		}
+	};
+
+	/// Returns the rates and limits on eps for every mass in
+	///  'm_chi' in one call. The eps-independent part (the
+	///  integrated rate per eps^2) is cached per (B, m_chi);
+	///  missing masses are evaluated together with
+	///  Rate_vs_R_Batch, in parallel where the channel allows it.
+	LimitCurve GetLimitCurve(const std::vector<double> &m_chi,
+							 const Baryon &B);
+
+	/// Same as above, over m_chi_vals
+	LimitCurve GetLimitCurve(const Baryon &B);
+
+	/// Drops the cached rates and microphysics entries
+	///  (done whenever the EoS or the pulsar changes)
+	void ClearRateCache();
+
+	/// Changes whenever the cached rates of this object may be
+	///  stale; GetLimitCurve drops rate_cache when it differs.
+	/// Objects built from other reactions (Combo) include theirs.
+	virtual std::uint64_t RateCacheVersion() const;
+
+	/// Whether Rate_vs_R can be called concurrently for
+	///  different masses on the same object; if so, the
+	///  default Rate_vs_R_Batch runs in parallel over masses
+	virtual bool ConcurrentRate() const;
+
 	/// Plots the total rate and the limit on eps
 	///  as a function of m_chi
 	void PlotRate_Eps(const Baryon &B);
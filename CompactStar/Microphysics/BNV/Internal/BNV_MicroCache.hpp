@@ -0,0 +1,189 @@
+// -*- lsst-c++ -*-
+/*
+ * CompactStar
+ * See License file at the top of the source tree.
+ *
+ * Copyright (c) 2025
+ * Mohammadreza Zakeri
+ *
+ * MIT License — see LICENSE at repo root.
+ */
+
+/**
+ * @file BNV_MicroCache.hpp
+ * @brief Shared cache of EOS microphysics interpolants for the BNV channels.
+ *
+ * Every Rate_vs_R call used to rebuild the splines m*(n), Sigma_0(n) from
+ * the EOS tables and re-evaluate them on the profile's density column,
+ * although neither depends on m_chi. BNV_MicroCache keeps
+ *
+ *  - per (EOS, species): m*(n), Sigma_0(n) and U(n), interpolated in the
+ *    total baryon density n (Species);
+ *  - per (EOS, species, profile): r, n(r), n_B(r), m*(r) and Sigma_0(r)
+ *    evaluated once on the profile's radial grid (Profile).
+ *
+ * Entries are keyed by a fingerprint of their input columns, so channels
+ * holding separate copies of the same EOS and profile (BNV_B_Chi_Combo and
+ * its reactions) share one entry, and a re-imported EOS or a new profile
+ * gets a new one. The interpolation (GSL linear, as in the Zaki DataSet
+ * splines it replaces) is unchanged.
+ *
+ * A lookup copies and fingerprints the input columns, which is O(N); callers
+ * hold on to the returned entries and look up again only after their EOS or
+ * profile changed (BNV_Chi does this per baryon, dropping its entries in
+ * ImportEOS / FindPulsar).
+ *
+ * The cache is process-wide (Instance()) and thread-safe. Species are
+ * immutable once built and evaluate without locking.
+ *
+ * @ingroup BNV
+ */
+
+#ifndef CompactStar_Microphysics_BNV_Int_MicroCache_H
+#define CompactStar_Microphysics_BNV_Int_MicroCache_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <gsl/gsl_spline.h>
+
+#include <Zaki/Vector/DataSet.hpp>
+
+#include "CompactStar/Core/StarProfile.hpp"
+#include <CompactStar/EOS/CompOSE_EOS.hpp>
+
+//==============================================================
+namespace CompactStar::Microphysics::BNV::Internal
+{
+
+//==============================================================
+//                     BNV_MicroCache Class
+//==============================================================
+/**
+ * @class BNV_MicroCache
+ * @brief Process-wide cache of m*(n), Sigma_0(n), U(n) and their radial profiles.
+ */
+class BNV_MicroCache
+{
+  public:
+	//--------------------------------------------------------------
+	/**
+	 * @class Species
+	 * @brief m*(n), Sigma_0(n) and U(n) of one species of one EOS.
+	 */
+	class Species
+	{
+	  public:
+		/**
+		 * @brief Interpolate the columns in @p n_tot.
+		 *
+		 * @p U may be empty (no single-particle potential in the EOS).
+		 * @throws std::runtime_error if m_eff or Sigma_0 do not match n_tot.
+		 */
+		Species(const Zaki::Vector::DataColumn &n_tot,
+				const Zaki::Vector::DataColumn &m_eff,
+				const Zaki::Vector::DataColumn &sigma_0,
+				const Zaki::Vector::DataColumn &U);
+
+		/// Effective mass m*(n) in MeV
+		double Meff(const double &n) const;
+		Zaki::Vector::DataColumn Meff(const Zaki::Vector::DataColumn &n) const;
+
+		/// Vector self-energy Sigma_0(n) in MeV
+		double Sigma0(const double &n) const;
+		Zaki::Vector::DataColumn Sigma0(const Zaki::Vector::DataColumn &n) const;
+
+		/// Single-particle potential U(n) in MeV (zero if the EOS has none)
+		double U(const double &n) const;
+		Zaki::Vector::DataColumn U(const Zaki::Vector::DataColumn &n) const;
+
+		/// Whether the EOS provided U(n)
+		bool HasU() const { return has_U_; }
+
+	  private:
+		/// Columns of the interpolants.
+		enum Col : std::size_t
+		{
+			kMeff = 0,
+			kSigma0,
+			kU,
+			kNumCols
+		};
+
+		double Eval_(const Col &col, const double &n) const;
+		Zaki::Vector::DataColumn Eval_(const Col &col, const Zaki::Vector::DataColumn &n) const;
+
+		/// Frees a GSL spline.
+		struct SplineFree
+		{
+			void operator()(gsl_spline *s) const { gsl_spline_free(s); }
+		};
+
+		/// Linear interpolants in n_tot (kU only if has_U_). Evaluated without
+		/// an accelerator, so concurrent lookups share no mutable state.
+		std::unique_ptr<gsl_spline, SplineFree> splines_[kNumCols];
+		std::string labels_[kNumCols];
+		bool has_U_ = false;
+	};
+
+	//--------------------------------------------------------------
+	/**
+	 * @struct Profile
+	 * @brief One species' microphysics on the radial grid of one profile.
+	 */
+	struct Profile
+	{
+		Zaki::Vector::DataColumn r;		  ///< radius [km]
+		Zaki::Vector::DataColumn n_tot;	  ///< total baryon density [fm^-3]
+		Zaki::Vector::DataColumn n_B;	  ///< species density [fm^-3] (empty if no fraction column)
+		Zaki::Vector::DataColumn m_eff;	  ///< m*(r) [MeV]
+		Zaki::Vector::DataColumn sigma_0; ///< Sigma_0(r) [MeV]
+	};
+
+	//--------------------------------------------------------------
+	/// The process-wide cache.
+	static BNV_MicroCache &Instance();
+
+	/**
+	 * @brief Interpolants of species @p label of @p eos (built on first use).
+	 * @throws std::runtime_error if the EOS has no m_eff / V_eff for @p label.
+	 */
+	std::shared_ptr<const Species> GetSpecies(const CompOSE_EOS &eos,
+											  const std::string &label);
+
+	/**
+	 * @brief Species @p label of @p eos on the radial grid of @p prof.
+	 * @return nullptr if the profile has no radius or baryon density column.
+	 */
+	std::shared_ptr<const Profile> GetProfile(const CompOSE_EOS &eos,
+											  const Core::StarProfile &prof,
+											  const std::string &label);
+
+	/// Drop every entry (entries still held by callers stay valid).
+	void Clear();
+
+	std::size_t NumSpecies() const;
+	std::size_t NumProfiles() const;
+
+  private:
+	BNV_MicroCache() = default;
+	BNV_MicroCache(const BNV_MicroCache &) = delete;
+	BNV_MicroCache &operator=(const BNV_MicroCache &) = delete;
+
+	/// Species entry with its fingerprint.
+	std::shared_ptr<const Species> GetSpecies_(const CompOSE_EOS &eos,
+											   const std::string &label,
+											   std::uint64_t &key);
+
+	mutable std::mutex mtx_;
+	std::unordered_map<std::uint64_t, std::shared_ptr<const Species>> species_;
+	std::unordered_map<std::uint64_t, std::shared_ptr<const Profile>> profiles_;
+};
+
+} // namespace CompactStar::Microphysics::BNV::Internal
+
+#endif /* CompactStar_Microphysics_BNV_Int_MicroCache_H */
@@ -6,6 +6,9 @@
 // #include <sys/stat.h>
 // #include <filesystem>
 
+#include <exception>
+#include <limits>
+
 #include <gsl/gsl_integration.h>
 
 #include <Zaki/Math/GSLFuncWrapper.hpp>
@@ -104,6 +107,8 @@ double MicroBNVInt::BNV_Chi::Vacuum_Decay_Br(const Baryon &B,
 void MicroBNVInt::BNV_Chi::SetModel(const std::string &in_eos_model)
 {
 	model = in_eos_model;
+
+	ClearRateCache();
 }
 
 //--------------------------------------------------------------
@@ -113,6 +118,8 @@ void MicroBNVInt::BNV_Chi::SetPulsar(const CompactStar::Core::Pulsar &in_pulsar)
 	pulsar = in_pulsar;
 
 	BNV_Chi_pulsar_mass = pulsar.GetMass().val;
+
+	ClearRateCache();
 }
 
 //--------------------------------------------------------------
@@ -177,6 +184,8 @@ void MicroBNVInt::BNV_Chi::ImportEOS(const Zaki::String::Directory &eos_dir,
 	n_B[0].label = "n_tot";
 	n_B[1].label = "10";
 	n_B[2].label = "100";
+
+	ClearRateCache();
 }
 
 //--------------------------------------------------------------
@@ -272,6 +281,8 @@ void MicroBNVInt::BNV_Chi::FindPulsar(const bool &gen_plots)
 		pulsar.FindProfile(model);
 	}
 
+	ClearRateCache();
+
 	if (gen_plots) // It doesn't work when we have no hyperons!
 	{
 		Z_LOG_WARNING("Plot generation is currently disabled inside MicroBNVInt::BNV_Chi::FindPulsar");
@@ -365,6 +376,34 @@ void MicroBNVInt::BNV_Chi::FindPulsar(const bool &gen_plots)
 	// }
 }
 
+//--------------------------------------------------------------
+std::shared_ptr<const MicroBNVInt::BNV_MicroCache::Species>
+MicroBNVInt::BNV_Chi::MicroSpecies(const Baryon &B) const
+{
+	std::lock_guard<std::mutex> lock(micro_mtx);
+
+	auto &sp = micro_species[B.label];
+	if (!sp)
+		sp = BNV_MicroCache::Instance().GetSpecies(eos, B.label);
+	return sp;
+}
+
+//--------------------------------------------------------------
+std::shared_ptr<const MicroBNVInt::BNV_MicroCache::Profile>
+MicroBNVInt::BNV_Chi::MicroProfile(const Baryon &B) const
+{
+	const Core::StarProfile *prof = pulsar.GetProfile();
+	if (!prof || prof->empty())
+		return nullptr;
+
+	std::lock_guard<std::mutex> lock(micro_mtx);
+
+	auto &mp = micro_profiles[B.label];
+	if (!mp)
+		mp = BNV_MicroCache::Instance().GetProfile(eos, *prof, B.label);
+	return mp;
+}
+
 //--------------------------------------------------------------
 double MicroBNVInt::BNV_Chi::PhaseSpace_Integrand(const double &x)
 {
@@ -1202,10 +1241,12 @@ void MicroBNVInt::BNV_Chi::PlotVacuumBrLim(const Baryon &B)
 	Zaki::Vector::DataSet dec_lim_ds;
 	dec_lim_ds.Reserve(2, m_chi_vals.res);
 
-	for (size_t i = 0; i < m_chi_vals.res; i++)
+	const LimitCurve curve = GetLimitCurve(B);
+
+	for (size_t i = 0; i < curve.m_chi.size(); i++)
 	{
-		double m_chi = m_chi_vals[i];
-		double eps_lim = GetEpsLim(m_chi, B);
+		double m_chi = curve.m_chi[i];
+		double eps_lim = curve.eps[i];
 		dec_lim_ds.AppendRow({m_chi, Vacuum_Decay_Br(B, m_chi, eps_lim)});
 	}
 
@@ -1277,11 +1318,13 @@ void MicroBNVInt::BNV_Chi::PlotRate_Eps(const Baryon &B)
 	Zaki::Vector::DataSet rate;
 	rate.Reserve(3, m_chi_vals.res);
 
-	for (size_t i = 0; i < m_chi_vals.res; i++)
+	const LimitCurve curve = GetLimitCurve(B);
+
+	for (size_t i = 0; i < curve.m_chi.size(); i++)
 	{
-		double m_chi = m_chi_vals[i];
+		double m_chi = curve.m_chi[i];
 
-		Rate_Eps rate_eps = GetRate_Eps(m_chi, B);
+		Rate_Eps rate_eps = {curve.rate[i], curve.eps[i]};
 		rate.AppendRow({m_chi, rate_eps.rate, rate_eps.eps});
 
 		if (i % 20 == 0)
@@ -1352,12 +1395,15 @@ void MicroBNVInt::BNV_Chi::PlotRate_Eps()
 	Zaki::Vector::DataSet rate;
 	rate.Reserve(5, m_chi_vals.res);
 
-	for (size_t i = 0; i < m_chi_vals.res; i++)
+	const LimitCurve curve_n = GetLimitCurve(neutron);
+	const LimitCurve curve_lam = GetLimitCurve(lambda);
+
+	for (size_t i = 0; i < curve_n.m_chi.size(); i++)
 	{
-		double m_chi = m_chi_vals[i];
+		double m_chi = curve_n.m_chi[i];
 
-		Rate_Eps rate_eps_n = GetRate_Eps(m_chi, neutron);
-		Rate_Eps rate_eps_lam = GetRate_Eps(m_chi, lambda);
+		Rate_Eps rate_eps_n = {curve_n.rate[i], curve_n.eps[i]};
+		Rate_Eps rate_eps_lam = {curve_lam.rate[i], curve_lam.eps[i]};
 		rate.AppendRow({m_chi, rate_eps_n.rate,
 						rate_eps_lam.rate, rate_eps_n.eps, rate_eps_lam.eps});
 
@@ -2069,6 +2115,235 @@ double MicroBNVInt::BNV_Chi::GetRate(const double &m_chi,
 	return per_baryon_rate_yrinv;
 }
 
+//--------------------------------------------------------------
+// Same integral as GetRate, written as trapezoid weights (the
+// linear interpolant integrated by GetRate) so that a batch of
+// rate profiles costs one dot product per mass.
+std::vector<double> MicroBNVInt::BNV_Chi::RateVolumeWeights() const
+{
+	const Core::StarProfile *prof = pulsar.GetProfile();
+	if (!prof || prof->empty())
+		return {};
+
+	const auto *r_col = prof->GetColumnPtr(Core::StarProfile::Column::Radius);
+	const auto *m_col = prof->GetColumnPtr(Core::StarProfile::Column::Mass);
+	const auto *nu_col = prof->GetColumnPtr(Core::StarProfile::Column::MetricNu);
+
+	const double Btot = pulsar.GetSeqPoint().b;
+
+	if (!r_col || !m_col || !nu_col || r_col->Size() < 2 || Btot <= 0.0)
+		return {};
+
+	const size_t n = r_col->Size();
+	const std::vector<double> &r = r_col->vals;
+
+	// fm^-3 -> km^-3, s^-1 -> yr^-1, per baryon
+	const double unit = 1e54 * (3600.0 * 24.0 * 365.0) / Btot;
+
+	std::vector<double> w = Core::TrapezoidWeights(r);
+	for (size_t j = 0; j < n; j++)
+	{
+		const double M_km = m_col->vals[j] * Zaki::Physics::SUN_M_KM;
+		double f = 4.0 * M_PI * r[j] * r[j];
+		f /= sqrt(1.0 - 2.0 * M_km / r[j]);
+		f *= exp(nu_col->vals[j]);
+
+		w[j] *= f * unit;
+	}
+
+	return w;
+}
+
+//--------------------------------------------------------------
+void MicroBNVInt::BNV_Chi::IntegrateRateMatrix(RateMatrix &out) const
+{
+	const std::vector<double> w = RateVolumeWeights();
+	const size_t n_r = out.r.size();
+
+	if (w.size() != n_r)
+	{
+		Z_LOG_WARNING("BNV_Chi::IntegrateRateMatrix: rate grid does not match the pulsar profile;"
+					  " integrated rates are not available.");
+		out.integrated.clear();
+		return;
+	}
+
+	out.integrated.assign(out.m_chi.size(), 0.0);
+	for (size_t i = 0; i < out.m_chi.size(); i++)
+	{
+		const double *row = out.Row(i);
+		double sum = 0.0;
+		for (size_t j = 0; j < n_r; j++)
+			sum += w[j] * row[j];
+		out.integrated[i] = sum;
+	}
+}
+
+//--------------------------------------------------------------
+MicroBNVInt::BNV_Chi::RateMatrix MicroBNVInt::BNV_Chi::Rate_vs_R_Batch(
+	const std::vector<double> &m_chi,
+	const Baryon &B,
+	const bool &integrate)
+{
+	RateMatrix out;
+	out.m_chi = m_chi;
+
+	const size_t n_m = m_chi.size();
+	std::vector<Zaki::Vector::DataSet> rows(n_m);
+
+	if (ConcurrentRate())
+	{
+		std::exception_ptr error;
+
+#pragma omp parallel for schedule(dynamic)
+		for (size_t i = 0; i < n_m; i++)
+		{
+			try
+			{
+				rows[i] = Rate_vs_R(m_chi[i], B);
+			}
+			catch (...)
+			{
+#pragma omp critical(BNV_Chi_Rate_vs_R_Batch)
+				if (!error)
+					error = std::current_exception();
+			}
+		}
+
+		if (error)
+			std::rethrow_exception(error);
+	}
+	else
+	{
+		for (size_t i = 0; i < n_m; i++)
+			rows[i] = Rate_vs_R(m_chi[i], B);
+	}
+
+	for (size_t i = 0; i < n_m; i++)
+	{
+		if (rows[i].data_set.size() < 2)
+			throw std::runtime_error("BNV_Chi::Rate_vs_R_Batch: Rate_vs_R returned no rate column.");
+
+		if (i == 0)
+		{
+			out.r = rows[i][0].vals;
+			out.rate.assign(n_m * out.r.size(), 0.0);
+		}
+		else if (rows[i][1].Size() != out.r.size())
+		{
+			throw std::runtime_error("BNV_Chi::Rate_vs_R_Batch: radial grid changed between masses.");
+		}
+
+		std::copy(rows[i][1].vals.begin(), rows[i][1].vals.end(), out.rate.begin() + i * out.r.size());
+	}
+
+	if (integrate)
+		IntegrateRateMatrix(out);
+
+	return out;
+}
+
+//--------------------------------------------------------------
+bool MicroBNVInt::BNV_Chi::ConcurrentRate() const
+{
+	return false;
+}
+
+//--------------------------------------------------------------
+void MicroBNVInt::BNV_Chi::ClearRateCache()
+{
+	rate_cache.clear();
+	rate_cache_gen++;
+
+	std::lock_guard<std::mutex> lock(micro_mtx);
+	micro_species.clear();
+	micro_profiles.clear();
+}
+
+//--------------------------------------------------------------
+std::uint64_t MicroBNVInt::BNV_Chi::RateCacheVersion() const
+{
+	return rate_cache_gen;
+}
+
+//--------------------------------------------------------------
+// eps_lim = eps_0 sqrt(Gamma_lim / Gamma(eps_0)), since Gamma ∝ eps^2
+double MicroBNVInt::BNV_Chi::EpsLim(const double &rate) const
+{
+	if (rate <= 0.0)
+		return std::numeric_limits<double>::max();
+
+	return default_eps * std::sqrt(gamma_bnv_bin_lim / rate);
+}
+
+//--------------------------------------------------------------
+MicroBNVInt::BNV_Chi::LimitCurve MicroBNVInt::BNV_Chi::GetLimitCurve(
+	const std::vector<double> &m_chi,
+	const Baryon &B)
+{
+	PROFILE_FUNCTION();
+
+	const double eps_0_2 = default_eps * default_eps;
+
+	// Entries computed before a reconfiguration (here or, for a
+	//  Combo, in one of its reactions) are stale
+	const std::uint64_t ver = RateCacheVersion();
+	if (ver != rate_cache_ver)
+	{
+		rate_cache.clear();
+		rate_cache_ver = ver;
+	}
+
+	// 1) eps-independent stage: rates of the masses not cached yet
+	std::vector<double> missing;
+	for (const double &m : m_chi)
+	{
+		if (rate_cache.find({B.label, m}) == rate_cache.end())
+			missing.emplace_back(m);
+	}
+
+	if (!missing.empty() && RateVolumeWeights().empty())
+	{
+		Z_LOG_ERROR("BNV_Chi::GetLimitCurve: the pulsar profile is missing or incomplete; no limits are set.");
+	}
+	else if (!missing.empty())
+	{
+		RateMatrix mat = Rate_vs_R_Batch(missing, B, true);
+
+		for (size_t k = 0; k < mat.integrated.size(); k++)
+			rate_cache[{B.label, missing[k]}] = mat.integrated[k] / eps_0_2;
+	}
+
+	// 2) eps-scaling stage
+	LimitCurve out;
+	out.m_chi = m_chi;
+	out.eps_0 = default_eps;
+	out.rate.assign(m_chi.size(), 0.0);
+	out.eps.assign(m_chi.size(), std::numeric_limits<double>::max());
+
+	for (size_t i = 0; i < m_chi.size(); i++)
+	{
+		auto it = rate_cache.find({B.label, m_chi[i]});
+		if (it == rate_cache.end())
+			continue;
+
+		out.rate[i] = it->second * eps_0_2;
+		out.eps[i] = EpsLim(out.rate[i]);
+	}
+
+	return out;
+}
+
+//--------------------------------------------------------------
+MicroBNVInt::BNV_Chi::LimitCurve MicroBNVInt::BNV_Chi::GetLimitCurve(const Baryon &B)
+{
+	std::vector<double> m_chi(m_chi_vals.res);
+	for (size_t i = 0; i < m_chi_vals.res; i++)
+		m_chi[i] = m_chi_vals[i];
+
+	return GetLimitCurve(m_chi, B);
+}
+
 //--------------------------------------------------------------
 // // This function returns the limit on eps from
 // //  B -> chi decay rate integrated over the radius
@@ -2135,83 +2410,15 @@ double MicroBNVInt::BNV_Chi::GetRate(const double &m_chi,
 double MicroBNVInt::BNV_Chi::GetEpsLim(const double &m_chi,
 									   const Baryon &B)
 {
-	// 0) get the structural profile
-	const Core::StarProfile *prof = pulsar.GetProfile();
-	if (!prof || prof->empty())
-	{
-		// no structure → no constraint
-		return std::numeric_limits<double>::max();
-	}
-
-	// 1) pull core columns as pointers
-	const auto *r_col = prof->GetColumnPtr(Core::StarProfile::Column::Radius);
-	const auto *m_col = prof->GetColumnPtr(Core::StarProfile::Column::Mass);
-	const auto *nu_col = prof->GetColumnPtr(Core::StarProfile::Column::MetricNu);
-
-	if (!r_col || !m_col || !nu_col)
-	{
-		Z_LOG_ERROR("MicroBNVInt::BNV_Chi::GetEpsLim: missing r/M/nu columns in profile.");
-		return std::numeric_limits<double>::max();
-	}
-
-	// make working copies
-	Zaki::Vector::DataColumn r = *r_col;	 // [km]
-	Zaki::Vector::DataColumn M_r = *m_col;	 // [M_sun]
-	Zaki::Vector::DataColumn nu_r = *nu_col; // dimensionless
-
-	// convert M(r) -> km so 1 - 2M/r is consistent
-	M_r *= Zaki::Physics::SUN_M_KM; // now M_r is in [km]
-
-	// 2) local rate vs r from the channel
-	//    Rate_vs_R is expected to return {r, Γ(r)}
-	Zaki::Vector::DataSet rate_ds = Rate_vs_R(m_chi, B);
-	Zaki::Vector::DataColumn dc_rate_r = rate_ds[1];
-
-	// 3) unit jump: fm⁻³ → km⁻³
-	dc_rate_r *= 1e54;
-
-	// 4) GR volume + redshift: 4π r² / sqrt(1 - 2M/r) × e^{ν}
-	Zaki::Vector::DataColumn decay_integrand_dc = 4.0 * M_PI * r.pow(2);
-	decay_integrand_dc *= dc_rate_r;
-	decay_integrand_dc /= (1.0 - 2.0 * M_r / r).sqrt();
-	decay_integrand_dc *= exp(nu_r);
-
-	// 5) integrate over radius
-	Zaki::Vector::DataSet decay_integral_ds({r, decay_integrand_dc});
-	decay_integral_ds.Interpolate(0, 1);
-
-	const double r_min = r[0];
-	const double r_max = r[-1];
-
-	double total_rate_sinv = decay_integral_ds.Integrate(1, {r_min, r_max}); // [s⁻¹]
-
-	// 6) s⁻¹ → yr⁻¹
-	total_rate_sinv *= 3600.0 * 24.0 * 365.0;
-
-	// 7) per-baryon rate = (1/B_tot) dB/dt
-	const Core::SeqPoint sp = pulsar.GetSeqPoint();
-	const double Btot = sp.b;
-	if (Btot <= 0.0)
-	{
-		Z_LOG_ERROR("MicroBNVInt::BNV_Chi::GetEpsLim: seq point has zero/negative baryon number.");
-		return std::numeric_limits<double>::max();
-	}
-
-	const double rate_per_baryon_yrinv = total_rate_sinv / Btot;
+	// Cached per (B, m_chi); see GetLimitCurve
+	const LimitCurve curve = GetLimitCurve({m_chi}, B);
 
 	std::cout << "\n ---------------------------------------- ";
 	std::cout << "\n\t Full decay rate (B_dot/B) : "
-			  << rate_per_baryon_yrinv << " per year.\n";
+			  << curve.rate[0] << " per year.\n";
 
-	// 8) ε-limit
 	// model: Γ_model(ε) = Γ_model(ε₀) (ε/ε₀)²  ⇒ ε_lim = ε₀ √(Γ_sd / Γ_model)
-	if (rate_per_baryon_yrinv <= 0.0)
-	{
-		return std::numeric_limits<double>::max();
-	}
-
-	const double eps_lim = default_eps * std::sqrt(gamma_bnv_bin_lim / rate_per_baryon_yrinv);
-	return eps_lim;
+	return curve.eps[0];
 }
 
 // //--------------------------------------------------------------
@@ -2292,78 +2499,10 @@ MicroBNVInt::BNV_Chi::Rate_Eps MicroBNVInt::BNV_Chi::GetRate_Eps(
 	const double &m_chi,
 	const Baryon &B)
 {
-	// 0) get the structural profile
-	const Core::StarProfile *prof = pulsar.GetProfile();
-	if (!prof || prof->empty())
-	{
-		// no profile → no rate
-		return {0.0, std::numeric_limits<double>::max()};
-	}
-
-	// 1) pull columns by pointer
-	const auto *r_col = prof->GetColumnPtr(Core::StarProfile::Column::Radius);
-	const auto *m_col = prof->GetColumnPtr(Core::StarProfile::Column::Mass);
-	const auto *nu_col = prof->GetColumnPtr(Core::StarProfile::Column::MetricNu);
-
-	if (!r_col || !m_col || !nu_col)
-	{
-		Z_LOG_ERROR("MicroBNVInt::BNV_Chi::GetRate_Eps: missing core columns (r/M/nu) in profile.");
-		return {0.0, std::numeric_limits<double>::max()};
-	}
-
-	// make working copies to do arithmetic
-	Zaki::Vector::DataColumn r = *r_col;	 // [km]
-	Zaki::Vector::DataColumn M_r = *m_col;	 // [M_sun]
-	Zaki::Vector::DataColumn nu_r = *nu_col; // dimensionless
-
-	// convert M(r) → km-mass so that (1 - 2M/r) makes sense
-	M_r *= Zaki::Physics::SUN_M_KM; // now M_r is in [km]
-
-	// 2) local decay rate as a function of r
-	// Rate_vs_R(...) is assumed to return {r, Γ(r)} with Γ(r) in [1/fm³ · s⁻¹] or similar
-	Zaki::Vector::DataSet rate_ds = Rate_vs_R(m_chi, B);
-	Zaki::Vector::DataColumn dc_rate_r = rate_ds[1]; // local rate density vs r
-
-	// 3) unit fix: fm⁻³ → km⁻³
-	// 1 km = 1e18 fm → 1 km³ = 1e54 fm³ → fm⁻³ to km⁻³ = 1e54
-	dc_rate_r *= 1e54;
-
-	// 4) build GR volume element: 4π r² / sqrt(1 - 2M/r) × e^{ν(r)}
-	Zaki::Vector::DataColumn decay_integrand_dc = 4.0 * M_PI * r.pow(2);
-	decay_integrand_dc *= dc_rate_r;
-	decay_integrand_dc /= (1.0 - 2.0 * M_r / r).sqrt();
-	decay_integrand_dc *= exp(nu_r);
-
-	// pack in a dataset for interpolation/integration
-	Zaki::Vector::DataSet decay_integral_ds({r, decay_integrand_dc});
-	decay_integral_ds.Interpolate(0, 1);
-
-	// 5) integrate over radius
-	const double r_min = r[0];
-	const double r_max = r[-1];
-	double result_sinv = decay_integral_ds.Integrate(1, {r_min, r_max}); // [s⁻¹]
-
-	// 6) s⁻¹ → yr⁻¹
-	result_sinv *= 3600.0 * 24.0 * 365.0;
-
-	// 7) per-baryon rate: divide by total baryon number on this seq point
-	const Core::SeqPoint sp = pulsar.GetSeqPoint();
-	const double Btot = sp.b;										// total baryon number for this model
-	double output_rate = (Btot > 0.0) ? (result_sinv / Btot) : 0.0; // [yr⁻¹]
-
-	// 8) turn that into an ε limit
-	// Γ_model(ε) ∝ ε² → ε_lim = ε₀ √(Γ_sd / Γ_model)
-	double output_eps = 0.0;
-	if (output_rate <= 0.0)
-	{
-		output_eps = std::numeric_limits<double>::max();
-	}
-	else
-	{
-		output_eps = default_eps * std::sqrt(gamma_bnv_bin_lim / output_rate);
-	}
+	// Cached per (B, m_chi); see GetLimitCurve
+	const LimitCurve curve = GetLimitCurve({m_chi}, B);
 
-	return {output_rate, output_eps};
+	return {curve.rate[0], curve.eps[0]};
 }
 
 //--------------------------------------------------------------
@@ -0,0 +1,261 @@
+// -*- lsst-c++ -*-
+/*
+ * CompactStar
+ * See License file at the top of the source tree.
+ *
+ * Copyright (c) 2025
+ * Mohammadreza Zakeri
+ *
+ * MIT License — see LICENSE at repo root.
+ */
+
+/**
+ * @file BNV_MicroCache.cpp
+ * @brief Fingerprint-keyed cache of the BNV microphysics interpolants.
+ */
+
+#include "CompactStar/Microphysics/BNV/Internal/BNV_MicroCache.hpp"
+
+#include <cstring>
+#include <stdexcept>
+
+#include <Zaki/Util/Instrumentor.hpp>
+
+//==============================================================
+namespace CompactStar::Microphysics::BNV::Internal
+{
+
+namespace
+{
+/// FNV-1a accumulator over raw bytes.
+struct Fingerprint
+{
+	std::uint64_t h = 1469598103934665603ULL;
+
+	void Add(const void *data, std::size_t n)
+	{
+		const auto *p = static_cast<const unsigned char *>(data);
+		for (std::size_t i = 0; i < n; ++i)
+		{
+			h ^= p[i];
+			h *= 1099511628211ULL;
+		}
+	}
+
+	void Add(const std::string &s)
+	{
+		const std::uint64_t n = s.size();
+		Add(&n, sizeof(n));
+		Add(s.data(), s.size());
+	}
+
+	void Add(const std::vector<double> &v)
+	{
+		const std::uint64_t n = v.size();
+		Add(&n, sizeof(n));
+		Add(v.data(), v.size() * sizeof(double));
+	}
+
+	void Add(const std::uint64_t &v) { Add(&v, sizeof(v)); }
+};
+
+/// Column @p label of @p ds, or nullptr.
+const Zaki::Vector::DataColumn *FindColumn(const Zaki::Vector::DataSet &ds,
+										   const std::string &label)
+{
+	for (const auto &c : ds.data_set)
+		if (c.label == label)
+			return &c;
+	return nullptr;
+}
+} // namespace
+
+//==============================================================
+//                        Species
+//==============================================================
+BNV_MicroCache::Species::Species(const Zaki::Vector::DataColumn &n_tot,
+								 const Zaki::Vector::DataColumn &m_eff,
+								 const Zaki::Vector::DataColumn &sigma_0,
+								 const Zaki::Vector::DataColumn &U)
+{
+	const std::size_t n = n_tot.Size();
+	if (n < 2 || m_eff.Size() != n || sigma_0.Size() != n)
+		throw std::runtime_error("BNV_MicroCache::Species: m_eff / V_eff do not match the EOS density grid.");
+
+	has_U_ = (U.Size() == n);
+
+	const Zaki::Vector::DataColumn *cols[kNumCols] = {&m_eff, &sigma_0, has_U_ ? &U : nullptr};
+	for (std::size_t c = 0; c < kNumCols; ++c)
+	{
+		if (!cols[c])
+			continue;
+		splines_[c].reset(gsl_spline_alloc(gsl_interp_linear, n));
+		gsl_spline_init(splines_[c].get(), n_tot.vals.data(), cols[c]->vals.data(), n);
+		labels_[c] = cols[c]->label;
+	}
+}
+
+//--------------------------------------------------------------
+double BNV_MicroCache::Species::Eval_(const Col &col, const double &n) const
+{
+	return gsl_spline_eval(splines_[col].get(), n, nullptr);
+}
+
+//--------------------------------------------------------------
+Zaki::Vector::DataColumn BNV_MicroCache::Species::Eval_(const Col &col,
+														const Zaki::Vector::DataColumn &n) const
+{
+	std::vector<double> out(n.Size());
+	for (std::size_t i = 0; i < out.size(); ++i)
+		out[i] = gsl_spline_eval(splines_[col].get(), n.vals[i], nullptr);
+	return Zaki::Vector::DataColumn(labels_[col], out);
+}
+
+//--------------------------------------------------------------
+double BNV_MicroCache::Species::Meff(const double &n) const { return Eval_(kMeff, n); }
+double BNV_MicroCache::Species::Sigma0(const double &n) const { return Eval_(kSigma0, n); }
+double BNV_MicroCache::Species::U(const double &n) const { return has_U_ ? Eval_(kU, n) : 0.0; }
+
+//--------------------------------------------------------------
+Zaki::Vector::DataColumn BNV_MicroCache::Species::Meff(const Zaki::Vector::DataColumn &n) const
+{
+	return Eval_(kMeff, n);
+}
+
+//--------------------------------------------------------------
+Zaki::Vector::DataColumn BNV_MicroCache::Species::Sigma0(const Zaki::Vector::DataColumn &n) const
+{
+	return Eval_(kSigma0, n);
+}
+
+//--------------------------------------------------------------
+Zaki::Vector::DataColumn BNV_MicroCache::Species::U(const Zaki::Vector::DataColumn &n) const
+{
+	if (has_U_)
+		return Eval_(kU, n);
+	return Zaki::Vector::DataColumn("U", std::vector<double>(n.Size(), 0.0));
+}
+
+//==============================================================
+//                      BNV_MicroCache
+//==============================================================
+BNV_MicroCache &BNV_MicroCache::Instance()
+{
+	static BNV_MicroCache cache;
+	return cache;
+}
+
+//--------------------------------------------------------------
+std::shared_ptr<const BNV_MicroCache::Species>
+BNV_MicroCache::GetSpecies_(const CompOSE_EOS &eos, const std::string &label, std::uint64_t &key)
+{
+	const Zaki::Vector::DataColumn n_tot = eos.GetEOS(2);
+	const Zaki::Vector::DataSet m_eff = eos.GetMeff();
+	const Zaki::Vector::DataSet v_eff = eos.GetVeff();
+	const Zaki::Vector::DataSet u_all = eos.GetU();
+
+	const Zaki::Vector::DataColumn *m_col = FindColumn(m_eff, label);
+	const Zaki::Vector::DataColumn *v_col = FindColumn(v_eff, label);
+	const Zaki::Vector::DataColumn *u_col = FindColumn(u_all, label);
+
+	if (!m_col || !v_col)
+		throw std::runtime_error("BNV_MicroCache::GetSpecies: the EOS has no m_eff / V_eff for '" + label + "'.");
+
+	Fingerprint fp;
+	fp.Add(label);
+	fp.Add(n_tot.vals);
+	fp.Add(m_col->vals);
+	fp.Add(v_col->vals);
+	fp.Add(u_col ? u_col->vals : std::vector<double>{});
+	key = fp.h;
+
+	{
+		std::lock_guard<std::mutex> lock(mtx_);
+		auto it = species_.find(key);
+		if (it != species_.end())
+			return it->second;
+	}
+
+	// Built outside the lock; a concurrent duplicate build is harmless.
+	auto sp = std::make_shared<const Species>(n_tot, *m_col, *v_col,
+											  u_col ? *u_col : Zaki::Vector::DataColumn{});
+
+	std::lock_guard<std::mutex> lock(mtx_);
+	return species_.emplace(key, std::move(sp)).first->second;
+}
+
+//--------------------------------------------------------------
+std::shared_ptr<const BNV_MicroCache::Species>
+BNV_MicroCache::GetSpecies(const CompOSE_EOS &eos, const std::string &label)
+{
+	std::uint64_t key = 0;
+	return GetSpecies_(eos, label, key);
+}
+
+//--------------------------------------------------------------
+std::shared_ptr<const BNV_MicroCache::Profile>
+BNV_MicroCache::GetProfile(const CompOSE_EOS &eos,
+						   const Core::StarProfile &prof,
+						   const std::string &label)
+{
+	const Zaki::Vector::DataColumn *r_col = prof.GetRadius();
+	const Zaki::Vector::DataColumn *n_col = prof.GetBaryonDensity();
+	const Zaki::Vector::DataColumn *frac_col = prof.GetSpeciesPtr(label);
+
+	if (!r_col || !n_col || r_col->Size() != n_col->Size())
+		return nullptr;
+
+	std::uint64_t species_key = 0;
+	std::shared_ptr<const Species> sp = GetSpecies_(eos, label, species_key);
+
+	Fingerprint fp;
+	fp.Add(species_key);
+	fp.Add(r_col->vals);
+	fp.Add(n_col->vals);
+	fp.Add(frac_col ? frac_col->vals : std::vector<double>{});
+	const std::uint64_t key = fp.h;
+
+	{
+		std::lock_guard<std::mutex> lock(mtx_);
+		auto it = profiles_.find(key);
+		if (it != profiles_.end())
+			return it->second;
+	}
+
+	PROFILE_FUNCTION();
+
+	auto p = std::make_shared<Profile>();
+	p->r = *r_col;
+	p->n_tot = *n_col;
+	if (frac_col && frac_col->Size() == n_col->Size())
+		p->n_B = (*n_col) * (*frac_col);
+	p->m_eff = sp->Meff(p->n_tot);
+	p->sigma_0 = sp->Sigma0(p->n_tot);
+
+	std::lock_guard<std::mutex> lock(mtx_);
+	return profiles_.emplace(key, std::move(p)).first->second;
+}
+
+//--------------------------------------------------------------
+void BNV_MicroCache::Clear()
+{
+	std::lock_guard<std::mutex> lock(mtx_);
+	species_.clear();
+	profiles_.clear();
+}
+
+//--------------------------------------------------------------
+std::size_t BNV_MicroCache::NumSpecies() const
+{
+	std::lock_guard<std::mutex> lock(mtx_);
+	return species_.size();
+}
+
+//--------------------------------------------------------------
+std::size_t BNV_MicroCache::NumProfiles() const
+{
+	std::lock_guard<std::mutex> lock(mtx_);
+	return profiles_.size();
+}
+
+} // namespace CompactStar::Microphysics::BNV::Internal
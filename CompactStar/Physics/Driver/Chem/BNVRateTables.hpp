@@ -0,0 +1,193 @@
+// -*- lsst-c++ -*-
+/*
+ * CompactStar
+ * See License file at the top of the source tree.
+ *
+ * Copyright (c) 2025
+ * Mohammadreza Zakeri
+ *
+ * MIT License — see LICENSE at repo root.
+ */
+
+/**
+ * @file BNVRateTables.hpp
+ * @brief Per-star tables of BNV rates Γ(T̃, η) and heating L(T̃, η) per channel.
+ *
+ * @ingroup PhysicsDriver
+ *
+ * The BNV channel rates (Microphysics/BNV) are volume integrals of QAG
+ * phase-space integrals over the profile; a single evaluation is far too
+ * costly for an RHS call. BNVRateTables evaluates each channel once per
+ * star on a uniform ln T̃ grid (optionally × a uniform η grid),
+ *
+ *   Γ_c(T̃, η)       volume-integrated reaction rate at infinity [1/s]
+ *   L_heat,c(T̃, η)  energy deposited in the star, at infinity [erg/s]
+ *
+ * together with the channel sums, and interpolates ln Q(ln T̃) with the same
+ * monotone piecewise-cubic Hermite scheme as ThermalTables (Fritsch–Carlson
+ * slopes, end slopes extrapolated as a local power law), linearly in η
+ * between the two bracketing η nodes (clamped to the η range).
+ *
+ * The channels are supplied as callbacks, so the tables do not depend on the
+ * Microphysics module: a caller wraps e.g. a BNV_Chi channel (cold rate ×
+ * deposited energy per event) or a thermal model into a RateFn. The tables
+ * also record the star's total baryon number B_0 = ∫ n_B dV, so drivers can
+ * turn Γ into a fractional baryon loss.
+ *
+ * A table is built once per star and shared by the BNV drivers through
+ * DriverContext::bnv_tables (BNVSource uses it when it is set).
+ */
+
+#ifndef CompactStar_Physics_Driver_Chem_BNVRateTables_H
+#define CompactStar_Physics_Driver_Chem_BNVRateTables_H
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace CompactStar::Physics::Evolution
+{
+class StarContext;
+class GeometryCache;
+} // namespace CompactStar::Physics::Evolution
+
+namespace CompactStar::Physics::Driver::Chem
+{
+
+/**
+ * @class BNVRateTables
+ * @brief Tabulated, monotone-interpolated BNV rates and heating for one star.
+ */
+class BNVRateTables
+{
+  public:
+	/**
+	 * @brief Rate and heating of one channel (or of their sum).
+	 */
+	struct Sample
+	{
+		double Gamma_1_s = 0.0;	   ///< reactions (baryons lost) per second at infinity
+		double L_heat_erg_s = 0.0; ///< deposited power at infinity [erg/s]
+	};
+
+	/// Volume-integrated channel rates at (T̃ [K], η).
+	using RateFn = std::function<Sample(double Tinf_K, double eta)>;
+
+	/**
+	 * @brief One BNV channel.
+	 */
+	struct Channel
+	{
+		std::string name; ///< label (diagnostics)
+		RateFn rates;	  ///< Γ and L_heat at (T̃, η)
+
+		/**
+		 * @brief Temperature-independent channel (e.g. a cold BNV_Chi rate).
+		 *
+		 * @param Gamma_1_s      Volume-integrated rate [1/s].
+		 * @param E_dep_erg      Energy deposited in the star per reaction [erg].
+		 */
+		static Channel Constant(const std::string &name, double Gamma_1_s, double E_dep_erg)
+		{
+			return {name, [Gamma_1_s, E_dep_erg](double, double) {
+						return Sample{Gamma_1_s, Gamma_1_s * E_dep_erg};
+					}};
+		}
+	};
+
+	/**
+	 * @brief Resolution of the (ln T̃, η) grid.
+	 */
+	struct TableOptions
+	{
+		/// Lower edge of the tabulated T̃ range [K].
+		double Tinf_min_K = 1.0e5;
+
+		/// Upper edge of the tabulated T̃ range [K].
+		double Tinf_max_K = 1.0e10;
+
+		/// Number of nodes on the uniform ln T̃ grid (>= 2).
+		std::size_t n_T = 64;
+
+		/// Tabulate an η axis; otherwise the channels are evaluated at η = 0.
+		bool tabulate_eta = false;
+
+		/// η range and number of nodes (>= 2) when tabulate_eta is set.
+		double eta_min = 0.0;
+		double eta_max = 1.0;
+		std::size_t n_eta = 16;
+	};
+
+	BNVRateTables() = default;
+
+	/**
+	 * @brief Build the tables for one star.
+	 *
+	 * Costs n_T × n_eta evaluations of every channel. B_0 is taken from
+	 * the star's baryon density column (0 if it has none).
+	 *
+	 * @throws std::runtime_error on an invalid grid, an empty channel list,
+	 *         a channel without a callback, or a negative / non-finite rate.
+	 */
+	void Build(const Evolution::StarContext &star,
+			   const Evolution::GeometryCache &geo,
+			   const std::vector<Channel> &channels,
+			   const TableOptions &opts);
+
+	/// Drop all tables (IsBuilt() becomes false).
+	void Clear();
+
+	/// True after a successful Build().
+	bool IsBuilt() const { return built_; }
+
+	/// True if the tables have an η axis.
+	bool HasEta() const { return n_eta_ > 1; }
+
+	/// Number of tabulated channels.
+	std::size_t NumChannels() const { return names_.size(); }
+
+	/// Label of channel @p c.
+	const std::string &ChannelName(std::size_t c) const { return names_.at(c); }
+
+	/// Total baryon number B_0 of the star (0 if unknown).
+	double BaryonNumber() const { return B0_; }
+
+	/// @name Lookups at T̃ [K] and η (zero Sample if not built or T̃ <= 0)
+	/// @{
+	Sample Total(double Tinf_K, double eta = 0.0) const;
+	Sample EvaluateChannel(std::size_t c, double Tinf_K, double eta = 0.0) const;
+	/// @}
+
+  private:
+	/// Table of channel @p c (c == NumChannels() is the sum).
+	Sample Lookup(std::size_t c, double Tinf_K, double eta) const;
+
+	/// Monotone-cubic ln Q of column @p q at η node @p j, segment (k, s).
+	double Interp(std::size_t q, std::size_t j, std::size_t k, double s) const;
+
+	bool built_ = false;
+	std::size_t n_T_ = 0;
+	std::size_t n_eta_ = 0;
+	double B0_ = 0.0;
+
+	// Uniform grids: ln T̃_k = ln_T0_ + k * dln_T_, η_j = eta0_ + j * deta_
+	double ln_T0_ = 0.0;
+	double dln_T_ = 0.0;
+	double eta0_ = 0.0;
+	double deta_ = 0.0;
+
+	std::vector<std::string> names_;
+
+	/// Columns q = 2 c (Γ) and 2 c + 1 (L_heat), c = 0..NumChannels():
+	/// ln Q and d ln Q / d ln T̃ at node (j, k) stored at j * n_T_ + k.
+	std::vector<std::vector<double>> ln_Q_;
+	std::vector<std::vector<double>> slope_;
+
+	/// Columns that are identically zero.
+	std::vector<bool> zero_;
+};
+
+} // namespace CompactStar::Physics::Driver::Chem
+
+#endif /* CompactStar_Physics_Driver_Chem_BNVRateTables_H */
@@ -0,0 +1,183 @@
+// -*- lsst-c++ -*-
+/*
+ * CompactStar
+ * See License file at the top of the source tree.
+ *
+ * Copyright (c) 2025
+ * Mohammadreza Zakeri
+ *
+ * MIT License — see LICENSE at repo root.
+ */
+
+/**
+ * @file BNVSource.hpp
+ * @brief Driver for BNV heating and baryon-number loss from tabulated rates.
+ *
+ * @ingroup PhysicsDriver
+ *
+ * Accumulates
+ *
+ *   d ln T̃ / dt    += L_heat(T̃, η) / (C(T̃) T̃)
+ *   d(ΔB/B_0) / dt += Γ(T̃, η) / B_0
+ *
+ * with the channel sums Γ, L_heat of BNVRateTables. The tables are built
+ * once per star; an RHS evaluation is two table lookups.
+ *
+ * Tables are taken from DriverContext::bnv_tables when it is set (shared
+ * with other BNV drivers); otherwise the driver builds its own from
+ * Options::channels, once per (ctx.star, ctx.geo).
+ *
+ * Heat capacity: C(T̃) from DriverContext::thermal_tables when set,
+ * otherwise the constant Options::C_eff.
+ *
+ * BNVState convention: component 0 is η_I (read as the η argument of the
+ * tables when they have an η axis), component 2 (if present) is the
+ * fractional baryon loss ΔB/B_0.
+ */
+
+#ifndef CompactStar_Physics_Driver_Chem_BNVSource_H
+#define CompactStar_Physics_Driver_Chem_BNVSource_H
+
+#include <string>
+#include <vector>
+
+#include "CompactStar/Physics/Driver/Chem/BNVRateTables.hpp"
+#include "CompactStar/Physics/Driver/IDriver.hpp"
+#include "CompactStar/Physics/Driver/LazyTable.hpp"
+#include "CompactStar/Physics/State/Tags.hpp"
+
+namespace CompactStar::Physics::Driver::Chem
+{
+
+/**
+ * @class BNVSource
+ * @brief BNV-induced heating and baryon-number loss.
+ *
+ * **Depends on:** Thermal, BNV
+ * **Updates:**    Thermal, BNV
+ *
+ * Each update is skipped silently when its block is not part of the run
+ * (a heating-only run needs no BNV block, and vice versa).
+ */
+class BNVSource final : public IDriver
+{
+  public:
+	/**
+	 * @struct Options
+	 * @brief Channel selection, coupling toggles and table resolution.
+	 */
+	struct Options
+	{
+		/// Add L_heat to the thermal block.
+		bool heat_thermal = true;
+
+		/// Evolve ΔB/B_0 (BNVState component 2) when the BNV block has it.
+		bool evolve_baryon_loss = true;
+
+		/// Pass BNVState::EtaI() as η when the tables have an η axis (else η = 0).
+		bool use_eta = true;
+
+		/// Constant effective heat capacity [erg/K] used without DriverContext::thermal_tables.
+		double C_eff = 1.0e40;
+
+		/// Dimensionless multiplicative scale applied to both terms.
+		double global_scale = 1.0;
+
+		/// Channels for the driver's own tables (ignored when ctx.bnv_tables is set).
+		std::vector<BNVRateTables::Channel> channels;
+
+		/// Grid of the driver's own tables.
+		BNVRateTables::TableOptions table{};
+	};
+
+	/// Default-construct with default Options.
+	BNVSource() = default;
+
+	/// Construct with explicit options.
+	explicit BNVSource(const Options &opts)
+		: opts_(opts)
+	{
+	}
+
+	// ------------------------------------------------------------------
+	//  IDriver interface
+	// ------------------------------------------------------------------
+
+	std::string Name() const override { return "BNVSource"; }
+
+	const std::vector<State::StateTag> &DependsOn() const override
+	{
+		static const std::vector<State::StateTag> deps{State::StateTag::Thermal,
+													   State::StateTag::BNV};
+		return deps;
+	}
+
+	const std::vector<State::StateTag> &Updates() const override
+	{
+		static const std::vector<State::StateTag> ups{State::StateTag::Thermal,
+													  State::StateTag::BNV};
+		return ups;
+	}
+
+	/**
+	 * @brief Add the BNV heating and baryon-loss terms to dY/dt.
+	 *
+	 * Skips silently if no tables are available, the thermal block is
+	 * missing or T̃ is not positive.
+	 */
+	void AccumulateRHS(double t,
+					   const Evolution::StateVector &Y,
+					   Evolution::RHSAccumulator &dYdt,
+					   const Evolution::DriverContext &ctx) const override;
+
+	// ------------------------------------------------------------------
+	//  Rates
+	// ------------------------------------------------------------------
+
+	/**
+	 * @brief Summed Γ and L_heat for the current state.
+	 *
+	 * This is the lookup AccumulateRHS() uses (without global_scale).
+	 *
+	 * @return A zero Sample if no tables are available.
+	 * @throws std::runtime_error if η is needed (use_eta and an η axis) but
+	 *         no BNV block is registered in @p Y.
+	 */
+	BNVRateTables::Sample Rates(const Evolution::StateVector &Y,
+								const Evolution::DriverContext &ctx) const;
+
+	/**
+	 * @brief Tables in use: ctx.bnv_tables if built, else the driver's own,
+	 *        built lazily for (ctx.star, ctx.geo).
+	 *
+	 * Once the own tables are built, a call takes no lock. Rebuilding them for
+	 * a new (star, geo) must not overlap RHS calls of another run.
+	 *
+	 * @return nullptr if neither is available (no shared tables and no
+	 *         channels, or ctx.star / ctx.geo is null).
+	 */
+	const BNVRateTables *Tables(const Evolution::DriverContext &ctx) const;
+
+	// ------------------------------------------------------------------
+	//  Options access
+	// ------------------------------------------------------------------
+
+	const Options &GetOptions() const { return opts_; }
+
+	/// Replace options (invalidates the driver's own tables).
+	void SetOptions(const Options &o)
+	{
+		opts_ = o;
+		tables_.Reset();
+	}
+
+  private:
+	Options opts_{};
+
+	/// Own tables, built lazily per (ctx.star, ctx.geo).
+	LazyTable<BNVRateTables> tables_;
+};
+
+} // namespace CompactStar::Physics::Driver::Chem
+
+#endif /* CompactStar_Physics_Driver_Chem_BNVSource_H */
@@ -0,0 +1,126 @@
+// -*- lsst-c++ -*-
+/*
+ * CompactStar
+ * See License file at the top of the source tree.
+ *
+ * Copyright (c) 2025
+ * Mohammadreza Zakeri
+ *
+ * MIT License — see LICENSE at repo root.
+ */
+
+/**
+ * @file Rotochemical.hpp
+ * @brief Driver for the rotochemical forcing of η by spin-down compression.
+ *
+ * @ingroup PhysicsDriver
+ *
+ * As the star spins down the centrifugal support decreases and the core is
+ * compressed, pushing it out of β equilibrium (Reisenegger 1995;
+ * Fernández & Reisenegger 2005):
+ *
+ *   dη_l/dt += 2 W_l Ω Ω̇,     l = npe, npμ,
+ *
+ * where W_l [erg s²] are structure integrals (negative for spin-down
+ * driving η > 0). The relaxation terms −Z ΔΓ are added by WeakRestoration,
+ * so the two drivers together give the full rotochemical η equations.
+ *
+ * Ω̇ is the summed Spin RHS of the run's spin drivers (Options::spin_drivers:
+ * MagneticDipole, BNVSpinTorque, …), evaluated at the same (t, Y), so every
+ * torque in the run contributes and each braking law is configured in one
+ * place.
+ */
+
+#ifndef CompactStar_Physics_Driver_Chem_Rotochemical_H
+#define CompactStar_Physics_Driver_Chem_Rotochemical_H
+
+#include <string>
+#include <vector>
+
+#include "CompactStar/Physics/Driver/IDriver.hpp"
+#include "CompactStar/Physics/State/Tags.hpp"
+
+namespace CompactStar::Physics::Driver::Chem
+{
+
+/**
+ * @class Rotochemical
+ * @brief Spin-down forcing of the chemical imbalances.
+ *
+ * **Depends on:** Spin
+ * **Updates:**    Chem
+ *
+ * ChemState convention: component 0 is η_npe, component 1 (if present) is
+ * η_npμ. An RHS evaluation also runs the spin drivers' AccumulateRHS once
+ * (into a per-thread scratch accumulator) to obtain Ω̇.
+ */
+class Rotochemical final : public IDriver
+{
+  public:
+	/**
+	 * @struct Options
+	 * @brief Structure coefficients and spin-down source.
+	 */
+	struct Options
+	{
+		/// W_npe [erg s²] of the star (see file comment for sign convention).
+		double W_npe = 0.0;
+
+		/// W_npμ [erg s²] (ignored unless the ChemState has two components).
+		double W_npmu = 0.0;
+
+		/// Drivers whose Spin contributions sum to Ω̇ (non-owning; empty: no
+		/// forcing). List every driver of the run that updates Spin; they
+		/// must outlive this driver, typically all are owned by the same run.
+		std::vector<const IDriver *> spin_drivers;
+	};
+
+	/// Default-construct with default Options (no forcing).
+	Rotochemical() = default;
+
+	/// Construct with explicit options.
+	explicit Rotochemical(const Options &opts)
+		: opts_(opts)
+	{
+	}
+
+	// ------------------------------------------------------------------
+	//  IDriver interface
+	// ------------------------------------------------------------------
+
+	std::string Name() const override { return "Rotochemical"; }
+
+	const std::vector<State::StateTag> &DependsOn() const override
+	{
+		static const std::vector<State::StateTag> deps{State::StateTag::Spin};
+		return deps;
+	}
+
+	const std::vector<State::StateTag> &Updates() const override
+	{
+		static const std::vector<State::StateTag> ups{State::StateTag::Chem};
+		return ups;
+	}
+
+	/**
+	 * @brief Add 2 W_l Ω Ω̇ to the Chem block of dY/dt.
+	 */
+	void AccumulateRHS(double t,
+					   const Evolution::StateVector &Y,
+					   Evolution::RHSAccumulator &dYdt,
+					   const Evolution::DriverContext &ctx) const override;
+
+	// ------------------------------------------------------------------
+	//  Options access
+	// ------------------------------------------------------------------
+
+	const Options &GetOptions() const { return opts_; }
+	void SetOptions(const Options &o) { opts_ = o; }
+
+  private:
+	Options opts_{};
+};
+
+} // namespace CompactStar::Physics::Driver::Chem
+
+#endif /* CompactStar_Physics_Driver_Chem_Rotochemical_H */
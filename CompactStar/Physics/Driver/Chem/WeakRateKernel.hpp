@@ -0,0 +1,182 @@
+// -*- lsst-c++ -*-
+/*
+ * CompactStar
+ * See License file at the top of the source tree.
+ *
+ * Copyright (c) 2025
+ * Mohammadreza Zakeri
+ *
+ * MIT License — see LICENSE at repo root.
+ */
+
+/**
+ * @file WeakRateKernel.hpp
+ * @brief Per-star coefficients of the net Urca rates and the Z matrix.
+ *
+ * @ingroup PhysicsDriver
+ *
+ * Chemical imbalances η_l = δμ_n − δμ_p − δμ_l (l = e, μ), redshifted to
+ * infinity and uniform in the core, relax through net Urca reactions
+ * (Reisenegger 1995; Fernández & Reisenegger 2005):
+ *
+ *   dη_e/dt = −Z_npe ΔΓ_e − Z_np  ΔΓ_μ
+ *   dη_μ/dt = −Z_np  ΔΓ_e − Z_npμ ΔΓ_μ
+ *
+ *   ΔΓ_l = [R_MU L_MU,l F_M(ξ_l) + R_DU L_DU,l F_D(ξ_l)] / (k_B T̃),
+ *   ξ_l  = η_l / (k_B T̃),
+ *
+ * where L_MU,l and L_DU,l are the equilibrium modified/direct Urca
+ * luminosities at infinity of channel l. These scale as T̃^8 and T̃^6 with
+ * star-dependent prefactors, so everything structural is reduced here to
+ * a handful of scalars:
+ *
+ *  - A_MU,l, A_DU,l : luminosity prefactors at T̃9 = 1. The electron channel
+ *                     reuses Thermal::NeutrinoCoolingKernel; the muon channel
+ *                     rescales its MUrca weights by k_F,μ/k_F,e and gates its
+ *                     DUrca weights by the muon triangle k_F,n < k_F,p + k_F,μ.
+ *  - Z (2×2)        : Z = K⁻¹ with K = Σ_i dV_i e^{-ν_i} M_i⁻¹ and
+ *                       M = [[a_n+a_p+a_e, a_n+a_p], [a_n+a_p, a_n+a_p+a_μ]],
+ *                       a_j = ∂μ_j/∂n_j = π² ħ² c² / (k_F,j μ_j)
+ *                     (free Fermi gases; nucleons with Landau effective
+ *                     masses). Without muons Z_npe = 1/K_00.
+ *
+ * The EOS tables carry no μ-derivatives and no superfluid reduction
+ * tables are available, so Z comes from the free-gas estimate above
+ * (Params lets a caller override it) and superfluid suppression enters as
+ * the constant factors R_MU, R_DU.
+ *
+ * Species fractions are read from the StarContext columns "10" (n),
+ * "11" (p), "0" (e) and Params::muon_label (μ, optional).
+ */
+
+#ifndef CompactStar_Physics_Driver_Chem_WeakRateKernel_H
+#define CompactStar_Physics_Driver_Chem_WeakRateKernel_H
+
+#include <string>
+
+#include "CompactStar/Physics/Driver/Thermal/NeutrinoCoolingKernel.hpp"
+
+namespace CompactStar::Physics::Evolution
+{
+class StarContext;
+class GeometryCache;
+} // namespace CompactStar::Physics::Evolution
+
+namespace CompactStar::Physics::Driver::Chem
+{
+
+/**
+ * @class WeakRateKernel
+ * @brief Scalar per-star coefficients for η-relaxation by Urca reactions.
+ */
+class WeakRateKernel
+{
+  public:
+	/**
+	 * @brief Microphysics parameters used to build the coefficients.
+	 */
+	struct Params
+	{
+		/// Effective masses and fallback composition (shared with NeutrinoCooling).
+		Thermal::NeutrinoCoolingKernel::Params cooling{};
+
+		/// Species label of the muon fraction column.
+		std::string muon_label = "1";
+
+		/// Constant superfluid reduction factor of the MUrca rates.
+		double R_MU = 1.0;
+
+		/// Constant superfluid reduction factor of the DUrca rates.
+		double R_DU = 1.0;
+
+		/// @name Z overrides [erg]; used instead of the free-gas estimate when Z_npe > 0
+		/// @{
+		double Z_npe = 0.0;
+		double Z_np = 0.0;
+		double Z_npmu = 0.0;
+		/// @}
+	};
+
+	/**
+	 * @brief Net rates and η derivatives at one (T̃, η) point.
+	 */
+	struct Result
+	{
+		double dGamma_e_1_s = 0.0;	///< net npe reaction rate ΔΓ_e [1/s]
+		double dGamma_mu_1_s = 0.0; ///< net npμ reaction rate ΔΓ_μ [1/s]
+		double deta_e_dt = 0.0;		///< dη_e/dt [erg/s]
+		double deta_mu_dt = 0.0;	///< dη_μ/dt [erg/s]
+		double L_heat_erg_s = 0.0;	///< heating Σ_l η_l ΔΓ_l [erg/s]
+		double L_nu_erg_s = 0.0;	///< Urca luminosity Σ_l L_l H(ξ_l) [erg/s]
+	};
+
+	WeakRateKernel() = default;
+
+	/**
+	 * @brief Build the coefficients for one star.
+	 *
+	 * @throws std::runtime_error if the baryon density column is missing, the
+	 *         star/geometry grids are inconsistent, or K is singular.
+	 */
+	void Build(const Evolution::StarContext &star,
+			   const Evolution::GeometryCache &geo,
+			   const Params &par);
+
+	/// Drop all coefficients (IsBuilt() becomes false).
+	void Clear();
+
+	/// True after a successful Build().
+	bool IsBuilt() const { return built_; }
+
+	/// True if the star has a muon column with a non-zero fraction.
+	bool HasMuons() const { return has_muons_; }
+
+	/// @name Z matrix [erg]
+	/// @{
+	double Z_npe() const { return Z_npe_; }
+	double Z_np() const { return Z_np_; }
+	double Z_npmu() const { return Z_npmu_; }
+	/// @}
+
+	/// @name Equilibrium luminosity prefactors at T̃9 = 1, reduction factors included [erg/s]
+	/// @{
+	double A_MU_e() const { return A_MU_e_; }
+	double A_DU_e() const { return A_DU_e_; }
+	double A_MU_mu() const { return A_MU_mu_; }
+	double A_DU_mu() const { return A_DU_mu_; }
+	/// @}
+
+	/**
+	 * @brief Evaluate net rates and dη/dt.
+	 *
+	 * @param Tinf_K T̃ [K] (> 0).
+	 * @param eta_e  η_npe at infinity [erg].
+	 * @param eta_mu η_npμ at infinity [erg] (ignored without muons).
+	 */
+	Result Evaluate(double Tinf_K, double eta_e, double eta_mu) const;
+
+	/// @name Phase-space factors (ξ = η / k_B T)
+	/// @{
+	static double F_MU(double xi);
+	static double F_DU(double xi);
+	static double H_MU(double xi);
+	static double H_DU(double xi);
+	/// @}
+
+  private:
+	bool built_ = false;
+	bool has_muons_ = false;
+
+	double Z_npe_ = 0.0;
+	double Z_np_ = 0.0;
+	double Z_npmu_ = 0.0;
+
+	double A_MU_e_ = 0.0;
+	double A_DU_e_ = 0.0;
+	double A_MU_mu_ = 0.0;
+	double A_DU_mu_ = 0.0;
+};
+
+} // namespace CompactStar::Physics::Driver::Chem
+
+#endif /* CompactStar_Physics_Driver_Chem_WeakRateKernel_H */
@@ -0,0 +1,158 @@
+// -*- lsst-c++ -*-
+/*
+ * CompactStar
+ * See License file at the top of the source tree.
+ *
+ * Copyright (c) 2025
+ * Mohammadreza Zakeri
+ *
+ * MIT License — see LICENSE at repo root.
+ */
+
+/**
+ * @file WeakRestoration.hpp
+ * @brief Driver relaxing chemical imbalances η_l through net Urca reactions.
+ *
+ * @ingroup PhysicsDriver
+ *
+ * Accumulates
+ *
+ *   dη_e/dt += −Z_npe ΔΓ_e − Z_np  ΔΓ_μ
+ *   dη_μ/dt += −Z_np  ΔΓ_e − Z_npμ ΔΓ_μ
+ *
+ * with the net rates ΔΓ_l(η_l, T̃) of WeakRateKernel. All structure-dependent
+ * work (Z matrix, luminosity prefactors) is done once per StarContext; an RHS
+ * evaluation only combines the current η_l and T̃ with those scalars.
+ *
+ * ChemState convention: component 0 is η_npe, component 1 (if present) is
+ * η_npμ, both at infinity in erg.
+ */
+
+#ifndef CompactStar_Physics_Driver_Chem_WeakRestoration_H
+#define CompactStar_Physics_Driver_Chem_WeakRestoration_H
+
+#include <string>
+#include <vector>
+
+#include "CompactStar/Physics/Driver/Chem/WeakRateKernel.hpp"
+#include "CompactStar/Physics/Driver/IDriver.hpp"
+#include "CompactStar/Physics/Driver/LazyTable.hpp"
+#include "CompactStar/Physics/State/Tags.hpp"
+
+namespace CompactStar::Physics::Driver::Chem
+{
+
+/**
+ * @class WeakRestoration
+ * @brief Urca relaxation of η towards β equilibrium.
+ *
+ * **Depends on:** Chem, Thermal
+ * **Updates:**    Chem
+ *
+ * The heating Σ η_l ΔΓ_l that accompanies the relaxation is available from
+ * Rates() for a thermal driver (HeatingFromChem); this driver does not
+ * touch the thermal block.
+ */
+class WeakRestoration final : public IDriver
+{
+  public:
+	/**
+	 * @struct Options
+	 * @brief Channel selection and kernel parameters.
+	 */
+	struct Options
+	{
+		/// Evolve η_npμ (component 1) when the ChemState has it and the star has muons.
+		bool include_muons = true;
+
+		/// Dimensionless multiplicative scale applied to dη/dt.
+		double global_scale = 1.0;
+
+		/// Kernel parameters (effective masses, reduction factors, Z overrides).
+		WeakRateKernel::Params kernel{};
+	};
+
+	/// Default-construct with default Options.
+	WeakRestoration() = default;
+
+	/// Construct with explicit options.
+	explicit WeakRestoration(const Options &opts)
+		: opts_(opts)
+	{
+	}
+
+	// ------------------------------------------------------------------
+	//  IDriver interface
+	// ------------------------------------------------------------------
+
+	std::string Name() const override { return "WeakRestoration"; }
+
+	const std::vector<State::StateTag> &DependsOn() const override
+	{
+		static const std::vector<State::StateTag> deps{State::StateTag::Chem,
+													   State::StateTag::Thermal};
+		return deps;
+	}
+
+	const std::vector<State::StateTag> &Updates() const override
+	{
+		static const std::vector<State::StateTag> ups{State::StateTag::Chem};
+		return ups;
+	}
+
+	/**
+	 * @brief Add the Urca relaxation terms to the Chem block of dY/dt.
+	 *
+	 * Skips silently if the ChemState is empty, T̃ is not positive, or
+	 * ctx has no star/geometry.
+	 */
+	void AccumulateRHS(double t,
+					   const Evolution::StateVector &Y,
+					   Evolution::RHSAccumulator &dYdt,
+					   const Evolution::DriverContext &ctx) const override;
+
+	// ------------------------------------------------------------------
+	//  Rates
+	// ------------------------------------------------------------------
+
+	/**
+	 * @brief Net rates, dη/dt and heating for the current state.
+	 *
+	 * This is the computation AccumulateRHS() uses (without global_scale).
+	 *
+	 * @return A zero Result if the kernel cannot be built for ctx.
+	 */
+	WeakRateKernel::Result Rates(const Evolution::StateVector &Y,
+								 const Evolution::DriverContext &ctx) const;
+
+	/**
+	 * @brief Per-star coefficients, built lazily for (ctx.star, ctx.geo);
+	 *        no lock after the build.
+	 *
+	 * @return nullptr if ctx.star or ctx.geo is null.
+	 */
+	const WeakRateKernel *Kernel(const Evolution::DriverContext &ctx) const;
+
+	// ------------------------------------------------------------------
+	//  Options access
+	// ------------------------------------------------------------------
+
+	const Options &GetOptions() const { return opts_; }
+
+	/// Replace options (invalidates the kernel).
+	void SetOptions(const Options &o)
+	{
+		opts_ = o;
+		kernel_.Reset();
+	}
+
+  private:
+	Options opts_{};
+
+	/// Kernel, built lazily per (ctx.star, ctx.geo).
+	LazyTable<WeakRateKernel> kernel_;
+};
+
+} // namespace CompactStar::Physics::Driver::Chem
+
+#endif /* CompactStar_Physics_Driver_Chem_WeakRestoration_H */
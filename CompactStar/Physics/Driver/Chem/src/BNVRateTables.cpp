@@ -0,0 +1,259 @@
+// -*- lsst-c++ -*-
+/*
+ * CompactStar
+ * See License file at the top of the source tree.
+ *
+ * Copyright (c) 2025
+ * Mohammadreza Zakeri
+ *
+ * MIT License — see LICENSE at repo root.
+ */
+
+/**
+ * @file BNVRateTables.cpp
+ * @brief Build and interpolation of the per-star BNV rate / heating tables.
+ */
+
+#include "CompactStar/Physics/Driver/Chem/BNVRateTables.hpp"
+
+#include "CompactStar/Physics/Evolution/GeometryCache.hpp"
+#include "CompactStar/Physics/Evolution/StarContext.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+#include <Zaki/Util/Instrumentor.hpp>
+#include <Zaki/Util/Logger.hpp>
+
+namespace CompactStar::Physics::Driver::Chem
+{
+
+namespace
+{
+/// Floor applied before taking logs (keeps vanishing entries finite).
+constexpr double kTiny = 1.0e-300;
+
+/// km^3 -> fm^3
+constexpr double kKm3ToFm3 = 1.0e54;
+
+/// Fritsch–Carlson (harmonic-mean) slopes of y[0..n) on a uniform grid of spacing h.
+void MonotoneSlopes(const double *y, std::size_t n, double h, double *m)
+{
+	if (n < 2)
+	{
+		std::fill(m, m + n, 0.0);
+		return;
+	}
+
+	double d_prev = (y[1] - y[0]) / h;
+	m[0] = d_prev;
+	for (std::size_t k = 1; k + 1 < n; ++k)
+	{
+		const double d = (y[k + 1] - y[k]) / h;
+		m[k] = (d_prev * d > 0.0) ? 2.0 * d_prev * d / (d_prev + d) : 0.0;
+		d_prev = d;
+	}
+	m[n - 1] = d_prev;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//  Build
+// -----------------------------------------------------------------------------
+void BNVRateTables::Build(const Evolution::StarContext &star,
+						  const Evolution::GeometryCache &geo,
+						  const std::vector<Channel> &channels,
+						  const TableOptions &opts)
+{
+	PROFILE_FUNCTION();
+
+	Clear();
+
+	if (!(opts.Tinf_min_K > 0.0) || !(opts.Tinf_max_K > opts.Tinf_min_K) || opts.n_T < 2)
+		throw std::runtime_error("BNVRateTables::Build: invalid T grid (need 0 < Tinf_min < Tinf_max, n_T >= 2).");
+	if (opts.tabulate_eta && (!(opts.eta_max > opts.eta_min) || opts.n_eta < 2))
+		throw std::runtime_error("BNVRateTables::Build: invalid eta grid (need eta_min < eta_max, n_eta >= 2).");
+	if (channels.empty())
+		throw std::runtime_error("BNVRateTables::Build: no channels.");
+	for (const Channel &ch : channels)
+		if (!ch.rates)
+			throw std::runtime_error("BNVRateTables::Build: channel '" + ch.name + "' has no rate callback.");
+
+	n_T_ = opts.n_T;
+	n_eta_ = opts.tabulate_eta ? opts.n_eta : 1;
+	ln_T0_ = std::log(opts.Tinf_min_K);
+	dln_T_ = (std::log(opts.Tinf_max_K) - ln_T0_) / static_cast<double>(n_T_ - 1);
+	eta0_ = opts.tabulate_eta ? opts.eta_min : 0.0;
+	deta_ = opts.tabulate_eta ? (opts.eta_max - opts.eta_min) / static_cast<double>(n_eta_ - 1) : 0.0;
+
+	const std::size_t n_ch = channels.size();
+	const std::size_t n_cols = 2 * (n_ch + 1);
+	const std::size_t n_nodes = n_eta_ * n_T_;
+
+	std::vector<std::vector<double>> Q(n_cols, std::vector<double>(n_nodes, 0.0));
+
+	// ---------------------------------------------------------------------
+	// 1) Channel rates at every grid node (and their sum)
+	// ---------------------------------------------------------------------
+	for (std::size_t j = 0; j < n_eta_; ++j)
+	{
+		const double eta = eta0_ + static_cast<double>(j) * deta_;
+		for (std::size_t k = 0; k < n_T_; ++k)
+		{
+			const double T = std::exp(ln_T0_ + static_cast<double>(k) * dln_T_);
+			const std::size_t node = j * n_T_ + k;
+
+			for (std::size_t c = 0; c < n_ch; ++c)
+			{
+				const Sample s = channels[c].rates(T, eta);
+				if (!std::isfinite(s.Gamma_1_s) || !std::isfinite(s.L_heat_erg_s) ||
+					s.Gamma_1_s < 0.0 || s.L_heat_erg_s < 0.0)
+					throw std::runtime_error("BNVRateTables::Build: channel '" + channels[c].name +
+											 "' returned a negative or non-finite rate at T = " +
+											 std::to_string(T) + " K.");
+
+				Q[2 * c][node] = s.Gamma_1_s;
+				Q[2 * c + 1][node] = s.L_heat_erg_s;
+				Q[2 * n_ch][node] += s.Gamma_1_s;
+				Q[2 * n_ch + 1][node] += s.L_heat_erg_s;
+			}
+		}
+	}
+
+	// ---------------------------------------------------------------------
+	// 2) Log columns and monotone slopes along ln T̃ (per η node)
+	// ---------------------------------------------------------------------
+	ln_Q_.assign(n_cols, std::vector<double>(n_nodes, 0.0));
+	slope_.assign(n_cols, std::vector<double>(n_nodes, 0.0));
+	zero_.assign(n_cols, false);
+
+	for (std::size_t q = 0; q < n_cols; ++q)
+	{
+		zero_[q] = std::all_of(Q[q].begin(), Q[q].end(), [](double v) { return !(v > 0.0); });
+
+		for (std::size_t i = 0; i < n_nodes; ++i)
+			ln_Q_[q][i] = std::log(std::max(Q[q][i], kTiny));
+
+		for (std::size_t j = 0; j < n_eta_; ++j)
+			MonotoneSlopes(ln_Q_[q].data() + j * n_T_, n_T_, dln_T_, slope_[q].data() + j * n_T_);
+	}
+
+	names_.reserve(n_ch);
+	for (const Channel &ch : channels)
+		names_.push_back(ch.name);
+
+	// ---------------------------------------------------------------------
+	// 3) Total baryon number B_0 = Σ n_B,i dV_i
+	// ---------------------------------------------------------------------
+	const Zaki::Vector::DataColumn *nb = star.BaryonDensity();
+	if (nb && nb->Size() == geo.Size())
+	{
+		const double *dV = geo.QuadWeights().Data();
+		double B0 = 0.0;
+		for (std::size_t i = 0; i < geo.Size(); ++i)
+			B0 += dV[i] * nb->vals[i];
+		B0_ = B0 * kKm3ToFm3;
+	}
+	else
+	{
+		Z_LOG_WARNING("BNVRateTables::Build: no baryon density column, B_0 is unknown (set to 0).");
+	}
+
+	built_ = true;
+
+	Z_LOG_INFO("BNVRateTables: " + std::to_string(n_ch) + " channel(s), " +
+			   std::to_string(n_T_) + " nodes over T = [" + std::to_string(opts.Tinf_min_K) +
+			   ", " + std::to_string(opts.Tinf_max_K) + "] K" +
+			   (HasEta() ? " x " + std::to_string(n_eta_) + " eta nodes." : "."));
+}
+
+// -----------------------------------------------------------------------------
+//  Clear
+// -----------------------------------------------------------------------------
+void BNVRateTables::Clear()
+{
+	built_ = false;
+	n_T_ = n_eta_ = 0;
+	B0_ = 0.0;
+	ln_T0_ = dln_T_ = eta0_ = deta_ = 0.0;
+	names_.clear();
+	ln_Q_.clear();
+	slope_.clear();
+	zero_.clear();
+}
+
+// -----------------------------------------------------------------------------
+//  Interpolation
+// -----------------------------------------------------------------------------
+double BNVRateTables::Interp(std::size_t q, std::size_t j, std::size_t k, double s) const
+{
+	const double *y = ln_Q_[q].data() + j * n_T_;
+	const double *m = slope_[q].data() + j * n_T_;
+	const double h = dln_T_;
+
+	if (s < 0.0)
+		return y[k] + m[k] * s * h;
+	if (s > 1.0)
+		return y[k + 1] + m[k + 1] * (s - 1.0) * h;
+
+	const double s2 = s * s;
+	const double s3 = s2 * s;
+	return (2.0 * s3 - 3.0 * s2 + 1.0) * y[k] + (s3 - 2.0 * s2 + s) * h * m[k] +
+		   (-2.0 * s3 + 3.0 * s2) * y[k + 1] + (s3 - s2) * h * m[k + 1];
+}
+
+//--------------------------------------------------------------
+BNVRateTables::Sample BNVRateTables::Lookup(std::size_t c, double Tinf_K, double eta) const
+{
+	Sample out;
+	if (!built_ || !(Tinf_K > 0.0))
+		return out;
+
+	// ln T̃ segment (outside [0, 1] only in the end segments: extrapolation)
+	const double u = (std::log(Tinf_K) - ln_T0_) / dln_T_;
+	const double kf = std::clamp(std::floor(u), 0.0, static_cast<double>(n_T_ - 2));
+	const std::size_t k = static_cast<std::size_t>(kf);
+	const double s = u - kf;
+
+	// η bracket (clamped to the tabulated range)
+	std::size_t j = 0;
+	double w = 0.0;
+	if (n_eta_ > 1)
+	{
+		const double v = std::clamp((eta - eta0_) / deta_, 0.0, static_cast<double>(n_eta_ - 1));
+		const double jf = std::min(std::floor(v), static_cast<double>(n_eta_ - 2));
+		j = static_cast<std::size_t>(jf);
+		w = v - jf;
+	}
+
+	auto col = [&](std::size_t q) {
+		if (zero_[q])
+			return 0.0;
+		double ln_q = Interp(q, j, k, s);
+		if (w > 0.0)
+			ln_q += w * (Interp(q, j + 1, k, s) - ln_q);
+		return std::exp(ln_q);
+	};
+
+	out.Gamma_1_s = col(2 * c);
+	out.L_heat_erg_s = col(2 * c + 1);
+	return out;
+}
+
+//--------------------------------------------------------------
+BNVRateTables::Sample BNVRateTables::Total(double Tinf_K, double eta) const
+{
+	return Lookup(names_.size(), Tinf_K, eta);
+}
+
+//--------------------------------------------------------------
+BNVRateTables::Sample BNVRateTables::EvaluateChannel(std::size_t c, double Tinf_K, double eta) const
+{
+	if (c >= names_.size())
+		throw std::runtime_error("BNVRateTables::EvaluateChannel: channel index out of range.");
+	return Lookup(c, Tinf_K, eta);
+}
+
+} // namespace CompactStar::Physics::Driver::Chem
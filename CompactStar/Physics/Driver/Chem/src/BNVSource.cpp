@@ -0,0 +1,123 @@
+// -*- lsst-c++ -*-
+/*
+ * CompactStar
+ * See License file at the top of the source tree.
+ *
+ * Copyright (c) 2025
+ * Mohammadreza Zakeri
+ *
+ * MIT License — see LICENSE at repo root.
+ */
+
+/**
+ * @file BNVSource.cpp
+ * @brief Implementation of the BNVSource (BNV heating / baryon loss) driver.
+ */
+
+#include "CompactStar/Physics/Driver/Chem/BNVSource.hpp"
+
+#include <cmath>
+
+#include "CompactStar/Physics/Driver/Thermal/ThermalTables.hpp"
+#include "CompactStar/Physics/Evolution/DriverContext.hpp"
+#include "CompactStar/Physics/Evolution/RHSAccumulator.hpp"
+#include "CompactStar/Physics/Evolution/StateVector.hpp"
+#include "CompactStar/Physics/State/BNVState.hpp"
+#include "CompactStar/Physics/State/ThermalState.hpp"
+
+#include <Zaki/Util/Instrumentor.hpp> // PROFILE_FUNCTION
+
+namespace CompactStar::Physics::Driver::Chem
+{
+
+// -----------------------------------------------------------------------------
+//  BNVSource::Tables
+// -----------------------------------------------------------------------------
+const BNVRateTables *BNVSource::Tables(const Evolution::DriverContext &ctx) const
+{
+	if (ctx.bnv_tables && ctx.bnv_tables->IsBuilt())
+		return ctx.bnv_tables;
+
+	if (opts_.channels.empty() || !ctx.star || !ctx.geo)
+		return nullptr;
+
+	return &tables_.Get(ctx.star, ctx.geo, [&](BNVRateTables &tab) {
+		tab.Build(*ctx.star, *ctx.geo, opts_.channels, opts_.table);
+	});
+}
+
+// -----------------------------------------------------------------------------
+//  BNVSource::Rates
+// -----------------------------------------------------------------------------
+BNVRateTables::Sample BNVSource::Rates(const Evolution::StateVector &Y,
+									   const Evolution::DriverContext &ctx) const
+{
+	const BNVRateTables *tab = Tables(ctx);
+	if (!tab)
+		return {};
+
+	double eta = 0.0;
+	if (opts_.use_eta && tab->HasEta())
+	{
+		const auto &bnv = Y.GetBNV();
+		if (bnv.NumComponents() > 0)
+			eta = bnv.EtaI();
+	}
+
+	return tab->Total(Y.GetThermal().Tinf(), eta);
+}
+
+// -----------------------------------------------------------------------------
+//  BNVSource::AccumulateRHS
+// -----------------------------------------------------------------------------
+void BNVSource::AccumulateRHS(double t,
+							  const Evolution::StateVector &Y,
+							  Evolution::RHSAccumulator &dYdt,
+							  const Evolution::DriverContext &ctx) const
+{
+	PROFILE_FUNCTION();
+
+	(void)t; // no explicit time dependence
+
+	if (!dYdt.IsConfigured(State::StateTag::Thermal) || Y.GetThermal().Size() == 0)
+		return;
+
+	const double T = Y.GetThermal().Tinf();
+	if (!(T > 0.0))
+		return;
+
+	const bool has_bnv = dYdt.IsConfigured(State::StateTag::BNV);
+	const BNVRateTables *tab = Tables(ctx);
+	if (!tab)
+		return;
+
+	double eta = 0.0;
+	if (opts_.use_eta && has_bnv && tab->HasEta() && Y.GetBNV().NumComponents() > 0)
+		eta = Y.GetBNV().EtaI();
+
+	const BNVRateTables::Sample r = tab->Total(T, eta);
+
+	// Heating: d ln T̃ / dt = L_heat / (C T̃)
+	if (opts_.heat_thermal && r.L_heat_erg_s > 0.0)
+	{
+		const double C = (ctx.thermal_tables && ctx.thermal_tables->IsBuilt())
+							 ? ctx.thermal_tables->C(T)
+							 : opts_.C_eff;
+		const double dlnT_dt = opts_.global_scale * r.L_heat_erg_s / (C * T);
+
+		// Defensive: avoid poisoning RHS with NaN/Inf.
+		if (C > 0.0 && std::isfinite(dlnT_dt))
+			dYdt.AddTo(State::StateTag::Thermal, 0, dlnT_dt);
+	}
+
+	// Baryon loss: d(ΔB/B_0)/dt = Γ / B_0
+	if (opts_.evolve_baryon_loss && has_bnv && Y.GetBNV().NumComponents() > 2 &&
+		tab->BaryonNumber() > 0.0)
+	{
+		const double dloss_dt = opts_.global_scale * r.Gamma_1_s / tab->BaryonNumber();
+		if (std::isfinite(dloss_dt))
+			dYdt.AddTo(State::StateTag::BNV, 2, dloss_dt);
+	}
+}
+
+} // namespace CompactStar::Physics::Driver::Chem
@@ -0,0 +1,96 @@
+// -*- lsst-c++ -*-
+/*
+ * CompactStar
+ * See License file at the top of the source tree.
+ *
+ * Copyright (c) 2025
+ * Mohammadreza Zakeri
+ *
+ * MIT License — see LICENSE at repo root.
+ */
+
+/**
+ * @file Rotochemical.cpp
+ * @brief Implementation of the Rotochemical (spin-down forcing) driver.
+ */
+
+#include "CompactStar/Physics/Driver/Chem/Rotochemical.hpp"
+
+#include <cmath>
+
+#include "CompactStar/Physics/Evolution/DriverContext.hpp"
+#include "CompactStar/Physics/Evolution/RHSAccumulator.hpp"
+#include "CompactStar/Physics/Evolution/StateVector.hpp"
+#include "CompactStar/Physics/State/ChemState.hpp"
+#include "CompactStar/Physics/State/SpinState.hpp"
+
+#include <Zaki/Util/Instrumentor.hpp> // PROFILE_FUNCTION
+
+namespace CompactStar::Physics::Driver::Chem
+{
+
+// -----------------------------------------------------------------------------
+//  Rotochemical::AccumulateRHS
+// -----------------------------------------------------------------------------
+void Rotochemical::AccumulateRHS(double t,
+								 const Evolution::StateVector &Y,
+								 Evolution::RHSAccumulator &dYdt,
+								 const Evolution::DriverContext &ctx) const
+{
+	PROFILE_FUNCTION();
+
+	if (opts_.spin_drivers.empty())
+		return;
+
+	const auto &chem = Y.GetChem();
+	const auto &spin = Y.GetSpin();
+	if (chem.NumComponents() == 0 || spin.NumComponents() == 0)
+		return;
+
+	// Ω̇ = summed Spin RHS of the spin drivers. They run into a scratch
+	// accumulator laid out like dYdt (same blocks configured, so their
+	// IsConfigured checks behave as in the real evaluation).
+	thread_local Evolution::RHSAccumulator scratch;
+
+	bool same_layout = true;
+	for (unsigned int i = 0; i <= static_cast<unsigned int>(State::StateTag::Custom); ++i)
+	{
+		const auto tag = static_cast<State::StateTag>(i);
+		if (dYdt.IsConfigured(tag) != scratch.IsConfigured(tag) ||
+			dYdt.BlockSize(tag) != scratch.BlockSize(tag))
+		{
+			same_layout = false;
+			break;
+		}
+	}
+	if (!same_layout)
+	{
+		scratch = Evolution::RHSAccumulator{};
+		for (unsigned int i = 0; i <= static_cast<unsigned int>(State::StateTag::Custom); ++i)
+		{
+			const auto tag = static_cast<State::StateTag>(i);
+			if (dYdt.IsConfigured(tag))
+				scratch.Configure(tag, dYdt.BlockSize(tag));
+		}
+	}
+	scratch.Clear();
+
+	for (const IDriver *drv : opts_.spin_drivers)
+	{
+		if (drv)
+			drv->AccumulateRHS(t, Y, scratch, ctx);
+	}
+
+	const double Omega = spin.Omega();
+	const double Omega_dot = scratch.Peek(State::StateTag::Spin, 0);
+
+	const double two_OmOmdot = 2.0 * Omega * Omega_dot;
+	if (!std::isfinite(two_OmOmdot))
+		return;
+
+	dYdt.AddTo(State::StateTag::Chem, 0, opts_.W_npe * two_OmOmdot);
+	if (chem.NumComponents() > 1)
+		dYdt.AddTo(State::StateTag::Chem, 1, opts_.W_npmu * two_OmOmdot);
+}
+
+} // namespace CompactStar::Physics::Driver::Chem
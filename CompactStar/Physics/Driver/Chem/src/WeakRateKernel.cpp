@@ -0,0 +1,279 @@
+// -*- lsst-c++ -*-
+/*
+ * CompactStar
+ * See License file at the top of the source tree.
+ *
+ * Copyright (c) 2025
+ * Mohammadreza Zakeri
+ *
+ * MIT License — see LICENSE at repo root.
+ */
+
+/**
+ * @file WeakRateKernel.cpp
+ * @brief Build and evaluation of the per-star Urca-rate coefficients and Z matrix.
+ *
+ * Build() does the radial work once (Fermi momenta, ∂μ/∂n, K = Σ dV e^{-ν} M⁻¹
+ * and the luminosity prefactors); Evaluate() combines scalars only.
+ */
+
+#include "CompactStar/Physics/Driver/Chem/WeakRateKernel.hpp"
+
+#include "CompactStar/Physics/Evolution/GeometryCache.hpp"
+#include "CompactStar/Physics/Evolution/StarContext.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+#include <Zaki/Util/Instrumentor.hpp>
+#include <Zaki/Util/Logger.hpp>
+
+namespace CompactStar::Physics::Driver::Chem
+{
+
+namespace
+{
+// Physical constants (cgs)
+constexpr double KB_cgs = 1.380649e-16;		 ///< erg/K
+constexpr double HBARC_cgs = 3.16152677e-17; ///< ħc [erg cm]
+constexpr double C2_cgs = 8.987551787e20;	 ///< c² [cm²/s²]
+constexpr double MN_g = 1.67492749804e-24;	 ///< neutron mass [g]
+constexpr double MP_g = 1.67262192369e-24;	 ///< proton mass [g]
+constexpr double ME_g = 9.1093837015e-28;	 ///< electron mass [g]
+constexpr double MMU_g = 1.883531627e-25;	 ///< muon mass [g]
+constexpr double INV_FM_TO_INV_CM = 1.0e13;	 ///< fm^-1 -> cm^-1
+
+/// Fermi wave number k_F = (3π² n)^{1/3} [fm^-1] for n in fm^-3.
+inline double FermiK(double n_fm3)
+{
+	return (n_fm3 > 0.0) ? std::cbrt(3.0 * M_PI * M_PI * n_fm3) : 0.0;
+}
+
+/**
+ * @brief ∂μ/∂n = π² (ħc)² / (k_F μ) [erg cm³] of a free Fermi gas.
+ *
+ * @param kF_fm Fermi wave number [fm^-1].
+ * @param m_g   (Effective) mass [g].
+ */
+inline double DMuDn(double kF_fm, double m_g)
+{
+	if (!(kF_fm > 0.0))
+		return 0.0;
+
+	const double k = kF_fm * INV_FM_TO_INV_CM;
+	const double pc = HBARC_cgs * k;
+	const double mc2 = m_g * C2_cgs;
+	const double mu = std::sqrt(mc2 * mc2 + pc * pc);
+	return M_PI * M_PI * HBARC_cgs * HBARC_cgs / (k * mu);
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//  Build
+// -----------------------------------------------------------------------------
+void WeakRateKernel::Build(const Evolution::StarContext &star,
+						   const Evolution::GeometryCache &geo,
+						   const Params &par)
+{
+	PROFILE_FUNCTION();
+
+	Clear();
+
+	// ---------------------------------------------------------------------
+	// 1) Electron-channel luminosity weights (shared with NeutrinoCooling)
+	// ---------------------------------------------------------------------
+	Thermal::NeutrinoCoolingKernel cool;
+	cool.Build(star, geo, par.cooling);
+
+	const Zaki::Vector::DataColumn *nB = star.BaryonDensity();
+	const std::size_t n = cool.Size();
+
+	const Zaki::Vector::DataColumn *Yn = star.Species("10");
+	const Zaki::Vector::DataColumn *Yp = star.Species("11");
+	const Zaki::Vector::DataColumn *Ye = star.Species("0");
+	const Zaki::Vector::DataColumn *Ymu = star.Species(par.muon_label);
+	const bool has_comp = cool.HasComposition();
+
+	if (Ymu && Ymu->Size() == n)
+	{
+		for (std::size_t i = 0; i < n && !has_muons_; ++i)
+			has_muons_ = (*Ymu)[i] > 0.0;
+	}
+
+	const double x_fb = std::clamp(par.cooling.fallback_proton_fraction, 0.0, 1.0);
+	const double mn = par.cooling.m_star_n * MN_g;
+	const double mp = par.cooling.m_star_p * MP_g;
+
+	// ---------------------------------------------------------------------
+	// 2) K = Σ dV e^{-ν} M⁻¹ and muon-channel weights
+	// ---------------------------------------------------------------------
+	double K00 = 0.0, K01 = 0.0, K11 = 0.0;
+	double A_MU_e = 0.0, A_DU_e = 0.0, A_MU_mu = 0.0, A_DU_mu = 0.0;
+	const double *exp_minus_nu = geo.ExpMinusNu().Data();
+
+	for (std::size_t i = 0; i < n; ++i)
+	{
+		A_MU_e += cool.WeightMU()[i];
+		A_DU_e += cool.WeightDU()[i];
+
+		const double nb = (*nB)[i];
+		const double n_n = std::max(0.0, nb * (has_comp ? (*Yn)[i] : 1.0 - x_fb));
+		const double n_p = std::max(0.0, nb * (has_comp ? (*Yp)[i] : x_fb));
+		const double n_e = std::max(0.0, nb * (has_comp ? (*Ye)[i] : x_fb));
+		const double n_mu = has_muons_ ? std::max(0.0, nb * (*Ymu)[i]) : 0.0;
+
+		const double kFn = FermiK(n_n);
+		const double kFp = FermiK(n_p);
+		const double kFe = FermiK(n_e);
+		const double kFmu = FermiK(n_mu);
+
+		const double a_np = DMuDn(kFn, mn) + DMuDn(kFp, mp);
+		const double a_e = DMuDn(kFe, ME_g);
+		const double w = cool.ProperVolume_cm3()[i] * exp_minus_nu[i];
+
+		if (!(a_np > 0.0 && a_e > 0.0))
+			continue;
+
+		if (kFmu > 0.0)
+		{
+			// M⁻¹ of the 2×2 shell matrix.
+			const double m00 = a_np + a_e;
+			const double m01 = a_np;
+			const double m11 = a_np + DMuDn(kFmu, MMU_g);
+			const double det = m00 * m11 - m01 * m01;
+
+			K00 += w * m11 / det;
+			K01 -= w * m01 / det;
+			K11 += w * m00 / det;
+
+			if (kFe > 0.0)
+				A_MU_mu += cool.WeightMU()[i] * (kFmu / kFe);
+			if (kFn < kFp + kFmu)
+				A_DU_mu += cool.WeightDU()[i];
+		}
+		else
+		{
+			K00 += w / (a_np + a_e);
+		}
+	}
+
+	// ---------------------------------------------------------------------
+	// 3) Z = K⁻¹ (or the caller's override)
+	// ---------------------------------------------------------------------
+	if (par.Z_npe > 0.0)
+	{
+		Z_npe_ = par.Z_npe;
+		Z_np_ = has_muons_ ? par.Z_np : 0.0;
+		Z_npmu_ = has_muons_ ? par.Z_npmu : 0.0;
+	}
+	else if (has_muons_)
+	{
+		const double det = K00 * K11 - K01 * K01;
+		if (!(det > 0.0))
+			throw std::runtime_error("WeakRateKernel::Build: singular K matrix (npe/npμ).");
+
+		Z_npe_ = K11 / det;
+		Z_np_ = -K01 / det;
+		Z_npmu_ = K00 / det;
+	}
+	else
+	{
+		if (!(K00 > 0.0))
+			throw std::runtime_error("WeakRateKernel::Build: vanishing K_npe (no npe matter?).");
+
+		Z_npe_ = 1.0 / K00;
+	}
+
+	A_MU_e_ = par.R_MU * A_MU_e;
+	A_DU_e_ = par.R_DU * A_DU_e;
+	A_MU_mu_ = par.R_MU * A_MU_mu;
+	A_DU_mu_ = par.R_DU * A_DU_mu;
+
+	built_ = true;
+
+	Z_LOG_INFO("WeakRateKernel: Z_npe = " + std::to_string(Z_npe_) + " erg, Z_np = " +
+			   std::to_string(Z_np_) + " erg, Z_npmu = " + std::to_string(Z_npmu_) +
+			   " erg (" + (has_muons_ ? "npe+npμ" : "npe only") + ").");
+}
+
+// -----------------------------------------------------------------------------
+//  Clear
+// -----------------------------------------------------------------------------
+void WeakRateKernel::Clear()
+{
+	built_ = false;
+	has_muons_ = false;
+	Z_npe_ = Z_np_ = Z_npmu_ = 0.0;
+	A_MU_e_ = A_DU_e_ = A_MU_mu_ = A_DU_mu_ = 0.0;
+}
+
+// -----------------------------------------------------------------------------
+//  Phase-space factors (Reisenegger 1995; Fernández & Reisenegger 2005)
+// -----------------------------------------------------------------------------
+double WeakRateKernel::F_MU(double xi)
+{
+	const double p2 = M_PI * M_PI;
+	const double x2 = xi * xi / p2;
+	return 14680.0 * xi / (11513.0 * p2) *
+		   (1.0 + x2 * (189.0 / 367.0 + x2 * (21.0 / 367.0 + x2 * 3.0 / 1835.0)));
+}
+
+double WeakRateKernel::F_DU(double xi)
+{
+	const double p2 = M_PI * M_PI;
+	const double x2 = xi * xi / p2;
+	return 714.0 * xi / (457.0 * p2) * (1.0 + x2 * (10.0 + x2) / 17.0);
+}
+
+double WeakRateKernel::H_MU(double xi)
+{
+	const double x2 = xi * xi / (M_PI * M_PI);
+	return 1.0 + x2 * (22020.0 + x2 * (5670.0 + x2 * (420.0 + x2 * 9.0))) / 11513.0;
+}
+
+double WeakRateKernel::H_DU(double xi)
+{
+	const double x2 = xi * xi / (M_PI * M_PI);
+	return 1.0 + x2 * (1071.0 + x2 * (315.0 + x2 * 21.0)) / 457.0;
+}
+
+// -----------------------------------------------------------------------------
+//  Evaluate
+// -----------------------------------------------------------------------------
+WeakRateKernel::Result WeakRateKernel::Evaluate(double Tinf_K, double eta_e, double eta_mu) const
+{
+	Result res;
+	if (!built_ || !(Tinf_K > 0.0))
+		return res;
+
+	const double T9 = Tinf_K * 1.0e-9;
+	const double T9_2 = T9 * T9;
+	const double T9_6 = T9_2 * T9_2 * T9_2;
+	const double T9_8 = T9_6 * T9_2;
+	const double kT = KB_cgs * Tinf_K;
+
+	const double xi_e = eta_e / kT;
+	const double L_MU_e = A_MU_e_ * T9_8;
+	const double L_DU_e = A_DU_e_ * T9_6;
+	res.dGamma_e_1_s = (L_MU_e * F_MU(xi_e) + L_DU_e * F_DU(xi_e)) / kT;
+	res.L_nu_erg_s = L_MU_e * H_MU(xi_e) + L_DU_e * H_DU(xi_e);
+
+	if (has_muons_)
+	{
+		const double xi_mu = eta_mu / kT;
+		const double L_MU_mu = A_MU_mu_ * T9_8;
+		const double L_DU_mu = A_DU_mu_ * T9_6;
+		res.dGamma_mu_1_s = (L_MU_mu * F_MU(xi_mu) + L_DU_mu * F_DU(xi_mu)) / kT;
+		res.L_nu_erg_s += L_MU_mu * H_MU(xi_mu) + L_DU_mu * H_DU(xi_mu);
+	}
+
+	res.deta_e_dt = -Z_npe_ * res.dGamma_e_1_s - Z_np_ * res.dGamma_mu_1_s;
+	res.deta_mu_dt = -Z_np_ * res.dGamma_e_1_s - Z_npmu_ * res.dGamma_mu_1_s;
+	res.L_heat_erg_s = eta_e * res.dGamma_e_1_s + eta_mu * res.dGamma_mu_1_s;
+
+	return res;
+}
+
+} // namespace CompactStar::Physics::Driver::Chem
@@ -0,0 +1,103 @@
+// -*- lsst-c++ -*-
+/*
+ * CompactStar
+ * See License file at the top of the source tree.
+ *
+ * Copyright (c) 2025
+ * Mohammadreza Zakeri
+ *
+ * MIT License — see LICENSE at repo root.
+ */
+
+/**
+ * @file WeakRestoration.cpp
+ * @brief Implementation of the WeakRestoration (Urca relaxation) driver.
+ */
+
+#include "CompactStar/Physics/Driver/Chem/WeakRestoration.hpp"
+
+#include <cmath>
+#include <string>
+
+#include "CompactStar/Physics/Evolution/DriverContext.hpp"
+#include "CompactStar/Physics/Evolution/RHSAccumulator.hpp"
+#include "CompactStar/Physics/Evolution/StateVector.hpp"
+#include "CompactStar/Physics/State/ChemState.hpp"
+#include "CompactStar/Physics/State/ThermalState.hpp"
+
+#include <Zaki/Util/Instrumentor.hpp> // PROFILE_FUNCTION
+
+namespace CompactStar::Physics::Driver::Chem
+{
+
+// -----------------------------------------------------------------------------
+//  WeakRestoration::Kernel
+// -----------------------------------------------------------------------------
+const WeakRateKernel *WeakRestoration::Kernel(const Evolution::DriverContext &ctx) const
+{
+	if (!ctx.star || !ctx.geo)
+		return nullptr;
+
+	return &kernel_.Get(ctx.star, ctx.geo, [&](WeakRateKernel &kernel) {
+		kernel.Build(*ctx.star, *ctx.geo, opts_.kernel);
+	});
+}
+
+// -----------------------------------------------------------------------------
+//  WeakRestoration::Rates
+// -----------------------------------------------------------------------------
+WeakRateKernel::Result WeakRestoration::Rates(const Evolution::StateVector &Y,
+											  const Evolution::DriverContext &ctx) const
+{
+	const WeakRateKernel *kernel = Kernel(ctx);
+	if (!kernel)
+		return {};
+
+	const auto &chem = Y.GetChem();
+	if (chem.NumComponents() == 0)
+		return {};
+
+	const bool use_mu = opts_.include_muons && kernel->HasMuons() && chem.NumComponents() > 1;
+	const double eta_e = chem.Eta(0);
+	const double eta_mu = use_mu ? chem.Eta(1) : 0.0;
+
+	WeakRateKernel::Result r = kernel->Evaluate(Y.GetThermal().Tinf(), eta_e, eta_mu);
+	if (!use_mu)
+	{
+		// The muon channel is not evolved: drop its rate and its feedback on η_e.
+		r.deta_e_dt = -kernel->Z_npe() * r.dGamma_e_1_s;
+		r.deta_mu_dt = 0.0;
+		r.dGamma_mu_1_s = 0.0;
+		r.L_heat_erg_s = eta_e * r.dGamma_e_1_s;
+	}
+	return r;
+}
+
+// -----------------------------------------------------------------------------
+//  WeakRestoration::AccumulateRHS
+// -----------------------------------------------------------------------------
+void WeakRestoration::AccumulateRHS(double t,
+									const Evolution::StateVector &Y,
+									Evolution::RHSAccumulator &dYdt,
+									const Evolution::DriverContext &ctx) const
+{
+	PROFILE_FUNCTION();
+
+	(void)t; // no explicit time dependence
+
+	const auto &chem = Y.GetChem();
+	if (chem.NumComponents() == 0 || Y.GetThermal().Size() == 0)
+		return;
+
+	const WeakRateKernel::Result r = Rates(Y, ctx);
+
+	// Defensive: avoid poisoning RHS with NaN/Inf.
+	if (!std::isfinite(r.deta_e_dt) || !std::isfinite(r.deta_mu_dt))
+		return;
+
+	dYdt.AddTo(State::StateTag::Chem, 0, opts_.global_scale * r.deta_e_dt);
+	if (chem.NumComponents() > 1 && r.deta_mu_dt != 0.0)
+		dYdt.AddTo(State::StateTag::Chem, 1, opts_.global_scale * r.deta_mu_dt);
+}
+
+} // namespace CompactStar::Physics::Driver::Chem
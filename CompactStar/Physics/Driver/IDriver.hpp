@@ -41,6 +41,7 @@
 
 #include "CompactStar/Physics/Driver/Diagnostics/DriverDiagnostics.hpp"
 #include "CompactStar/Physics/Evolution/DriverContext.hpp" // forward declaration only
+#include "CompactStar/Physics/Evolution/EvolutionEvent.hpp"
 #include "CompactStar/Physics/State/Tags.hpp"			   // defines enum class StateTag
 
 namespace CompactStar::Physics
@@ -111,6 +112,20 @@ class IDriver
 							   const Evolution::StateVector &Y,
 							   Evolution::RHSAccumulator &dYdt,
 							   const Evolution::DriverContext &ctx) const = 0;
+
+	/**
+	 * @brief Append driver-defined event functions (optional).
+	 *
+	 * Called once by EvolutionSystem at construction. Drivers that have a
+	 * natural termination or mode-switch condition (e.g. a threshold in
+	 * their own state block) push an EventSpec here; the default adds none.
+	 *
+	 * @param events  Event list to append to.
+	 */
+	virtual void RegisterEvents(std::vector<Evolution::EventSpec> &events) const
+	{
+		(void)events;
+	}
 };
 
 } // namespace CompactStar::Physics
@@ -0,0 +1,116 @@
+// -*- lsst-c++ -*-
+/*
+ * CompactStar
+ * See License file at the top of the source tree.
+ *
+ * Copyright (c) 2025
+ * Mohammadreza Zakeri
+ *
+ * MIT License — see LICENSE at repo root.
+ */
+
+/**
+ * @file LazyTable.hpp
+ * @brief Per-context table built on first use and read without locking.
+ *
+ * @ingroup PhysicsDriver
+ *
+ * Several drivers precompute per-star data (kernels, boundary caches, rate
+ * tables) on their first RHS call and reuse it afterwards. LazyTable holds
+ * one such table together with the context it was built for, identified by
+ * up to two pointers (typically ctx.star and ctx.geo).
+ *
+ * Get() checks an atomic ready flag and the atomic key first; once the
+ * table exists, a lookup takes no lock. The mutex is only taken to build
+ * or rebuild, and the check is repeated under it, so concurrent first
+ * calls build once.
+ *
+ * Rebuilding for a different key must not overlap readers of the old table
+ * (in practice: do not share one driver between concurrent runs on
+ * different stars).
+ */
+
+#ifndef CompactStar_Physics_Driver_LazyTable_H
+#define CompactStar_Physics_Driver_LazyTable_H
+
+#include <atomic>
+#include <mutex>
+
+namespace CompactStar::Physics::Driver
+{
+
+/**
+ * @class LazyTable
+ * @brief A table of type T, lazily built for one context key.
+ *
+ * T must provide Clear().
+ */
+template <class T>
+class LazyTable
+{
+  public:
+	LazyTable() = default;
+
+	LazyTable(const LazyTable &) = delete;
+	LazyTable &operator=(const LazyTable &) = delete;
+
+	/**
+	 * @brief The table built for (@p a, @p b), building it first if needed.
+	 *
+	 * @param build Callable `void(T&)`, run under the lock when the table is
+	 *              missing or was built for another key. If it throws, the
+	 *              table stays unbuilt and the exception propagates.
+	 */
+	template <class BuildFn>
+	const T &Get(const void *a, const void *b, BuildFn &&build) const
+	{
+		// Fast path (every call after the first): no lock.
+		if (BuiltFor_(a, b))
+			return table_;
+
+		std::lock_guard<std::mutex> lock(mtx_);
+
+		// Another thread may have built it while we waited.
+		if (BuiltFor_(a, b))
+			return table_;
+
+		ready_.store(false, std::memory_order_release);
+		build(table_);
+		key_a_.store(a, std::memory_order_release);
+		key_b_.store(b, std::memory_order_release);
+		ready_.store(true, std::memory_order_release);
+
+		return table_;
+	}
+
+	/// Drop the table (next Get() rebuilds).
+	void Reset()
+	{
+		std::lock_guard<std::mutex> lock(mtx_);
+		ready_.store(false, std::memory_order_release);
+		table_.Clear();
+		key_a_.store(nullptr, std::memory_order_release);
+		key_b_.store(nullptr, std::memory_order_release);
+	}
+
+  private:
+	bool BuiltFor_(const void *a, const void *b) const
+	{
+		return ready_.load(std::memory_order_acquire) &&
+			   key_a_.load(std::memory_order_acquire) == a &&
+			   key_b_.load(std::memory_order_acquire) == b;
+	}
+
+	/// Guards (re)build; readers only check the atomics.
+	mutable std::mutex mtx_;
+
+	/// The table and the key it was built for (valid when ready_).
+	mutable T table_{};
+	mutable std::atomic<bool> ready_{false};
+	mutable std::atomic<const void *> key_a_{nullptr};
+	mutable std::atomic<const void *> key_b_{nullptr};
+};
+
+} // namespace CompactStar::Physics::Driver
+
+#endif /* CompactStar_Physics_Driver_LazyTable_H */
@@ -1 +1,185 @@
+// -*- lsst-c++ -*-
+/*
+ * CompactStar
+ * See License file at the top of the source tree.
+ *
+ * Copyright (c) 2025
+ * Mohammadreza Zakeri
+ *
+ * MIT License — see LICENSE at repo root.
+ */
 
+/**
+ * @file BNVSpinTorque.hpp
+ * @brief Spin response to baryon-number loss along the equilibrium sequence.
+ *
+ * @ingroup PhysicsDriver
+ *
+ * With J = I(b) Ω, a baryon loss rate Γ = −ḃ/b and lost matter carrying
+ * dJ/db = λ J/b (λ = 0: J conserved),
+ *
+ *   dΩ/dt = [dJ/db − Ω dI/db] ḃ / I = Ω Γ (b_I − λ),   b_I = d ln I / d ln b.
+ *
+ * For λ = 0 this is the BNV term of BNV_Sequence's standalone spin ODE,
+ * dΩ/dt = −(H²R⁶/I) Ω³ + b_I Γ Ω; the dipole term is left to MagneticDipole,
+ * so both (and the thermal drivers) run in one EvolutionSystem.
+ *
+ * b_I(b) comes from SpinResponseTables, built once from Options::sequence or
+ * from the node profiles of DriverContext::sequence; an RHS evaluation is an
+ * O(1) table lookup.
+ *
+ * Current b: b_0 (1 − ΔB/B_0) with ΔB/B_0 = BNVState::BaryonLoss() when the
+ * BNV block has it (evolved by Chem::BNVSource), else b_0.
+ *
+ * Rate Γ (needs the thermal block for T̃), in order of preference:
+ *  - Options::bnv_source: the Γ of that Chem::BNVSource driver (its shared
+ *    or private tables, η and global_scale), so spin and baryon loss agree;
+ *  - DriverContext::bnv_tables: Γ(T̃, η) / B;
+ *  - the constant Options::gamma_bnv_1_s.
+ * When BNVSource runs with private tables, set Options::bnv_source;
+ * otherwise the torque falls back to the constant rate.
+ */
+
+#ifndef CompactStar_Physics_Driver_Spin_BNVSpinTorque_H
+#define CompactStar_Physics_Driver_Spin_BNVSpinTorque_H
+
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "CompactStar/Core/SeqPoint.hpp"
+#include "CompactStar/Physics/Driver/IDriver.hpp"
+#include "CompactStar/Physics/Driver/LazyTable.hpp"
+#include "CompactStar/Physics/Driver/Spin/SpinResponseTables.hpp"
+#include "CompactStar/Physics/State/Tags.hpp"
+
+namespace CompactStar::Physics::Driver::Chem
+{
+class BNVSource;
+} // namespace CompactStar::Physics::Driver::Chem
+
+namespace CompactStar::Physics::Driver::Spin
+{
+
+/**
+ * @class BNVSpinTorque
+ * @brief Evolution driver for the spin change caused by baryon loss.
+ *
+ * **Depends on:** Spin, BNV, Thermal
+ * **Updates:**    Spin
+ *
+ * The BNV and thermal blocks are optional (see the file description).
+ */
+class BNVSpinTorque final : public IDriver
+{
+  public:
+	/**
+	 * @struct Options
+	 * @brief Sequence source, loss model and rate.
+	 */
+	struct Options
+	{
+		/// Sequence points (b, I); if empty, the nodes of ctx.sequence are used.
+		std::vector<Core::SeqPoint> sequence;
+
+		/// Nodes of the uniform b grid of the response tables.
+		std::size_t n_nodes = 256;
+
+		/// Initial baryon number b_0 (SeqPoint units); <= 0 takes ctx.star's seq_point.b.
+		double b_initial = 0.0;
+
+		/// Specific angular momentum of the lost matter in units of J/b (0 = J conserved).
+		double lambda_J = 0.0;
+
+		/// BNVSource of the run whose Γ drives the spin (non-owning; may be nullptr).
+		const Chem::BNVSource *bnv_source = nullptr;
+
+		/// Fractional BNV rate Γ [1/s] used without bnv_source / DriverContext::bnv_tables.
+		double gamma_bnv_1_s = 0.0;
+
+		/// BNV is switched off after this time [s] (as BNV_Sequence's cut-off).
+		double cutoff_time_s = std::numeric_limits<double>::infinity();
+
+		/// Dimensionless multiplicative scale applied to dΩ/dt.
+		double global_scale = 1.0;
+	};
+
+	/// Default-construct with default Options.
+	BNVSpinTorque() = default;
+
+	/// Construct with explicit options.
+	explicit BNVSpinTorque(const Options &opts)
+		: opts_(opts)
+	{
+	}
+
+	// ------------------------------------------------------------------
+	//  IDriver interface
+	// ------------------------------------------------------------------
+
+	std::string Name() const override { return "BNVSpinTorque"; }
+
+	const std::vector<State::StateTag> &DependsOn() const override
+	{
+		static const std::vector<State::StateTag> deps{State::StateTag::Spin,
+													   State::StateTag::BNV,
+													   State::StateTag::Thermal};
+		return deps;
+	}
+
+	const std::vector<State::StateTag> &Updates() const override
+	{
+		static const std::vector<State::StateTag> ups{State::StateTag::Spin};
+		return ups;
+	}
+
+	/**
+	 * @brief Add Ω Γ (b_I − λ) to the Spin block of dY/dt.
+	 *
+	 * Skips silently if no response tables can be built, Γ vanishes, or
+	 * t is past the cut-off.
+	 */
+	void AccumulateRHS(double t,
+					   const Evolution::StateVector &Y,
+					   Evolution::RHSAccumulator &dYdt,
+					   const Evolution::DriverContext &ctx) const override;
+
+	// ------------------------------------------------------------------
+	//  Tables
+	// ------------------------------------------------------------------
+
+	/**
+	 * @brief Response tables, built lazily from Options::sequence or the
+	 *        nodes of ctx.sequence.
+	 *
+	 * Once built, a call takes no lock. Rebuilding them for another
+	 * ctx.sequence must not overlap RHS calls of another run.
+	 *
+	 * @return nullptr if neither is available.
+	 */
+	const SpinResponseTables *Tables(const Evolution::DriverContext &ctx) const;
+
+	// ------------------------------------------------------------------
+	//  Options access
+	// ------------------------------------------------------------------
+
+	const Options &GetOptions() const { return opts_; }
+
+	/// Replace options (invalidates the tables).
+	void SetOptions(const Options &o)
+	{
+		opts_ = o;
+		tables_.Reset();
+	}
+
+  private:
+	Options opts_{};
+
+	/// Response tables, keyed on the ctx.sequence they were built from
+	/// (nullptr: Options::sequence).
+	LazyTable<SpinResponseTables> tables_;
+};
+
+} // namespace CompactStar::Physics::Driver::Spin
+
+#endif /* CompactStar_Physics_Driver_Spin_BNVSpinTorque_H */
@@ -118,6 +118,14 @@ class MagneticDipole final : public IDriver
 					   Evolution::RHSAccumulator &dYdt,
 					   const Evolution::DriverContext &ctx) const override;
 
+	/**
+	 * @brief Braking law dΩ/dt = −K |Ω|^n sign(Ω) at the given Ω.
+	 *
+	 * This is the term AccumulateRHS() adds, exposed so callers can query
+	 * the braking law without duplicating K and n.
+	 */
+	double OmegaDot(double Omega) const;
+
 	// ------------------------------------------------------------------
 	//  Options access
 	// ------------------------------------------------------------------
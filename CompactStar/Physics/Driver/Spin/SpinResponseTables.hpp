@@ -0,0 +1,123 @@
+// -*- lsst-c++ -*-
+/*
+ * CompactStar
+ * See License file at the top of the source tree.
+ *
+ * Copyright (c) 2025
+ * Mohammadreza Zakeri
+ *
+ * MIT License — see LICENSE at repo root.
+ */
+
+/**
+ * @file SpinResponseTables.hpp
+ * @brief Moment of inertia and its baryon-number response along a sequence.
+ *
+ * @ingroup PhysicsDriver
+ *
+ * A star losing baryons moves along its equilibrium sequence; for slow
+ * rotation J = I(b) Ω, so the spin responds through
+ *
+ *   dI/db,   b_I = d ln I / d ln b,   (∂Ω/∂b)_J = −Ω (dI/db) / I.
+ *
+ * SpinResponseTables takes the sequence points (b, I) — from a TOV
+ * sequence or the node profiles of a SequenceGeometry — interpolates I(b)
+ * with a piecewise-cubic Hermite polynomial (node slopes from second-order
+ * three-point differences on the non-uniform nodes) and resamples I and
+ * dI/db onto a uniform b grid, so a lookup is an O(1) linear
+ * interpolation. Queries outside [b_min, b_max] are clamped to the
+ * sequence ends.
+ *
+ * This is the same b_I that BNV_Sequence computes by finite differences for
+ * its standalone spin ODE.
+ */
+
+#ifndef CompactStar_Physics_Driver_Spin_SpinResponseTables_H
+#define CompactStar_Physics_Driver_Spin_SpinResponseTables_H
+
+#include <cstddef>
+#include <vector>
+
+#include "CompactStar/Core/SeqPoint.hpp"
+
+namespace CompactStar::Physics::Evolution
+{
+class SequenceGeometry;
+} // namespace CompactStar::Physics::Evolution
+
+namespace CompactStar::Physics::Driver::Spin
+{
+
+/**
+ * @class SpinResponseTables
+ * @brief Uniform-b tables of I(b), dI/db and b_I for one sequence.
+ */
+class SpinResponseTables
+{
+  public:
+	/**
+	 * @brief Response coefficients at one b.
+	 */
+	struct Sample
+	{
+		double I = 0.0;		///< moment of inertia (SeqPoint units)
+		double dI_db = 0.0; ///< dI/db
+		double b_I = 0.0;	///< d ln I / d ln b
+	};
+
+	SpinResponseTables() = default;
+
+	/**
+	 * @brief Build from sequence points (any order; sorted by b).
+	 *
+	 * @param n_nodes Nodes of the uniform b grid (>= 2).
+	 *
+	 * @throws std::runtime_error if fewer than two points are given, two
+	 *         points share the same b, or an I or b is not positive.
+	 */
+	void Build(std::vector<Core::SeqPoint> seq, std::size_t n_nodes = 256);
+
+	/**
+	 * @brief Build from the node profiles of @p seq (seq_point of each).
+	 *
+	 * The nodes are re-sorted by b, whichever parameter orders @p seq.
+	 *
+	 * @throws std::runtime_error as the SeqPoint overload.
+	 */
+	void Build(const Evolution::SequenceGeometry &seq, std::size_t n_nodes = 256);
+
+	/// Drop all tables (IsBuilt() becomes false).
+	void Clear();
+
+	/// True after a successful Build().
+	bool IsBuilt() const { return built_; }
+
+	/// Tabulated range of b.
+	double BMin() const { return b0_; }
+	double BMax() const { return b0_ + db_ * static_cast<double>(n_ > 0 ? n_ - 1 : 0); }
+
+	/// @name Lookups at b (zero Sample if not built)
+	/// @{
+	Sample Evaluate(double b) const;
+	double I(double b) const { return Evaluate(b).I; }
+	double b_I(double b) const { return Evaluate(b).b_I; }
+
+	/// (∂Ω/∂b) at fixed J: −Ω (dI/db) / I.
+	double OmegaResponse(double b, double Omega) const;
+	/// @}
+
+  private:
+	bool built_ = false;
+	std::size_t n_ = 0;
+
+	// Uniform grid: b_k = b0_ + k * db_
+	double b0_ = 0.0;
+	double db_ = 0.0;
+
+	std::vector<double> I_;
+	std::vector<double> dI_;
+};
+
+} // namespace CompactStar::Physics::Driver::Spin
+
+#endif /* CompactStar_Physics_Driver_Spin_SpinResponseTables_H */
@@ -0,0 +1,134 @@
+// -*- lsst-c++ -*-
+/*
+ * CompactStar
+ * See License file at the top of the source tree.
+ *
+ * Copyright (c) 2025
+ * Mohammadreza Zakeri
+ *
+ * MIT License — see LICENSE at repo root.
+ */
+
+/**
+ * @file BNVSpinTorque.cpp
+ * @brief Implementation of the BNVSpinTorque driver.
+ */
+
+#include "CompactStar/Physics/Driver/Spin/BNVSpinTorque.hpp"
+
+#include <cmath>
+
+#include "CompactStar/Core/StarProfile.hpp"
+#include "CompactStar/Physics/Driver/Chem/BNVRateTables.hpp"
+#include "CompactStar/Physics/Driver/Chem/BNVSource.hpp"
+#include "CompactStar/Physics/Evolution/DriverContext.hpp"
+#include "CompactStar/Physics/Evolution/RHSAccumulator.hpp"
+#include "CompactStar/Physics/Evolution/SequenceGeometry.hpp"
+#include "CompactStar/Physics/Evolution/StarContext.hpp"
+#include "CompactStar/Physics/Evolution/StateVector.hpp"
+#include "CompactStar/Physics/State/BNVState.hpp"
+#include "CompactStar/Physics/State/SpinState.hpp"
+#include "CompactStar/Physics/State/ThermalState.hpp"
+
+#include <Zaki/Util/Instrumentor.hpp> // PROFILE_FUNCTION
+
+namespace CompactStar::Physics::Driver::Spin
+{
+
+// -----------------------------------------------------------------------------
+//  BNVSpinTorque::Tables
+// -----------------------------------------------------------------------------
+const SpinResponseTables *BNVSpinTorque::Tables(const Evolution::DriverContext &ctx) const
+{
+	const bool own = !opts_.sequence.empty();
+	if (!own && !ctx.sequence)
+		return nullptr;
+
+	const Evolution::SequenceGeometry *src = own ? nullptr : ctx.sequence;
+
+	return &tables_.Get(src, nullptr, [&](SpinResponseTables &tab) {
+		if (own)
+			tab.Build(opts_.sequence, opts_.n_nodes);
+		else
+			tab.Build(*ctx.sequence, opts_.n_nodes);
+	});
+}
+
+// -----------------------------------------------------------------------------
+//  BNVSpinTorque::AccumulateRHS
+// -----------------------------------------------------------------------------
+void BNVSpinTorque::AccumulateRHS(double t,
+								  const Evolution::StateVector &Y,
+								  Evolution::RHSAccumulator &dYdt,
+								  const Evolution::DriverContext &ctx) const
+{
+	PROFILE_FUNCTION();
+
+	if (t > opts_.cutoff_time_s)
+		return;
+
+	const Physics::State::SpinState &spin = Y.GetSpin();
+	if (spin.NumComponents() == 0)
+		return;
+
+	const double Omega = spin.Omega();
+	if (Omega == 0.0)
+		return;
+
+	const SpinResponseTables *tab = Tables(ctx);
+	if (!tab)
+		return;
+
+	// -------------------------------------------------------------------------
+	//  Position on the sequence
+	// -------------------------------------------------------------------------
+	double b0 = opts_.b_initial;
+	if (!(b0 > 0.0) && ctx.star && ctx.star->Profile())
+		b0 = ctx.star->Profile()->seq_point.b;
+	if (!(b0 > 0.0))
+		return;
+
+	const bool has_bnv = dYdt.IsConfigured(State::StateTag::BNV);
+	const double loss = (has_bnv && Y.GetBNV().NumComponents() > 2) ? Y.GetBNV().BaryonLoss() : 0.0;
+	const double b = b0 * (1.0 - loss);
+
+	// -------------------------------------------------------------------------
+	//  Fractional rate Γ = −ḃ/b
+	// -------------------------------------------------------------------------
+	double gamma = opts_.gamma_bnv_1_s;
+	const bool has_thermal = dYdt.IsConfigured(State::StateTag::Thermal) && Y.GetThermal().Size() > 0;
+	const Chem::BNVRateTables *rates = ctx.bnv_tables;
+	if (opts_.bnv_source && has_thermal)
+	{
+		// Same tables (shared or private), η and scale as the run's BNVSource,
+		// so the spin responds to exactly the baryon loss it evolves.
+		const Chem::BNVRateTables *src = opts_.bnv_source->Tables(ctx);
+		if (src && src->BaryonNumber() > 0.0)
+			gamma = opts_.bnv_source->GetOptions().global_scale *
+					opts_.bnv_source->Rates(Y, ctx).Gamma_1_s /
+					(src->BaryonNumber() * (1.0 - loss));
+	}
+	else if (rates && rates->IsBuilt() && rates->BaryonNumber() > 0.0 && has_thermal)
+	{
+		const double eta = (has_bnv && rates->HasEta() && Y.GetBNV().NumComponents() > 0)
+							   ? Y.GetBNV().EtaI()
+							   : 0.0;
+		gamma = rates->Total(Y.GetThermal().Tinf(), eta).Gamma_1_s /
+				(rates->BaryonNumber() * (1.0 - loss));
+	}
+	if (gamma == 0.0)
+		return;
+
+	// -------------------------------------------------------------------------
+	//  dΩ/dt = Ω Γ (b_I − λ)
+	// -------------------------------------------------------------------------
+	const double dOmega_dt = opts_.global_scale * Omega * gamma * (tab->b_I(b) - opts_.lambda_J);
+
+	// Defensive: avoid poisoning RHS with NaN/Inf.
+	if (!std::isfinite(dOmega_dt))
+		return;
+
+	dYdt.AddTo(State::StateTag::Spin, 0, dOmega_dt);
+}
+
+} // namespace CompactStar::Physics::Driver::Spin
@@ -111,12 +111,9 @@ void MagneticDipole::AccumulateRHS(double t,
 	// -------------------------------------------------------------------------
 	const double Omega = spin.Omega(); // component 0 by convention
 
-	const double n = opts_.braking_index;
-	double K_eff = opts_.K_prefactor;
-
 	// NOTE: If we later decide to use moment of inertia from the context,
-	// this is where we would modify K_eff. For now, we simply honor the
-	// value configured in Options.
+	// OmegaDot() is where K_prefactor would be rescaled. For now, we simply
+	// honor the value configured in Options.
 	if (opts_.use_moment_of_inertia)
 	{
 		// Placeholder for future use of ctx (I, R, B, geometry).
@@ -134,11 +131,7 @@ void MagneticDipole::AccumulateRHS(double t,
 		return;
 	}
 
-	// Protect against non-integer braking indices and negative Ω:
-	//   |Ω|^n * sign(Ω) → behaves like Ω^n for odd integer n,
-	//   but remains real-valued for any real n.
-	const double sign = (Omega >= 0.0) ? 1.0 : -1.0;
-	const double dOmega_dt = -K_eff * sign * std::pow(absOmega, n);
+	const double dOmega_dt = OmegaDot(Omega);
 
 	// -------------------------------------------------------------------------
 	//  4. Accumulate into the Spin block of dY/dt
@@ -153,6 +146,22 @@ void MagneticDipole::AccumulateRHS(double t,
 	dYdt.AddTo(State::StateTag::Spin, 0, dOmega_dt);
 }
 
+// -----------------------------------------------------------------------------
+//  MagneticDipole::OmegaDot
+// -----------------------------------------------------------------------------
+double MagneticDipole::OmegaDot(double Omega) const
+{
+	const double absOmega = std::abs(Omega);
+	if (opts_.K_prefactor == 0.0 || absOmega == 0.0)
+		return 0.0;
+
+	// Protect against non-integer braking indices and negative Ω:
+	//   |Ω|^n * sign(Ω) → behaves like Ω^n for odd integer n,
+	//   but remains real-valued for any real n.
+	const double sign = (Omega >= 0.0) ? 1.0 : -1.0;
+	return -opts_.K_prefactor * sign * std::pow(absOmega, opts_.braking_index);
+}
+
 // -----------------------------------------------------------------------------
 //  End namespace
 // -----------------------------------------------------------------------------
@@ -0,0 +1,170 @@
+// -*- lsst-c++ -*-
+/*
+ * CompactStar
+ * See License file at the top of the source tree.
+ *
+ * Copyright (c) 2025
+ * Mohammadreza Zakeri
+ *
+ * MIT License — see LICENSE at repo root.
+ */
+
+/**
+ * @file SpinResponseTables.cpp
+ * @brief Build and lookup of the I(b), dI/db, b_I tables.
+ */
+
+#include "CompactStar/Physics/Driver/Spin/SpinResponseTables.hpp"
+
+#include "CompactStar/Physics/Evolution/SequenceGeometry.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+#include <Zaki/Util/Instrumentor.hpp>
+#include <Zaki/Util/Logger.hpp>
+
+namespace CompactStar::Physics::Driver::Spin
+{
+
+// -----------------------------------------------------------------------------
+//  Build
+// -----------------------------------------------------------------------------
+void SpinResponseTables::Build(std::vector<Core::SeqPoint> seq, std::size_t n_nodes)
+{
+	PROFILE_FUNCTION();
+
+	Clear();
+
+	if (seq.size() < 2 || n_nodes < 2)
+		throw std::runtime_error("SpinResponseTables::Build: need at least two sequence points and n_nodes >= 2.");
+
+	std::sort(seq.begin(), seq.end(),
+			  [](const Core::SeqPoint &a, const Core::SeqPoint &b) { return a.b < b.b; });
+
+	const std::size_t m = seq.size();
+	std::vector<double> b(m), I(m), dI(m);
+	for (std::size_t i = 0; i < m; ++i)
+	{
+		b[i] = seq[i].b;
+		I[i] = seq[i].I;
+		if (!(b[i] > 0.0) || !(I[i] > 0.0))
+			throw std::runtime_error("SpinResponseTables::Build: non-positive b or I in the sequence.");
+		if (i > 0 && !(b[i] > b[i - 1]))
+			throw std::runtime_error("SpinResponseTables::Build: two sequence points share b = " +
+									 std::to_string(b[i]) + ".");
+	}
+
+	// ---------------------------------------------------------------------
+	// 1) Node slopes dI/db (second-order three-point differences)
+	// ---------------------------------------------------------------------
+	if (m == 2)
+	{
+		dI[0] = dI[1] = (I[1] - I[0]) / (b[1] - b[0]);
+	}
+	else
+	{
+		for (std::size_t i = 0; i < m; ++i)
+		{
+			// Stencil (l, c, r) centred on i, shifted inwards at the ends
+			const std::size_t c = std::clamp<std::size_t>(i, 1, m - 2);
+			const double x = b[i];
+			const double x0 = b[c - 1], x1 = b[c], x2 = b[c + 1];
+
+			// Derivative of the Lagrange parabola through the stencil at x
+			dI[i] = I[c - 1] * (2.0 * x - x1 - x2) / ((x0 - x1) * (x0 - x2)) +
+					I[c] * (2.0 * x - x0 - x2) / ((x1 - x0) * (x1 - x2)) +
+					I[c + 1] * (2.0 * x - x0 - x1) / ((x2 - x0) * (x2 - x1));
+		}
+	}
+
+	// ---------------------------------------------------------------------
+	// 2) Cubic Hermite I(b) resampled on the uniform b grid
+	// ---------------------------------------------------------------------
+	n_ = n_nodes;
+	b0_ = b.front();
+	db_ = (b.back() - b0_) / static_cast<double>(n_ - 1);
+	I_.resize(n_);
+	dI_.resize(n_);
+
+	std::size_t k = 0;
+	for (std::size_t j = 0; j < n_; ++j)
+	{
+		const double x = (j + 1 == n_) ? b.back() : b0_ + static_cast<double>(j) * db_;
+		while (k + 2 < m && x > b[k + 1])
+			++k;
+
+		const double h = b[k + 1] - b[k];
+		const double s = (x - b[k]) / h;
+		const double s2 = s * s;
+		const double s3 = s2 * s;
+
+		I_[j] = (2.0 * s3 - 3.0 * s2 + 1.0) * I[k] + (s3 - 2.0 * s2 + s) * h * dI[k] +
+				(-2.0 * s3 + 3.0 * s2) * I[k + 1] + (s3 - s2) * h * dI[k + 1];
+
+		dI_[j] = (6.0 * s2 - 6.0 * s) * (I[k] - I[k + 1]) / h +
+				 (3.0 * s2 - 4.0 * s + 1.0) * dI[k] + (3.0 * s2 - 2.0 * s) * dI[k + 1];
+	}
+
+	built_ = true;
+
+	Z_LOG_INFO("SpinResponseTables: " + std::to_string(m) + " sequence points resampled on " +
+			   std::to_string(n_) + " nodes over b = [" + std::to_string(b0_) + ", " +
+			   std::to_string(b.back()) + "].");
+}
+
+//--------------------------------------------------------------
+void SpinResponseTables::Build(const Evolution::SequenceGeometry &seq, std::size_t n_nodes)
+{
+	std::vector<Core::SeqPoint> pts;
+	pts.reserve(seq.NumProfiles());
+	for (std::size_t k = 0; k < seq.NumProfiles(); ++k)
+		pts.push_back(seq.Profile(k).seq_point);
+
+	Build(std::move(pts), n_nodes);
+}
+
+// -----------------------------------------------------------------------------
+//  Clear
+// -----------------------------------------------------------------------------
+void SpinResponseTables::Clear()
+{
+	built_ = false;
+	n_ = 0;
+	b0_ = db_ = 0.0;
+	I_.clear();
+	dI_.clear();
+}
+
+// -----------------------------------------------------------------------------
+//  Lookups
+// -----------------------------------------------------------------------------
+SpinResponseTables::Sample SpinResponseTables::Evaluate(double b) const
+{
+	Sample out;
+	if (!built_)
+		return out;
+
+	const double u = std::clamp((b - b0_) / db_, 0.0, static_cast<double>(n_ - 1));
+	const double kf = std::min(std::floor(u), static_cast<double>(n_ - 2));
+	const std::size_t k = static_cast<std::size_t>(kf);
+	const double w = u - kf;
+
+	out.I = I_[k] + w * (I_[k + 1] - I_[k]);
+	out.dI_db = dI_[k] + w * (dI_[k + 1] - dI_[k]);
+
+	const double b_c = b0_ + u * db_;
+	out.b_I = (out.I > 0.0) ? b_c * out.dI_db / out.I : 0.0;
+	return out;
+}
+
+//--------------------------------------------------------------
+double SpinResponseTables::OmegaResponse(double b, double Omega) const
+{
+	const Sample r = Evaluate(b);
+	return (r.I > 0.0) ? -Omega * r.dI_db / r.I : 0.0;
+}
+
+} // namespace CompactStar::Physics::Driver::Spin
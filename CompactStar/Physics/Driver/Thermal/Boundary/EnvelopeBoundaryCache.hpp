@@ -0,0 +1,160 @@
+#ifndef CompactStar_Physics_Driver_Thermal_Boundary_EnvelopeBoundaryCache_H
+#define CompactStar_Physics_Driver_Thermal_Boundary_EnvelopeBoundaryCache_H
+
+// -*- lsst-c++ -*-
+/*
+ * CompactStar
+ * See License file at the top of the source tree.
+ *
+ * Copyright (c) 2025
+ * Mohammadreza Zakeri
+ *
+ * MIT License — see LICENSE at repo root.
+ */
+
+/**
+ * @file EnvelopeBoundaryCache.hpp
+ * @brief Per-star precomputed envelope boundary (Tb index, g14, redshift, Ts(Tb) table).
+ *
+ * @ingroup PhysicsDriverThermalBoundary
+ *
+ * The envelope boundary condition used by PhotonCooling depends on:
+ *  - the base-of-envelope index i_b (density threshold rho_b),
+ *  - the redshift factor exp(ν(r_b)) at that index,
+ *  - the surface gravity g14,
+ *  - the envelope fit Ts(Tb, g14, xi).
+ *
+ * For a static background star all of these are fixed for the whole run; only
+ * Tb (through T_inf) changes. This cache resolves the structural quantities once
+ * and tabulates ln Ts on a uniform ln Tb grid, so that the RHS evaluation reduces to
+ *
+ *   Tb = T_inf * exp(-ν_b)           (one multiply)
+ *   Ts = exp( lerp(ln Ts)(ln Tb) )   (O(1) uniform-grid lookup)
+ *
+ * with no profile scans or envelope-fit re-evaluations.
+ *
+ * Interpolation is linear in (ln Tb, ln Ts). Outside the tabulated range the end
+ * segments are extrapolated, i.e. a local power law Ts ∝ Tb^s is assumed. For the
+ * Potekhin-style power-law fits this is exact everywhere.
+ */
+
+#include <cstddef>
+#include <vector>
+
+#include "CompactStar/Physics/Driver/Thermal/Boundary/TbDefinition.hpp"
+
+namespace CompactStar::Physics::Evolution
+{
+class StarContext;
+class GeometryCache;
+} // namespace CompactStar::Physics::Evolution
+
+namespace CompactStar::Physics::Driver::Thermal::Boundary
+{
+class IEnvelope;
+
+// -------------------------------------------------------
+/**
+ * @class EnvelopeBoundaryCache
+ * @brief Precomputed Tb→Ts boundary data for one star and one envelope policy.
+ *
+ * Build once (e.g. on the first RHS call of a run), then query with
+ * Tb_from_Tinf() / Ts_from_Tb() / Ts_from_Tinf().
+ */
+class EnvelopeBoundaryCache
+{
+  public:
+	/**
+	 * @brief Resolution of the Ts(Tb) table.
+	 */
+	struct TableOptions
+	{
+		/// Lower edge of the tabulated Tb range [K].
+		double Tb_min_K = 1.0e5;
+
+		/// Upper edge of the tabulated Tb range [K].
+		double Tb_max_K = 1.0e10;
+
+		/// Number of nodes on the uniform ln Tb grid (>= 2).
+		std::size_t n_nodes = 256;
+	};
+
+	EnvelopeBoundaryCache() = default;
+
+	/**
+	 * @brief Resolve structure quantities and tabulate Ts(Tb).
+	 *
+	 * @param star  StarContext (profile used for rho_b and ν fallback).
+	 * @param geo   Optional GeometryCache (preferred for ExpNu, R, M).
+	 * @param def   Tb boundary policy (rho_b, redshift policy).
+	 * @param env   Envelope fit used to fill the table (only read during Build).
+	 * @param xi    Envelope composition parameter forwarded to @p env.
+	 * @param tab   Table resolution.
+	 *
+	 * @throws std::runtime_error if the boundary cannot be located or the table
+	 *         contains non-positive Ts values.
+	 */
+	void Build(const Evolution::StarContext &star,
+			   const Evolution::GeometryCache *geo,
+			   const TbDefinition &def,
+			   const IEnvelope &env,
+			   double xi,
+			   const TableOptions &tab);
+
+	/// Same as Build(...) with default TableOptions.
+	void Build(const Evolution::StarContext &star,
+			   const Evolution::GeometryCache *geo,
+			   const TbDefinition &def,
+			   const IEnvelope &env,
+			   double xi);
+
+	/// Drop all cached data (IsBuilt() becomes false).
+	void Clear();
+
+	/// True after a successful Build().
+	bool IsBuilt() const { return built_; }
+
+	/// @name Cached structure quantities
+	/// @{
+	std::size_t TbIndex() const { return i_b_; }	///< base-of-envelope grid index
+	double ExpNuB() const { return expnu_b_; }		///< exp(ν(r_b))
+	double G14() const { return g14_; }				///< surface gravity / 1e14 cm s^-2
+	double RhoB() const { return rho_b_; }			///< rho_b used for i_b [g/cm^3]
+	double Xi() const { return xi_; }				///< envelope xi used for the table
+	std::size_t TableSize() const { return ln_Ts_.size(); }
+	/// @}
+
+	/// Local Tb from the redshifted isothermal temperature: Tb = T_inf / exp(ν_b).
+	double Tb_from_Tinf(double Tinf_K) const { return Tinf_K * inv_expnu_b_; }
+
+	/**
+	 * @brief Table lookup Ts(Tb) (log-log linear, power-law extrapolation).
+	 * @return Ts [K], or 0 if Tb <= 0 or the cache is not built.
+	 */
+	double Ts_from_Tb(double Tb_K) const;
+
+	/// Convenience: Ts_from_Tb(Tb_from_Tinf(Tinf_K)).
+	double Ts_from_Tinf(double Tinf_K) const { return Ts_from_Tb(Tb_from_Tinf(Tinf_K)); }
+
+  private:
+	bool built_ = false;
+
+	std::size_t i_b_ = 0;
+	double expnu_b_ = 0.0;
+	double inv_expnu_b_ = 0.0;
+	double g14_ = 0.0;
+	double rho_b_ = 0.0;
+	double xi_ = 0.0;
+
+	// Uniform ln Tb grid: ln Tb_k = ln_Tb0_ + k * dln_Tb_
+	double ln_Tb0_ = 0.0;
+	double dln_Tb_ = 0.0;
+	double inv_dln_Tb_ = 0.0;
+
+	/// ln Ts at the grid nodes.
+	std::vector<double> ln_Ts_;
+};
+// -------------------------------------------------------
+} // namespace CompactStar::Physics::Driver::Thermal::Boundary
+
+#endif /* CompactStar_Physics_Driver_Thermal_Boundary_EnvelopeBoundaryCache_H */
@@ -0,0 +1,167 @@
+// -*- lsst-c++ -*-
+/*
+ * CompactStar
+ * See License file at the top of the source tree.
+ *
+ * Copyright (c) 2025
+ * Mohammadreza Zakeri
+ *
+ * MIT License — see LICENSE at repo root.
+ */
+
+/**
+ * @file EnvelopeBoundaryCache.cpp
+ * @brief Build and lookup for the per-star envelope boundary cache.
+ *
+ * Build() performs the only profile scan (FindTbIndex) and the only calls to
+ * SurfaceGravity_g14() and the envelope fit. Lookups are O(1): the ln Tb grid is
+ * uniform, so the bracketing node is obtained by a multiply and a floor.
+ */
+
+#include "CompactStar/Physics/Driver/Thermal/Boundary/EnvelopeBoundaryCache.hpp"
+
+#include "CompactStar/Physics/Driver/Thermal/Boundary/IEnvelope.hpp"
+#include "CompactStar/Physics/Driver/Thermal/Boundary/SurfaceGravity.hpp"
+
+#include "CompactStar/Physics/Evolution/GeometryCache.hpp"
+#include "CompactStar/Physics/Evolution/StarContext.hpp"
+
+#include <cmath>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include <Zaki/Util/Instrumentor.hpp>
+
+namespace CompactStar::Physics::Driver::Thermal::Boundary
+{
+// -------------------------------------------------------
+void EnvelopeBoundaryCache::Build(const Evolution::StarContext &star,
+								  const Evolution::GeometryCache *geo,
+								  const TbDefinition &def,
+								  const IEnvelope &env,
+								  double xi)
+{
+	Build(star, geo, def, env, xi, TableOptions{});
+}
+
+// -------------------------------------------------------
+void EnvelopeBoundaryCache::Build(const Evolution::StarContext &star,
+								  const Evolution::GeometryCache *geo,
+								  const TbDefinition &def,
+								  const IEnvelope &env,
+								  double xi,
+								  const TableOptions &tab)
+{
+	PROFILE_FUNCTION();
+
+	Clear();
+
+	if (!def.assume_isothermal_redshifted)
+	{
+		throw std::runtime_error(
+			"EnvelopeBoundaryCache::Build: assume_isothermal_redshifted=false not implemented.");
+	}
+
+	if (tab.n_nodes < 2 || !(tab.Tb_min_K > 0.0) || !(tab.Tb_max_K > tab.Tb_min_K))
+	{
+		throw std::runtime_error("EnvelopeBoundaryCache::Build: invalid TableOptions.");
+	}
+
+	// ---------------------------------------------------------------------
+	// 1) Base-of-envelope index and redshift factor (same policy as ComputeTb)
+	// ---------------------------------------------------------------------
+	const std::size_t i_b = FindTbIndex(star, def.rho_b);
+
+	double expnu_b = 0.0;
+	if (def.prefer_geometry_cache && geo && geo->ExpNu().Size() > i_b)
+		expnu_b = geo->ExpNu()[i_b];
+	else
+		expnu_b = std::exp((*star.Nu())[i_b]);
+
+	if (!(expnu_b > 0.0) || !std::isfinite(expnu_b))
+		throw std::runtime_error("EnvelopeBoundaryCache::Build: exp(nu) at base-of-envelope is invalid.");
+
+	// ---------------------------------------------------------------------
+	// 2) Surface gravity
+	// ---------------------------------------------------------------------
+	const double g14 = SurfaceGravity_g14(star, geo);
+
+	// ---------------------------------------------------------------------
+	// 3) ln Ts on a uniform ln Tb grid
+	// ---------------------------------------------------------------------
+	const std::size_t n = tab.n_nodes;
+	const double ln_Tb0 = std::log(tab.Tb_min_K);
+	const double dln_Tb = (std::log(tab.Tb_max_K) - ln_Tb0) / static_cast<double>(n - 1);
+
+	std::vector<double> ln_Ts(n);
+	for (std::size_t k = 0; k < n; ++k)
+	{
+		const double Tb = std::exp(ln_Tb0 + static_cast<double>(k) * dln_Tb);
+		const double Ts = env.Ts_from_Tb(Tb, g14, xi);
+		if (!(Ts > 0.0) || !std::isfinite(Ts))
+		{
+			throw std::runtime_error("EnvelopeBoundaryCache::Build: envelope returned Ts <= 0 at Tb = " +
+									 std::to_string(Tb) + " K.");
+		}
+		ln_Ts[k] = std::log(Ts);
+	}
+
+	// ---------------------------------------------------------------------
+	// 4) Commit
+	// ---------------------------------------------------------------------
+	i_b_ = i_b;
+	expnu_b_ = expnu_b;
+	inv_expnu_b_ = 1.0 / expnu_b;
+	g14_ = g14;
+	rho_b_ = def.rho_b;
+	xi_ = xi;
+
+	ln_Tb0_ = ln_Tb0;
+	dln_Tb_ = dln_Tb;
+	inv_dln_Tb_ = 1.0 / dln_Tb;
+	ln_Ts_ = std::move(ln_Ts);
+
+	built_ = true;
+}
+
+// -------------------------------------------------------
+void EnvelopeBoundaryCache::Clear()
+{
+	built_ = false;
+	i_b_ = 0;
+	expnu_b_ = 0.0;
+	inv_expnu_b_ = 0.0;
+	g14_ = 0.0;
+	rho_b_ = 0.0;
+	xi_ = 0.0;
+	ln_Tb0_ = 0.0;
+	dln_Tb_ = 0.0;
+	inv_dln_Tb_ = 0.0;
+	ln_Ts_.clear();
+}
+
+// -------------------------------------------------------
+double EnvelopeBoundaryCache::Ts_from_Tb(double Tb_K) const
+{
+	if (!built_ || !(Tb_K > 0.0))
+		return 0.0;
+
+	const double u = (std::log(Tb_K) - ln_Tb0_) * inv_dln_Tb_;
+
+	// Clamp the segment index to [0, n-2]; u outside [0, n-1] extrapolates
+	// the end segment (local power law).
+	const std::size_t n_seg = ln_Ts_.size() - 1;
+	double fk = std::floor(u);
+	if (fk < 0.0)
+		fk = 0.0;
+	else if (fk > static_cast<double>(n_seg - 1))
+		fk = static_cast<double>(n_seg - 1);
+
+	const std::size_t k = static_cast<std::size_t>(fk);
+	const double w = u - fk;
+
+	return std::exp(ln_Ts_[k] + w * (ln_Ts_[k + 1] - ln_Ts_[k]));
+}
+// -------------------------------------------------------
+} // namespace CompactStar::Physics::Driver::Thermal::Boundary
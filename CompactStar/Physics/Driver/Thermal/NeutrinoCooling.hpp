@@ -64,6 +64,8 @@
 #include <vector>
 
 #include "CompactStar/Physics/Driver/IDriver.hpp"
+#include "CompactStar/Physics/Driver/LazyTable.hpp"
+#include "CompactStar/Physics/Driver/Thermal/NeutrinoCoolingKernel.hpp"
 #include "CompactStar/Physics/State/Tags.hpp"
 
 // IDriverDiagnostics interface (same base as PhotonCooling)
@@ -90,8 +92,8 @@ namespace CompactStar::Physics::Driver::Thermal
  * 3. Accumulates the derived \(dx/dt = d/dt\ln(T_\infty/T_{\rm ref})\) into the RHS.
  *
  * ### What this driver does not do (yet)
- * - It does not implement the full microphysics emissivity set by default.
- * - It does not compute \(C_{\rm eff}\) from EOS/microphysics unless you wire it.
+ * - It does not apply superfluid/superconducting reduction factors (PBF is a stub).
+ * - It does not evolve a non-isothermal core (T(r) = T̃ e^{-ν(r)} is assumed).
  * - It does not modify structure (TOV/geometry profiles).
  *
  * ### Determinism contract
@@ -123,8 +125,24 @@ class NeutrinoCooling final : public IDriver,
 		/// Enable pair-breaking/formation contribution (future superfluid hook).
 		bool include_pair_breaking = false;
 
+		/// Enable nucleon (nn, np, pp) bremsstrahlung.
+		bool include_bremsstrahlung = true;
+
 		/// Dimensionless multiplicative scale applied to the net cooling rate.
 		double global_scale = 1.0;
+
+		/**
+		 * @brief If true, use the kernel heat capacity C(T̃) integrated over the star.
+		 *
+		 * If false, the constant `C_eff` below is used (same role as in PhotonCooling).
+		 */
+		bool use_structure_heat_capacity = true;
+
+		/// Constant effective heat capacity [erg/K] used when use_structure_heat_capacity == false.
+		double C_eff = 1.0e40;
+
+		/// Microphysics parameters of the radial kernel (effective masses, fallback composition).
+		NeutrinoCoolingKernel::Params kernel{};
 	};
 
 	/**
@@ -201,8 +219,27 @@ class NeutrinoCooling final : public IDriver,
 	/// Get current configuration options.
 	[[nodiscard]] const Options &GetOptions() const { return opts_; }
 
-	/// Replace configuration options.
-	void SetOptions(const Options &o) { opts_ = o; }
+	/// Replace configuration options (invalidates the radial kernel).
+	void SetOptions(const Options &o)
+	{
+		opts_ = o;
+		kernel_.Reset();
+	}
+
+	// -------------------------------------------------------------------------
+	// Radial kernel
+	// -------------------------------------------------------------------------
+
+	/**
+	 * @brief Per-star radial weights for L_ν(T̃) and C(T̃).
+	 *
+	 * Built lazily on the first call for a given (ctx.star, ctx.geo) pair and
+	 * reused by every subsequent RHS evaluation (no lock after the build).
+	 *
+	 * @return nullptr if ctx.star or ctx.geo is null.
+	 * @throws std::runtime_error if the star lacks the columns the kernel needs.
+	 */
+	const NeutrinoCoolingKernel *Kernel(const Evolution::DriverContext &ctx) const;
 
 	// -------------------------------------------------------------------------
 	// IDriverDiagnostics interface
@@ -250,6 +287,9 @@ class NeutrinoCooling final : public IDriver,
 	/// Stored configuration.
 	Options opts_{};
 
+	/// Radial kernel, built lazily per (ctx.star, ctx.geo).
+	LazyTable<NeutrinoCoolingKernel> kernel_;
+
 	/// Allow the Details bundle to access private members if needed.
 	friend struct CompactStar::Physics::Driver::Thermal::Detail::NeutrinoCooling_Details;
 };
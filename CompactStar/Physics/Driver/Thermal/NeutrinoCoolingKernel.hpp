@@ -0,0 +1,163 @@
+#pragma once
+// -*- lsst-c++ -*-
+/*
+ * CompactStar
+ * See License file at the top of the source tree.
+ *
+ * Copyright (c) 2025
+ * Mohammadreza Zakeri
+ *
+ * MIT License — see LICENSE at repo root.
+ */
+
+/**
+ * @file NeutrinoCoolingKernel.hpp
+ * @brief Precomputed radial weights for the core neutrino luminosity and heat capacity.
+ *
+ * @ingroup PhysicsDriver
+ *
+ * For an isothermal (redshifted) core the local temperature is
+ *
+ *   T(r) = T̃ e^{-ν(r)},   T̃ ≡ T_inf,
+ *
+ * and every standard slow/fast neutrino emissivity factorizes as
+ * Q(r, T) = q(r) T9^k. The luminosity at infinity and the heat capacity
+ *
+ *   L_inf(T̃) = Σ_i Q_i(T_i) e^{2ν_i} dV_i
+ *   C(T̃)     = Σ_i c_v,i(T_i) dV_i
+ *
+ * therefore reduce to
+ *
+ *   L_DU  = T̃9^6 · Σ_i w_DU,i      w_DU,i   = q_DU,i  · mask_i · e^{-4ν_i} dV_i
+ *   L_MU  = T̃9^8 · Σ_i w_MU,i      w_MU,i   = q_MU,i  · e^{-6ν_i} dV_i
+ *   L_br  = T̃9^8 · Σ_i w_br,i      w_br,i   = q_br,i  · e^{-6ν_i} dV_i
+ *   C     = T̃    · Σ_i w_C,i       w_C,i    = c0_i    · e^{-ν_i}  dV_i
+ *
+ * The per-shell weights (contiguous arrays) and their sums are built once per
+ * star; at run time the kernel only evaluates two powers of T̃.
+ *
+ * Microphysics (Yakovlev et al. 2001, Phys. Rep. 354, 1):
+ *  - DUrca:  q = 4.0e27 (m*_n m*_p) (n_e/n0)^{1/3}, gated by the DUrca mask
+ *            (Core::StarBuilder::BuildDurcaMask).
+ *  - MUrca:  neutron branch 8.05e21 (m*_n)^3 m*_p (n_p/n0)^{1/3} α_n β_n, plus the
+ *            proton branch above its kinematic threshold.
+ *  - Brems.: nn, np and pp nucleon bremsstrahlung.
+ *  - c_v:    degenerate nucleons (m* p_F k_B^2 T / 3ħ^3) and ultra-relativistic electrons.
+ * No superfluid reduction factors are applied.
+ *
+ * Species fractions are read from the StarContext species columns "10" (n),
+ * "11" (p) and "0" (e). If they are missing, a constant proton fraction
+ * (Params::fallback_proton_fraction, with Y_e = Y_p) is assumed.
+ */
+
+#include <cstddef>
+#include <vector>
+
+namespace CompactStar::Physics::Evolution
+{
+class StarContext;
+class GeometryCache;
+} // namespace CompactStar::Physics::Evolution
+
+namespace CompactStar::Physics::Driver::Thermal
+{
+
+/**
+ * @class NeutrinoCoolingKernel
+ * @brief Per-star radial weights for L_ν(T̃) and C(T̃).
+ */
+class NeutrinoCoolingKernel
+{
+  public:
+	/**
+	 * @brief Microphysics parameters used to build the weights.
+	 */
+	struct Params
+	{
+		/// Neutron effective-mass ratio m*_n / m_n.
+		double m_star_n = 0.7;
+
+		/// Proton effective-mass ratio m*_p / m_p.
+		double m_star_p = 0.7;
+
+		/// Proton (= electron) fraction used when species columns are absent.
+		double fallback_proton_fraction = 0.05;
+	};
+
+	/**
+	 * @brief Result of a kernel evaluation at a given T̃.
+	 */
+	struct Result
+	{
+		double L_DU_erg_s = 0.0;   ///< direct Urca luminosity at infinity
+		double L_MU_erg_s = 0.0;   ///< modified Urca luminosity at infinity
+		double L_brem_erg_s = 0.0; ///< nucleon bremsstrahlung luminosity at infinity
+		double C_erg_K = 0.0;	   ///< total heat capacity
+	};
+
+	NeutrinoCoolingKernel() = default;
+
+	/**
+	 * @brief Build per-shell weights for one star.
+	 *
+	 * @param star StarContext (baryon density, species fractions, profile).
+	 * @param geo  GeometryCache (r, exp(ν), proper-volume weight WV).
+	 * @param par  Microphysics parameters.
+	 *
+	 * @throws std::runtime_error if the baryon density column is missing or the
+	 *         star/geometry grids are inconsistent.
+	 */
+	void Build(const Evolution::StarContext &star,
+			   const Evolution::GeometryCache &geo,
+			   const Params &par);
+
+	/// Drop all weights (IsBuilt() becomes false).
+	void Clear();
+
+	/// True after a successful Build().
+	bool IsBuilt() const { return built_; }
+
+	/// Number of radial shells.
+	std::size_t Size() const { return dV_cm3_.size(); }
+
+	/// True if species fractions came from the profile (not the fallback).
+	bool HasComposition() const { return has_composition_; }
+
+	/// Number of shells inside the DUrca region.
+	std::size_t NumDurcaShells() const { return n_durca_; }
+
+	/**
+	 * @brief Evaluate luminosities at infinity and heat capacity at T̃ [K].
+	 */
+	Result Evaluate(double Tinf_K) const;
+
+	/// @name Per-shell weights (read-only; see file comment for definitions)
+	/// @{
+	const std::vector<double> &ProperVolume_cm3() const { return dV_cm3_; }
+	const std::vector<double> &DurcaMask() const { return durca_mask_; }
+	const std::vector<double> &WeightDU() const { return w_DU_; }
+	const std::vector<double> &WeightMU() const { return w_MU_; }
+	const std::vector<double> &WeightBrem() const { return w_brem_; }
+	const std::vector<double> &WeightC() const { return w_C_; }
+	/// @}
+
+  private:
+	bool built_ = false;
+	bool has_composition_ = false;
+	std::size_t n_durca_ = 0;
+
+	std::vector<double> dV_cm3_;
+	std::vector<double> durca_mask_;
+	std::vector<double> w_DU_;
+	std::vector<double> w_MU_;
+	std::vector<double> w_brem_;
+	std::vector<double> w_C_;
+
+	// Σ_i of each weight array (T̃-independent).
+	double A_DU_ = 0.0;
+	double A_MU_ = 0.0;
+	double A_brem_ = 0.0;
+	double A_C_ = 0.0;
+};
+
+} // namespace CompactStar::Physics::Driver::Thermal
@@ -98,6 +98,9 @@ struct NeutrinoCooling_Details
 	/// Optional partition: pair breaking/formation (future), [erg/s].
 	double L_nu_PBF_inf_erg_s = 0.0;
 
+	/// Optional partition: nucleon bremsstrahlung, [erg/s].
+	double L_nu_brem_inf_erg_s = 0.0;
+
 	// ---------------------------------------------------------------------
 	// Evolution RHS contribution
 	// ---------------------------------------------------------------------
@@ -123,7 +126,7 @@ struct NeutrinoCooling_Details
  * This function should:
  * 1) extract Tinf from ThermalState,
  * 2) validate driver options (C_eff, global_scale, enabled channels),
- * 3) compute L_nu_inf by integrating emissivities over proper volume (future),
+ * 3) evaluate L_nu_inf and C(Tinf) from the driver's per-star radial kernel,
  * 4) convert to dTinf/dt = -L_nu_inf / C_eff,
  * 5) convert to d/dt ln(Tinf/Tref) = (1/Tinf) dTinf/dt.
  *
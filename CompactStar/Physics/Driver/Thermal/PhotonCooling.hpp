@@ -96,6 +96,8 @@
 
 #include "CompactStar/Physics/Driver/Diagnostics/DriverDiagnostics.hpp"
 #include "CompactStar/Physics/Driver/IDriver.hpp"
+#include "CompactStar/Physics/Driver/LazyTable.hpp"
+#include "CompactStar/Physics/Driver/Thermal/Boundary/EnvelopeBoundaryCache.hpp"
 #include "CompactStar/Physics/State/Tags.hpp"
 
 namespace CompactStar::Physics::Driver::Thermal::Detail
@@ -328,8 +330,29 @@ class PhotonCooling final : public IDriver,
 	/// Current options (read-only).
 	const Options &GetOptions() const { return opts_; }
 
-	/// Replace options.
-	void SetOptions(const Options &o) { opts_ = o; }
+	/// Replace options (invalidates the envelope boundary cache).
+	void SetOptions(const Options &o)
+	{
+		opts_ = o;
+		env_cache_.Reset();
+	}
+
+	// --------------------------------------------------------------
+	//  Envelope boundary cache (SurfaceModel::EnvelopeTbTs)
+	// --------------------------------------------------------------
+
+	/**
+	 * @brief Per-star envelope boundary cache (Tb index, g14, ν_b, Ts(Tb) table).
+	 *
+	 * Built lazily on the first call for a given (ctx.star, ctx.geo) pair and
+	 * reused for every subsequent RHS evaluation; rebuilt only if the context
+	 * points to a different star/geometry or SetOptions() is called. Lookups
+	 * after the build take no lock (LazyTable).
+	 *
+	 * @return nullptr if ctx.star is null or EnvelopeModel::Custom is selected.
+	 * @throws std::runtime_error if the boundary cannot be located in the profile.
+	 */
+	const Boundary::EnvelopeBoundaryCache *EnvelopeCache(const Evolution::DriverContext &ctx) const;
 
 	// --------------------------------------------------------------
 	//  Diagnostics interface (IDriverDiagnostics)
@@ -346,6 +369,9 @@ class PhotonCooling final : public IDriver,
   private:
 	Options opts_{};
 
+	/// Boundary data, built lazily per (ctx.star, ctx.geo).
+	LazyTable<Boundary::EnvelopeBoundaryCache> env_cache_;
+
 	// Allow details layer to access internals (constants/helpers) without bloating the header.
 	friend struct CompactStar::Physics::Driver::Thermal::Detail::PhotonCooling_Details;
 };
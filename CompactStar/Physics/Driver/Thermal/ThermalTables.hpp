@@ -0,0 +1,196 @@
+// -*- lsst-c++ -*-
+/*
+ * CompactStar
+ * See License file at the top of the source tree.
+ *
+ * Copyright (c) 2025
+ * Mohammadreza Zakeri
+ *
+ * MIT License — see LICENSE at repo root.
+ */
+
+/**
+ * @file ThermalTables.hpp
+ * @brief Per-star tables of C(T̃), L_ν(T̃) and L_γ(T̃) on a log-T grid.
+ *
+ * @ingroup PhysicsDriver
+ *
+ * Without superfluidity the NeutrinoCoolingKernel sums reduce C and L_ν to
+ * pure powers of T̃. Superfluid reduction factors R(T/T_c(r)) break this:
+ * each value then needs a radial integral, which is too costly per RHS call.
+ * ThermalTables does those integrals once per star on a uniform ln T̃ grid,
+ *
+ *   C(T̃)    = Σ_i w_C,i  T̃     R_C (i, T̃ e^{-ν_i})
+ *   L_DU(T̃) = Σ_i w_DU,i T̃9^6  R_DU(i, T̃ e^{-ν_i})
+ *   L_MU(T̃) = Σ_i w_MU,i T̃9^8  R_MU(i, T̃ e^{-ν_i})
+ *   L_br(T̃) = Σ_i w_br,i T̃9^8  R_MU(i, T̃ e^{-ν_i})
+ *   L_γ(T̃)  = photon_luminosity(T̃)          (optional)
+ *
+ * (w from NeutrinoCoolingKernel; R = 1 when no hook is set), and interpolates
+ * ln Q(ln T̃) with monotone piecewise-cubic Hermite polynomials
+ * (Fritsch–Carlson limited slopes), so tabulated luminosities and heat
+ * capacities never acquire spurious extrema. Outside the grid the end
+ * slopes are extrapolated, i.e. a local power law is assumed.
+ *
+ * A table is built once per star and shared by every thermal driver through
+ * DriverContext::thermal_tables (NeutrinoCooling and PhotonCooling use it
+ * when it is set).
+ */
+
+#ifndef CompactStar_Physics_Driver_Thermal_ThermalTables_H
+#define CompactStar_Physics_Driver_Thermal_ThermalTables_H
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+#include "CompactStar/Physics/Driver/Thermal/NeutrinoCoolingKernel.hpp"
+
+namespace CompactStar::Physics::Evolution
+{
+class StarContext;
+class GeometryCache;
+} // namespace CompactStar::Physics::Evolution
+
+namespace CompactStar::Physics::Driver::Thermal
+{
+
+/**
+ * @class ThermalTables
+ * @brief Tabulated, monotone-interpolated C(T̃), L_ν(T̃) and L_γ(T̃) for one star.
+ */
+class ThermalTables
+{
+  public:
+	/// Superfluid reduction factor of shell @p i at local temperature T [K].
+	using ReductionFn = std::function<double(std::size_t shell, double T_local_K)>;
+
+	/// Photon luminosity at infinity [erg/s] as a function of T̃ [K].
+	using PhotonFn = std::function<double(double Tinf_K)>;
+
+	/**
+	 * @brief Resolution of the ln T̃ grid.
+	 */
+	struct TableOptions
+	{
+		/// Lower edge of the tabulated T̃ range [K].
+		double Tinf_min_K = 1.0e5;
+
+		/// Upper edge of the tabulated T̃ range [K].
+		double Tinf_max_K = 1.0e10;
+
+		/// Number of nodes on the uniform ln T̃ grid (>= 2).
+		std::size_t n_nodes = 256;
+	};
+
+	/**
+	 * @brief Microphysics used to fill the tables.
+	 */
+	struct Params
+	{
+		/// Per-shell weights (effective masses, fallback composition).
+		NeutrinoCoolingKernel::Params kernel{};
+
+		/// Reduction of the heat capacity (empty = 1).
+		ReductionFn reduction_C;
+
+		/// Reduction of the direct Urca emissivity (empty = 1).
+		ReductionFn reduction_DU;
+
+		/// Reduction of modified Urca and bremsstrahlung (empty = 1).
+		ReductionFn reduction_MU;
+
+		/// Optional photon luminosity (empty = no L_γ column).
+		PhotonFn photon_luminosity;
+
+		/// Grid resolution.
+		TableOptions table{};
+	};
+
+	/**
+	 * @brief All columns at one T̃.
+	 */
+	struct Sample
+	{
+		double C_erg_K = 0.0;
+		double L_DU_erg_s = 0.0;
+		double L_MU_erg_s = 0.0;
+		double L_brem_erg_s = 0.0;
+		double L_gamma_erg_s = 0.0;
+	};
+
+	ThermalTables() = default;
+
+	/**
+	 * @brief Build the tables for one star.
+	 *
+	 * Costs n_nodes × (number of shells) hook evaluations when reduction
+	 * hooks are set, n_nodes kernel evaluations otherwise.
+	 *
+	 * @throws std::runtime_error on an invalid grid, a missing baryon density
+	 *         column or inconsistent star/geometry sizes.
+	 */
+	void Build(const Evolution::StarContext &star,
+			   const Evolution::GeometryCache &geo,
+			   const Params &par);
+
+	/// Drop all tables (IsBuilt() becomes false).
+	void Clear();
+
+	/// True after a successful Build().
+	bool IsBuilt() const { return built_; }
+
+	/// True if the L_γ column was filled.
+	bool HasPhoton() const { return has_photon_; }
+
+	/// Number of grid nodes.
+	std::size_t TableSize() const { return n_; }
+
+	/// @name Lookups at T̃ [K] (0 if not built or T̃ <= 0)
+	/// @{
+	Sample Evaluate(double Tinf_K) const;
+	double C(double Tinf_K) const { return Lookup(kC, Tinf_K); }
+	double L_nu(double Tinf_K) const;
+	double L_gamma(double Tinf_K) const { return has_photon_ ? Lookup(kGamma, Tinf_K) : 0.0; }
+	/// @}
+
+  private:
+	enum Column : std::size_t
+	{
+		kC = 0,
+		kDU,
+		kMU,
+		kBrem,
+		kGamma,
+		kNumColumns
+	};
+
+	/// Segment index and local coordinate for ln T̃.
+	void Locate(double ln_T, std::size_t &k, double &s) const;
+
+	/// Monotone-cubic value of column @p c at (k, s).
+	double Interp(std::size_t c, std::size_t k, double s) const;
+
+	/// Single-column lookup.
+	double Lookup(std::size_t c, double Tinf_K) const;
+
+	bool built_ = false;
+	bool has_photon_ = false;
+	std::size_t n_ = 0;
+
+	// Uniform ln T̃ grid: ln T̃_k = ln_T0_ + k * dln_T_
+	double ln_T0_ = 0.0;
+	double dln_T_ = 0.0;
+
+	/// ln Q_k and Fritsch–Carlson slopes d ln Q / d ln T̃ per column.
+	std::array<std::vector<double>, kNumColumns> ln_Q_;
+	std::array<std::vector<double>, kNumColumns> slope_;
+
+	/// Columns that are identically zero (e.g. no DUrca region).
+	std::array<bool, kNumColumns> zero_{};
+};
+
+} // namespace CompactStar::Physics::Driver::Thermal
+
+#endif /* CompactStar_Physics_Driver_Thermal_ThermalTables_H */
@@ -47,6 +47,7 @@
 
 #include <cmath>
 #include <limits>
+#include <string>
 
 #include "CompactStar/Physics/Evolution/DriverContext.hpp"
 #include "CompactStar/Physics/Evolution/RHSAccumulator.hpp"
@@ -115,6 +116,22 @@ void NeutrinoCooling::AccumulateRHS(double t,
 	dYdt.AddTo(State::StateTag::Thermal, 0, d.dLnTinf_dt_1_s);
 }
 
+// -----------------------------------------------------------------------------
+//  NeutrinoCooling::Kernel
+// -----------------------------------------------------------------------------
+const NeutrinoCoolingKernel *NeutrinoCooling::Kernel(const Evolution::DriverContext &ctx) const
+{
+	if (!ctx.star || !ctx.geo)
+		return nullptr;
+
+	return &kernel_.Get(ctx.star, ctx.geo, [&](NeutrinoCoolingKernel &kernel) {
+		kernel.Build(*ctx.star, *ctx.geo, opts_.kernel);
+
+		Z_LOG_INFO("NeutrinoCooling: radial kernel built (" + std::to_string(kernel.Size()) +
+				   " shells, " + std::to_string(kernel.NumDurcaShells()) + " in DUrca region).");
+	});
+}
+
 // -----------------------------------------------------------------------------
 //  IDriverDiagnostics interface
 // -----------------------------------------------------------------------------
@@ -206,6 +223,28 @@ Evolution::Diagnostics::ProducerCatalog NeutrinoCooling::DiagnosticsCatalog() co
 		pc.scalars.push_back(sd);
 	}
 
+	{
+		ScalarDescriptor sd;
+		sd.key = "L_nu_brem_inf_erg_s";
+		sd.unit = "erg/s";
+		sd.description = "Nucleon bremsstrahlung neutrino luminosity at infinity";
+		sd.source_hint = "computed";
+		sd.default_cadence = Cadence::OnChange;
+		sd.required = false;
+		pc.scalars.push_back(sd);
+	}
+
+	{
+		ScalarDescriptor sd;
+		sd.key = "C_eff_erg_K";
+		sd.unit = "erg/K";
+		sd.description = "Heat capacity used for dTinf/dt (kernel C(Tinf) or Options::C_eff)";
+		sd.source_hint = "computed";
+		sd.default_cadence = Cadence::OnChange;
+		sd.required = false;
+		pc.scalars.push_back(sd);
+	}
+
 	{
 		ScalarDescriptor sd;
 		sd.key = "dTinf_dt_K_s";
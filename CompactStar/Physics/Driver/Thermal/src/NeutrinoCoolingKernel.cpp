@@ -0,0 +1,262 @@
+// -*- lsst-c++ -*-
+/*
+ * CompactStar
+ * See License file at the top of the source tree.
+ *
+ * Copyright (c) 2025
+ * Mohammadreza Zakeri
+ *
+ * MIT License — see LICENSE at repo root.
+ */
+
+/**
+ * @file NeutrinoCoolingKernel.cpp
+ * @brief Build and evaluation of the per-star neutrino luminosity / heat-capacity weights.
+ *
+ * All temperature-independent work (Fermi momenta, emissivity prefactors,
+ * DUrca mask, redshift factors, proper volumes) happens in Build(). The weight
+ * arrays are reduced to four scalars there as well, so Evaluate() is O(1).
+ */
+
+#include "CompactStar/Physics/Driver/Thermal/NeutrinoCoolingKernel.hpp"
+
+#include "CompactStar/Core/StarBuilder.hpp"
+#include "CompactStar/Core/StarProfile.hpp"
+#include "CompactStar/Physics/Evolution/GeometryCache.hpp"
+#include "CompactStar/Physics/Evolution/StarContext.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+
+#include <Zaki/Util/Instrumentor.hpp>
+#include <Zaki/Util/Logger.hpp>
+
+namespace CompactStar::Physics::Driver::Thermal
+{
+
+namespace
+{
+// Physical constants (cgs)
+constexpr double KB_cgs = 1.380649e-16;		  ///< erg/K
+constexpr double HBAR_cgs = 1.054571817e-27;  ///< erg s
+constexpr double C_cgs = 2.99792458e10;		  ///< cm/s
+constexpr double MN_g = 1.67492749804e-24;	  ///< neutron mass [g]
+constexpr double MP_g = 1.67262192369e-24;	  ///< proton mass [g]
+constexpr double N0_fm3 = 0.16;				  ///< nuclear saturation density [fm^-3]
+constexpr double INV_FM_TO_INV_CM = 1.0e13;	  ///< fm^-1 -> cm^-1
+constexpr double KM3_TO_CM3 = 1.0e15;		  ///< km^3 -> cm^3
+
+/// Fermi wave number k_F = (3π² n)^{1/3} [fm^-1] for n in fm^-3.
+inline double FermiK(double n_fm3)
+{
+	return (n_fm3 > 0.0) ? std::cbrt(3.0 * M_PI * M_PI * n_fm3) : 0.0;
+}
+
+/// (n / n0)^{1/3}
+inline double CbrtRatio(double n_fm3)
+{
+	return (n_fm3 > 0.0) ? std::cbrt(n_fm3 / N0_fm3) : 0.0;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//  Build
+// -----------------------------------------------------------------------------
+void NeutrinoCoolingKernel::Build(const Evolution::StarContext &star,
+								  const Evolution::GeometryCache &geo,
+								  const Params &par)
+{
+	PROFILE_FUNCTION();
+
+	Clear();
+
+	const Zaki::Vector::DataColumn *nB = star.BaryonDensity();
+	if (!nB)
+		throw std::runtime_error("NeutrinoCoolingKernel::Build: StarContext has no baryon density column.");
+
+	const std::size_t n = geo.Size();
+	if (n == 0 || nB->Size() != n)
+		throw std::runtime_error("NeutrinoCoolingKernel::Build: inconsistent star/geometry grid sizes.");
+
+	// ---------------------------------------------------------------------
+	// 1) Composition (species fractions) and DUrca mask
+	// ---------------------------------------------------------------------
+	const Zaki::Vector::DataColumn *Yn = star.Species("10");
+	const Zaki::Vector::DataColumn *Yp = star.Species("11");
+	const Zaki::Vector::DataColumn *Ye = star.Species("0");
+	has_composition_ = (Yn && Yp && Ye);
+
+	std::vector<double> mask(n, 0.0);
+	bool have_mask = false;
+	if (has_composition_ && star.Profile())
+	{
+		Zaki::Vector::DataColumn durca;
+		double r_durca_km = 0.0;
+		if (Core::StarBuilder::BuildDurcaMask(star.Profile()->radial, durca, r_durca_km) &&
+			durca.Size() == n)
+		{
+			for (std::size_t i = 0; i < n; ++i)
+				mask[i] = durca[i];
+			have_mask = true;
+		}
+	}
+
+	if (!has_composition_)
+	{
+		Z_LOG_WARNING("NeutrinoCoolingKernel::Build: species columns (10, 11, 0) not found; "
+					  "using fallback proton fraction " +
+					  std::to_string(par.fallback_proton_fraction) + ".");
+	}
+
+	const double x_fb = std::clamp(par.fallback_proton_fraction, 0.0, 1.0);
+
+	// ---------------------------------------------------------------------
+	// 2) Per-shell weights
+	// ---------------------------------------------------------------------
+	const double *dV_km3 = geo.QuadWeights().Data();
+	const double *exp_nu = geo.ExpNu().Data();
+
+	const double mn = par.m_star_n;
+	const double mp = par.m_star_p;
+
+	// Emissivity prefactors (erg cm^-3 s^-1 at T9 = 1)
+	const double q_DU0 = 4.0e27 * mn * mp;
+	const double beta_n = 0.68;
+	const double q_MU0 = 8.05e21 * mn * mn * mn * mp * beta_n;
+	const double q_nn0 = 7.5e19 * std::pow(mn, 4) * 0.59 * 0.56;
+	const double q_np0 = 1.5e20 * (mn * mp) * (mn * mp) * 1.06 * 0.66;
+	const double q_pp0 = 7.5e19 * std::pow(mp, 4) * 0.11 * 0.70;
+
+	// Heat-capacity prefactors: c_v = c0 * T [erg cm^-3 K^-1]
+	const double cv_nuc = KB_cgs * KB_cgs / (3.0 * HBAR_cgs * HBAR_cgs);
+	const double cv_e = KB_cgs * KB_cgs / (3.0 * HBAR_cgs * C_cgs);
+
+	dV_cm3_.resize(n);
+	durca_mask_.resize(n);
+	w_DU_.resize(n);
+	w_MU_.resize(n);
+	w_brem_.resize(n);
+	w_C_.resize(n);
+
+	for (std::size_t i = 0; i < n; ++i)
+	{
+		const double nb = (*nB)[i];
+		const double yn = has_composition_ ? (*Yn)[i] : (1.0 - x_fb);
+		const double yp = has_composition_ ? (*Yp)[i] : x_fb;
+		const double ye = has_composition_ ? (*Ye)[i] : x_fb;
+
+		const double n_n = std::max(0.0, nb * yn);
+		const double n_p = std::max(0.0, nb * yp);
+		const double n_e = std::max(0.0, nb * ye);
+
+		const double kFn = FermiK(n_n);
+		const double kFp = FermiK(n_p);
+		const double kFe = FermiK(n_e);
+
+		// DUrca triangle condition if no profile mask could be built.
+		if (!have_mask)
+			mask[i] = (n_p > 0.0 && kFn < kFp + kFe) ? 1.0 : 0.0;
+
+		// Proper volume of the shell [cm^3]
+		const double dV = dV_km3[i] * KM3_TO_CM3;
+
+		const double expnu = exp_nu[i];
+		const double e_m1 = 1.0 / expnu;
+		const double e_m2 = e_m1 * e_m1;
+		const double e_m4 = e_m2 * e_m2;
+		const double e_m6 = e_m4 * e_m2;
+
+		// Direct Urca
+		const double q_DU = q_DU0 * CbrtRatio(n_e);
+
+		// Modified Urca: neutron branch + proton branch above threshold
+		double q_MU = 0.0;
+		if (n_n > 0.0 && n_p > 0.0)
+		{
+			const double alpha_n = 1.76 - 0.63 * std::pow(N0_fm3 / n_n, 2.0 / 3.0);
+			const double q_MUn = q_MU0 * std::max(0.0, alpha_n) * CbrtRatio(n_p);
+			q_MU = q_MUn;
+
+			if (kFe > 0.0 && kFn < 3.0 * kFp + kFe)
+			{
+				const double s = kFe + 3.0 * kFp - kFn;
+				q_MU += q_MUn * (mp * mp) / (mn * mn) * s * s / (8.0 * kFe * kFp);
+			}
+		}
+
+		// Nucleon bremsstrahlung
+		const double q_brem = q_nn0 * CbrtRatio(n_n) +
+							  q_np0 * CbrtRatio(n_p) +
+							  q_pp0 * CbrtRatio(n_p);
+
+		// Heat capacity prefactor (nucleons + electrons)
+		const double c0 = cv_nuc * (mn * MN_g * kFn + mp * MP_g * kFp) * INV_FM_TO_INV_CM +
+						  cv_e * kFe * kFe * INV_FM_TO_INV_CM * INV_FM_TO_INV_CM;
+
+		dV_cm3_[i] = dV;
+		durca_mask_[i] = mask[i];
+		w_DU_[i] = q_DU * mask[i] * e_m4 * dV;
+		w_MU_[i] = q_MU * e_m6 * dV;
+		w_brem_[i] = q_brem * e_m6 * dV;
+		w_C_[i] = c0 * e_m1 * dV;
+
+		if (mask[i] > 0.0)
+			++n_durca_;
+	}
+
+	// ---------------------------------------------------------------------
+	// 3) Reduce the weights (T̃-independent)
+	// ---------------------------------------------------------------------
+	A_DU_ = std::accumulate(w_DU_.begin(), w_DU_.end(), 0.0);
+	A_MU_ = std::accumulate(w_MU_.begin(), w_MU_.end(), 0.0);
+	A_brem_ = std::accumulate(w_brem_.begin(), w_brem_.end(), 0.0);
+	A_C_ = std::accumulate(w_C_.begin(), w_C_.end(), 0.0);
+
+	built_ = true;
+}
+
+// -----------------------------------------------------------------------------
+//  Clear
+// -----------------------------------------------------------------------------
+void NeutrinoCoolingKernel::Clear()
+{
+	built_ = false;
+	has_composition_ = false;
+	n_durca_ = 0;
+
+	dV_cm3_.clear();
+	durca_mask_.clear();
+	w_DU_.clear();
+	w_MU_.clear();
+	w_brem_.clear();
+	w_C_.clear();
+
+	A_DU_ = A_MU_ = A_brem_ = A_C_ = 0.0;
+}
+
+// -----------------------------------------------------------------------------
+//  Evaluate
+// -----------------------------------------------------------------------------
+NeutrinoCoolingKernel::Result NeutrinoCoolingKernel::Evaluate(double Tinf_K) const
+{
+	Result res;
+	if (!built_ || !(Tinf_K > 0.0))
+		return res;
+
+	const double T9 = Tinf_K * 1.0e-9;
+	const double T9_2 = T9 * T9;
+	const double T9_6 = T9_2 * T9_2 * T9_2;
+	const double T9_8 = T9_6 * T9_2;
+
+	res.L_DU_erg_s = A_DU_ * T9_6;
+	res.L_MU_erg_s = A_MU_ * T9_8;
+	res.L_brem_erg_s = A_brem_ * T9_8;
+	res.C_erg_K = A_C_ * Tinf_K;
+
+	return res;
+}
+
+} // namespace CompactStar::Physics::Driver::Thermal
@@ -21,6 +21,7 @@
 
 #include "CompactStar/Physics/Driver/Thermal/NeutrinoCooling_Details.hpp"
 #include "CompactStar/Physics/Driver/Thermal/NeutrinoCooling.hpp"
+#include "CompactStar/Physics/Driver/Thermal/ThermalTables.hpp"
 
 #include <cmath>
 #include <stdexcept>
@@ -39,31 +40,6 @@
 namespace CompactStar::Physics::Driver::Thermal::Detail
 {
 
-namespace
-{
-
-/**
- * @brief Minimal placeholder emissivity model for wiring tests.
- *
- * This exists only so the base structure (catalog/packet/timeseries) can run
- * before you plug in real emissivities.
- *
- * Replace with: DUrca/MUrca/PBF emissivities integrated over proper volume.
- *
- * @param Tinf_K Redshifted interior temperature [K].
- * @return A tiny luminosity scale [erg/s] for non-zero RHS during smoke tests.
- */
-double PlaceholderLuminosity(double Tinf_K)
-{
-	// Deliberately small-ish for stability; choose any smooth T dependence.
-	// Typical neutrino luminosities can be huge; this is not physical.
-	// L ~ 1e30 * (T/1e8)^6 erg/s as a harmless placeholder.
-	const double T8 = Tinf_K / 1.0e8;
-	return 1.0e30 * std::pow(T8, 6.0);
-}
-
-} // namespace
-
 // -----------------------------------------------------------------------------
 //  ComputeDerived
 // -----------------------------------------------------------------------------
@@ -95,31 +71,11 @@ NeutrinoCooling_Details ComputeDerived(const NeutrinoCooling &drv,
 	}
 
 	// ---------------------------------------------------------------------
-	// 2) Resolve/validate options used in RHS
+	// 2) Disabled-but-valid configurations
 	// ---------------------------------------------------------------------
-	// Your NeutrinoCooling::Options currently includes global_scale and channel toggles.
-	// You also need an effective heat capacity; choose one policy:
-	//   A) store C_eff inside NeutrinoCooling::Options (recommended for symmetry w/ PhotonCooling),
-	//   B) fetch from ctx (if you already have a thermal capacity model),
-	//   C) reuse the same C_eff as photon cooling in a shared thermal config object.
-	//
-	// For now, we assume NeutrinoCooling has a C_eff accessor or that you will add it.
-	//
-	// If you don't have it yet, set a temporary constant here and move it later.
-	//
-	// IMPORTANT: make this match your driver header/cpp choices.
-	//
-	const double C_eff = 1.0e40; // TODO: replace with drv.GetOptions().C_eff or ctx-thermal capacity.
-	d.C_eff_erg_K = C_eff;
-
-	if (!(d.C_eff_erg_K > 0.0))
-	{
-		d.ok = false;
-		d.message = "C_eff <= 0.";
-		return d;
-	}
+	const auto &opts = drv.GetOptions();
 
-	if (!(drv.GetOptions().global_scale > 0.0))
+	if (!(opts.global_scale > 0.0))
 	{
 		// Disabled but valid: no cooling contribution.
 		d.ok = true;
@@ -131,9 +87,10 @@ NeutrinoCooling_Details ComputeDerived(const NeutrinoCooling &drv,
 	}
 
 	// If all channels disabled, treat as disabled-but-valid.
-	if (!drv.GetOptions().include_direct_urca &&
-		!drv.GetOptions().include_modified_urca &&
-		!drv.GetOptions().include_pair_breaking)
+	if (!opts.include_direct_urca &&
+		!opts.include_modified_urca &&
+		!opts.include_bremsstrahlung &&
+		!opts.include_pair_breaking)
 	{
 		d.ok = true;
 		d.message = "cooling disabled: all neutrino channels disabled by options.";
@@ -144,38 +101,58 @@ NeutrinoCooling_Details ComputeDerived(const NeutrinoCooling &drv,
 	}
 
 	// ---------------------------------------------------------------------
-	// 3) Compute neutrino luminosity at infinity (placeholder vs real)
+	// 3) Radial kernel: L_nu(Tinf) and C(Tinf)
 	// ---------------------------------------------------------------------
 	//
-	// This is where the real work will go:
-	//   - loop over radial zones
-	//   - compute local T(r) (isothermal redshifted => T_local(r) = Tinf * e^{-nu(r)})
-	//   - compute emissivities Q_nu (erg cm^-3 s^-1) per process via microphysics
-	//   - multiply by proper volume element dV_proper (cm^3)
-	//   - apply redshift factors to get L_inf
-	//
-	// For now, implement a minimal placeholder so the infrastructure runs.
+	// The kernel holds the Tinf-independent per-shell weights (e^{2nu}, dV,
+	// DUrca mask, MUrca/bremsstrahlung prefactors) built once per star; here
+	// we only evaluate T9^6, T9^8 and T against their precomputed sums.
 	//
-	(void)ctx; // placeholder until structure/microphysics are wired in
+	const NeutrinoCoolingKernel *kernel = drv.Kernel(ctx);
+	if (!kernel)
+	{
+		d.ok = false;
+		d.message = "ctx.star/ctx.geo == nullptr (structure required for neutrino luminosity).";
+		return d;
+	}
 
-	double L_DU = 0.0;
-	double L_MU = 0.0;
-	double L_PBF = 0.0;
+	d.has_structure = true;
+	d.n_zones = kernel->Size();
 
-	const double L0 = PlaceholderLuminosity(d.Tinf_K);
+	NeutrinoCoolingKernel::Result k = kernel->Evaluate(d.Tinf_K);
 
-	if (drv.GetOptions().include_direct_urca)
-		L_DU = 0.6 * L0; // arbitrary split for placeholder
-	if (drv.GetOptions().include_modified_urca)
-		L_MU = 0.4 * L0;
-	if (drv.GetOptions().include_pair_breaking)
-		L_PBF = 0.0; // keep zero until implemented
+	// Shared per-star tables (superfluid-reduced C and L_nu) take precedence.
+	if (ctx.thermal_tables && ctx.thermal_tables->IsBuilt())
+	{
+		const ThermalTables::Sample q = ctx.thermal_tables->Evaluate(d.Tinf_K);
+		k.L_DU_erg_s = q.L_DU_erg_s;
+		k.L_MU_erg_s = q.L_MU_erg_s;
+		k.L_brem_erg_s = q.L_brem_erg_s;
+		k.C_erg_K = q.C_erg_K;
+	}
+
+	d.L_nu_DU_inf_erg_s = opts.include_direct_urca ? opts.global_scale * k.L_DU_erg_s : 0.0;
+	d.L_nu_MU_inf_erg_s = opts.include_modified_urca ? opts.global_scale * k.L_MU_erg_s : 0.0;
+	d.L_nu_brem_inf_erg_s = opts.include_bremsstrahlung ? opts.global_scale * k.L_brem_erg_s : 0.0;
+	d.L_nu_PBF_inf_erg_s = 0.0; // requires superfluid gap profiles (not wired yet)
 
-	d.L_nu_DU_inf_erg_s = drv.GetOptions().global_scale * L_DU;
-	d.L_nu_MU_inf_erg_s = drv.GetOptions().global_scale * L_MU;
-	d.L_nu_PBF_inf_erg_s = drv.GetOptions().global_scale * L_PBF;
+	d.L_nu_inf_erg_s = d.L_nu_DU_inf_erg_s + d.L_nu_MU_inf_erg_s +
+					   d.L_nu_brem_inf_erg_s + d.L_nu_PBF_inf_erg_s;
 
-	d.L_nu_inf_erg_s = d.L_nu_DU_inf_erg_s + d.L_nu_MU_inf_erg_s + d.L_nu_PBF_inf_erg_s;
+	if (!kernel->HasComposition())
+		d.message = "species fractions missing; kernel uses fallback proton fraction.";
+	else if (opts.include_pair_breaking)
+		d.message = "pair breaking/formation requested but not implemented (L_PBF = 0).";
+
+	// Heat capacity: kernel C(Tinf) or the constant fallback.
+	d.C_eff_erg_K = opts.use_structure_heat_capacity ? k.C_erg_K : opts.C_eff;
+
+	if (!(d.C_eff_erg_K > 0.0))
+	{
+		d.ok = false;
+		d.message = "C_eff <= 0.";
+		return d;
+	}
 
 	// ---------------------------------------------------------------------
 	// 4) Convert to cooling rate and RHS term
@@ -235,6 +212,14 @@ void Diagnose(const NeutrinoCooling &self,
 				  "Pair breaking/formation neutrino luminosity at infinity", "computed",
 				  Evolution::Diagnostics::Cadence::OnChange);
 
+	out.AddScalar("L_nu_brem_inf_erg_s", d.L_nu_brem_inf_erg_s, "erg/s",
+				  "Nucleon bremsstrahlung neutrino luminosity at infinity", "computed",
+				  Evolution::Diagnostics::Cadence::OnChange);
+
+	out.AddScalar("C_eff_erg_K", d.C_eff_erg_K, "erg/K",
+				  "Heat capacity used for dTinf/dt (kernel C(Tinf) or Options::C_eff)", "computed",
+				  Evolution::Diagnostics::Cadence::OnChange);
+
 	out.AddScalar("dTinf_dt_K_s", d.dTinf_dt_K_s, "K/s",
 				  "NeutrinoCooling contribution to dTinf/dt", "computed");
 
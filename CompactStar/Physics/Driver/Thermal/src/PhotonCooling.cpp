@@ -55,8 +55,11 @@
 #include "CompactStar/Physics/Driver/Thermal/PhotonCooling.hpp"
 #include "CompactStar/Physics/Driver/Thermal/PhotonCooling_Details.hpp"
 
+#include "CompactStar/Physics/Driver/Thermal/Boundary/EnvelopePotekhin2003.hpp"
+
 #include <cmath> // std::pow
 #include <limits>
+#include <string>
 #include <stdexcept> // (not used here, but often used in drivers)
 
 #include "CompactStar/Physics/Evolution/DriverContext.hpp" // defines Evolution::DriverContext
@@ -141,6 +144,53 @@ void PhotonCooling::AccumulateRHS(double t,
 	dYdt.AddTo(State::StateTag::Thermal, 0, d.dLnTinf_dt_1_s);
 }
 
+// -----------------------------------------------------------------------------
+//  PhotonCooling::EnvelopeCache
+// -----------------------------------------------------------------------------
+/**
+ * @brief Return the envelope boundary cache for ctx, building it on first use.
+ *
+ * The structural part of the Tb→Ts boundary (base-of-envelope index, exp(ν_b),
+ * g14) and the envelope fit itself are independent of the evolved temperature,
+ * so they are resolved once per (star, geometry) instead of on every RHS call.
+ */
+const Boundary::EnvelopeBoundaryCache *
+PhotonCooling::EnvelopeCache(const Evolution::DriverContext &ctx) const
+{
+	if (!ctx.star)
+		return nullptr;
+
+	static const Boundary::EnvelopePotekhin2003_Iron iron{};
+	static const Boundary::EnvelopePotekhin2003_Accreted accreted{};
+
+	const Boundary::IEnvelope *model = nullptr;
+	switch (opts_.envelope)
+	{
+	case EnvelopeModel::Iron:
+		model = &iron;
+		break;
+	case EnvelopeModel::Accreted:
+		model = &accreted;
+		break;
+	case EnvelopeModel::Custom:
+	default:
+		return nullptr;
+	}
+
+	Boundary::TbDefinition def;
+	def.rho_b = opts_.rho_b;
+	def.assume_isothermal_redshifted = true;
+	def.prefer_geometry_cache = true;
+
+	return &env_cache_.Get(ctx.star, ctx.geo, [&](Boundary::EnvelopeBoundaryCache &cache) {
+		cache.Build(*ctx.star, ctx.geo, def, *model, opts_.envelope_xi);
+
+		Z_LOG_INFO("PhotonCooling: envelope boundary cache built (i_b = " +
+				   std::to_string(cache.TbIndex()) + ", g14 = " +
+				   std::to_string(cache.G14()) + ").");
+	});
+}
+
 // -----------------------------------------------------------------------------
 //  IDriverDiagnostics interface
 // -----------------------------------------------------------------------------
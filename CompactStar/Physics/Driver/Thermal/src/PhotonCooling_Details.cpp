@@ -21,11 +21,9 @@
 
 #include "CompactStar/Physics/Driver/Thermal/PhotonCooling_Details.hpp"
 #include "CompactStar/Physics/Driver/Thermal/PhotonCooling.hpp"
+#include "CompactStar/Physics/Driver/Thermal/ThermalTables.hpp"
 
-#include "CompactStar/Physics/Driver/Thermal/Boundary/EnvelopePotekhin1997.hpp" // optional
-#include "CompactStar/Physics/Driver/Thermal/Boundary/EnvelopePotekhin2003.hpp" // or 1997 if we want
-#include "CompactStar/Physics/Driver/Thermal/Boundary/SurfaceGravity.hpp"
-#include "CompactStar/Physics/Driver/Thermal/Boundary/TbDefinition.hpp"
+#include "CompactStar/Physics/Driver/Thermal/Boundary/EnvelopeBoundaryCache.hpp"
 
 #include <cmath>
 #include <string>
@@ -157,56 +155,43 @@ PhotonCooling_Details ComputeDerived(const PhotonCooling &drv,
 			return d;
 		}
 
-		// 1) Tb boundary policy (rho_b in g/cm^3)
-		Boundary::TbDefinition def;
-		def.rho_b = drv.GetOptions().rho_b;
-		def.assume_isothermal_redshifted = true;
-		def.prefer_geometry_cache = true;
-
-		// 2) Compute local Tb at rho_b
-		const double Tb_K = Boundary::ComputeTb(*ctx.star, ctx.geo, d.Tinf_K, def);
-		if (!(Tb_K > 0.0))
+		if (drv.GetOptions().envelope == PhotonCooling::EnvelopeModel::Custom)
 		{
 			d.ok = false;
-			d.message = "EnvelopeTbTs: computed Tb <= 0.";
+			d.message = "EnvelopeTbTs: EnvelopeModel::Custom selected but no custom mapping is wired.";
 			return d;
 		}
-		d.Tb_K = Tb_K;
 
-		// 3) Compute g14 at the surface
-		const double g14 = Boundary::SurfaceGravity_g14(*ctx.star, ctx.geo);
-		if (!(g14 > 0.0))
+		// Per-star cache: i_b, exp(nu_b), g14 and the Ts(Tb) table are resolved
+		// once; here we only do Tb = Tinf/exp(nu_b) and a table lookup.
+		const Boundary::EnvelopeBoundaryCache *env = drv.EnvelopeCache(ctx);
+		if (!env)
 		{
 			d.ok = false;
-			d.message = "EnvelopeTbTs: computed g14 <= 0.";
+			d.message = "EnvelopeTbTs: envelope boundary cache unavailable.";
 			return d;
 		}
-		d.g14 = g14;
 
-		// 4) Apply envelope fit
-		const double xi = drv.GetOptions().envelope_xi;
-
-		switch (drv.GetOptions().envelope)
-		{
-		case PhotonCooling::EnvelopeModel::Iron:
+		// 1) Local Tb at rho_b
+		d.Tb_K = env->Tb_from_Tinf(d.Tinf_K);
+		if (!(d.Tb_K > 0.0))
 		{
-			static const Boundary::EnvelopePotekhin2003_Iron model{};
-			d.Tsurf_K = model.Ts_from_Tb(Tb_K, g14, xi);
-			break;
+			d.ok = false;
+			d.message = "EnvelopeTbTs: computed Tb <= 0.";
+			return d;
 		}
-		case PhotonCooling::EnvelopeModel::Accreted:
+
+		// 2) g14 at the surface
+		d.g14 = env->G14();
+		if (!(d.g14 > 0.0))
 		{
-			static const Boundary::EnvelopePotekhin2003_Accreted model{};
-			d.Tsurf_K = model.Ts_from_Tb(Tb_K, g14, xi);
-			break;
-		}
-		case PhotonCooling::EnvelopeModel::Custom:
-		default:
 			d.ok = false;
-			d.message = "EnvelopeTbTs: EnvelopeModel::Custom selected but no custom mapping is wired.";
+			d.message = "EnvelopeTbTs: computed g14 <= 0.";
 			return d;
 		}
 
+		// 3) Envelope fit (tabulated)
+		d.Tsurf_K = env->Ts_from_Tb(d.Tb_K);
 		break;
 	}
 
@@ -312,12 +297,18 @@ PhotonCooling_Details ComputeDerived(const PhotonCooling &drv,
 	// ---------------------------------------------------------------------
 	// 5) Luminosity and RHS term
 	// ---------------------------------------------------------------------
-	const double T4 = std::pow(d.Tsurf_K, 4.0);
+	const double T2 = d.Tsurf_K * d.Tsurf_K;
+	const double T4 = T2 * T2;
 
 	d.L_gamma_inf_erg_s =
 		drv.GetOptions().global_scale * d.A_eff_inf_cm2 * SigmaSB_cgs * T4;
 
-	d.dTinf_dt_K_s = -d.L_gamma_inf_erg_s / drv.GetOptions().C_eff;
+	// Heat capacity: shared per-star table if available, else Options::C_eff.
+	double C_eff = drv.GetOptions().C_eff;
+	if (ctx.thermal_tables && ctx.thermal_tables->IsBuilt())
+		C_eff = ctx.thermal_tables->C(d.Tinf_K);
+
+	d.dTinf_dt_K_s = -d.L_gamma_inf_erg_s / C_eff;
 
 	// Convert physical dT/dt to log-variable RHS (ODE variable):
 	// d/dt ln(Tinf/Tref) = (1/Tinf) dTinf/dt.  (Tref constant cancels)
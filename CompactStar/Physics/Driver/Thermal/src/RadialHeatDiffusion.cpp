@@ -0,0 +1,411 @@
+// -*- lsst-c++ -*-
+/*
+ * CompactStar
+ * See License file at the top of the source tree.
+ *
+ * Copyright (c) 2025
+ * Mohammadreza Zakeri
+ *
+ * MIT License — see LICENSE at repo root.
+ */
+
+/**
+ * @file RadialHeatDiffusion.cpp
+ * @brief Implementation of the multi-zone heat-diffusion driver.
+ *
+ * Zone geometry and zone-summed kernel weights are built once per
+ * (StarContext, GeometryCache, N). Every public operation is a single pass
+ * (or a forward/backward sweep) over the zones.
+ */
+
+#include "CompactStar/Physics/Driver/Thermal/RadialHeatDiffusion.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+#include "CompactStar/Physics/Evolution/DriverContext.hpp"
+#include "CompactStar/Physics/Evolution/GeometryCache.hpp"
+#include "CompactStar/Physics/Evolution/RHSAccumulator.hpp"
+#include "CompactStar/Physics/Evolution/StateVector.hpp"
+#include "CompactStar/Physics/State/ThermalState.hpp"
+
+#include <Zaki/Util/Instrumentor.hpp> // PROFILE_FUNCTION
+#include <Zaki/Util/Logger.hpp>		  // Z_LOG_INFO/WARNING/ERROR
+
+namespace CompactStar::Physics::Driver::Thermal
+{
+
+namespace
+{
+constexpr double KM_TO_CM = 1.0e5; ///< km -> cm
+
+/// Relative step of the one-sided derivatives of the surface luminosity
+/// and heat capacity hooks.
+constexpr double kSurfaceEps = 1.0e-6;
+} // namespace
+
+// -----------------------------------------------------------------------------
+//  Zones
+// -----------------------------------------------------------------------------
+const RadialHeatDiffusion::Zones *RadialHeatDiffusion::GetZones(const Evolution::DriverContext &ctx,
+																std::size_t n_zones) const
+{
+	if (!ctx.star || !ctx.geo || n_zones == 0)
+		return nullptr;
+
+	std::lock_guard<std::mutex> lock(zones_mtx_);
+
+	if (zones_star_ == ctx.star && zones_geo_ == ctx.geo && zones_.Size() == n_zones)
+		return &zones_;
+
+	PROFILE_FUNCTION();
+
+	const Evolution::GeometryCache &geo = *ctx.geo;
+
+	NeutrinoCoolingKernel cool;
+	cool.Build(*ctx.star, geo, opts_.kernel);
+
+	const std::size_t n = cool.Size();
+	if (n < n_zones)
+		throw std::runtime_error("RadialHeatDiffusion::GetZones: " + std::to_string(n_zones) +
+								 " zones requested on a grid of " + std::to_string(n) + " shells.");
+
+	const auto &R = geo.R();
+	const double r0 = R[0];
+	const double width = (R[n - 1] - r0) / static_cast<double>(n_zones);
+
+	Zones zn;
+	zn.r_km.assign(n_zones, 0.0);
+	zn.A_C.assign(n_zones, 0.0);
+	zn.A_DU.assign(n_zones, 0.0);
+	zn.A_MU.assign(n_zones, 0.0);
+	std::vector<double> vol(n_zones, 0.0);
+
+	// ---------------------------------------------------------------------
+	// 1) Sum shell weights into equal-width radial bins
+	// ---------------------------------------------------------------------
+	for (std::size_t i = 0; i < n; ++i)
+	{
+		const std::size_t z = std::min(n_zones - 1,
+									   static_cast<std::size_t>((R[i] - r0) / width));
+		const double dV = cool.ProperVolume_cm3()[i];
+
+		vol[z] += dV;
+		zn.r_km[z] += dV * R[i];
+		zn.A_C[z] += cool.WeightC()[i];
+		zn.A_DU[z] += cool.WeightDU()[i];
+		zn.A_MU[z] += cool.WeightMU()[i] + cool.WeightBrem()[i];
+	}
+
+	for (std::size_t z = 0; z < n_zones; ++z)
+	{
+		if (!(vol[z] > 0.0))
+			throw std::runtime_error("RadialHeatDiffusion::GetZones: zone " + std::to_string(z) +
+									 " contains no grid shell; use fewer zones.");
+		zn.r_km[z] /= vol[z];
+	}
+
+	// ---------------------------------------------------------------------
+	// 2) Inner faces: geometric part of the conductance
+	// ---------------------------------------------------------------------
+	const std::size_t n_faces = n_zones - 1;
+	zn.face_r_km.resize(n_faces);
+	zn.face_geom.resize(n_faces);
+	zn.face_expnu.resize(n_faces);
+
+	std::size_t j = 0;
+	for (std::size_t f = 0; f < n_faces; ++f)
+	{
+		const double rf = r0 + static_cast<double>(f + 1) * width;
+		while (j + 1 < n && R[j + 1] <= rf)
+			++j;
+		const std::size_t k = (j + 1 < n && (R[j + 1] - rf) < (rf - R[j])) ? j + 1 : j;
+
+		const double rf_cm = rf * KM_TO_CM;
+		const double dr_cm = (zn.r_km[f + 1] - zn.r_km[f]) * KM_TO_CM;
+
+		zn.face_r_km[f] = rf;
+		zn.face_expnu[f] = geo.ExpNu()[k];
+		zn.face_geom[f] = 4.0 * M_PI * rf_cm * rf_cm * geo.ExpNuMinusLambda()[k] / dr_cm;
+	}
+
+	zones_ = std::move(zn);
+	zones_star_ = ctx.star;
+	zones_geo_ = ctx.geo;
+
+	Z_LOG_INFO("RadialHeatDiffusion: " + std::to_string(n_zones) + " zones built on " +
+			   std::to_string(n) + " grid shells.");
+
+	return &zones_;
+}
+
+// -----------------------------------------------------------------------------
+//  Microphysics hooks
+// -----------------------------------------------------------------------------
+double RadialHeatDiffusion::HeatCapacity(const Zones &zn, std::size_t z, double Tinf_K) const
+{
+	const double C = opts_.heat_capacity ? opts_.heat_capacity(z, Tinf_K)
+										 : zn.A_C[z] * Tinf_K;
+	if (!(C > 0.0))
+		throw std::runtime_error("RadialHeatDiffusion: zone " + std::to_string(z) +
+								 " has no heat capacity; use fewer zones or set Options::heat_capacity.");
+	return C;
+}
+
+//--------------------------------------------------------------
+double RadialHeatDiffusion::HeatCapacityLogSlope(const Zones &zn, std::size_t z, double Tinf_K) const
+{
+	if (!opts_.heat_capacity)
+		return 1.0;
+
+	const double C = HeatCapacity(zn, z, Tinf_K);
+	const double C_eps = HeatCapacity(zn, z, Tinf_K * (1.0 + kSurfaceEps));
+	return (C_eps - C) / (kSurfaceEps * C);
+}
+
+//--------------------------------------------------------------
+void RadialHeatDiffusion::NeutrinoLoss(const Zones &zn, std::size_t z, double Tinf_K,
+									   double &L, double &dL_dT) const
+{
+	L = 0.0;
+	dL_dT = 0.0;
+	if (!opts_.include_neutrino)
+		return;
+
+	const double T9 = Tinf_K * 1.0e-9;
+	const double T9_2 = T9 * T9;
+	const double T9_6 = T9_2 * T9_2 * T9_2;
+	const double L_DU = zn.A_DU[z] * T9_6;
+	const double L_MU = zn.A_MU[z] * T9_6 * T9_2;
+
+	L = L_DU + L_MU;
+	dL_dT = (6.0 * L_DU + 8.0 * L_MU) / Tinf_K;
+}
+
+//--------------------------------------------------------------
+double RadialHeatDiffusion::Conductance(const Zones &zn, std::size_t f, double Tinf_face_K) const
+{
+	const double T_local = Tinf_face_K / zn.face_expnu[f];
+	const double kappa = opts_.conductivity ? opts_.conductivity(zn.face_r_km[f], T_local)
+											: opts_.kappa;
+	return zn.face_geom[f] * kappa;
+}
+
+// -----------------------------------------------------------------------------
+//  RadialHeatDiffusion::AccumulateRHS
+// -----------------------------------------------------------------------------
+void RadialHeatDiffusion::AccumulateRHS(double t,
+										const Evolution::StateVector &Y,
+										Evolution::RHSAccumulator &dYdt,
+										const Evolution::DriverContext &ctx) const
+{
+	PROFILE_FUNCTION();
+
+	const auto &thermal = Y.GetThermal();
+	const std::size_t N = thermal.NumComponents();
+
+	const Zones *zn = GetZones(ctx, N);
+	if (!zn)
+		return;
+
+	const double Tref = State::ThermalState::Tref_K();
+
+	// Flux through the inner face below the current zone (G (T_z − T_{z−1})).
+	double flux_in = 0.0;
+	double T_z = Tref * std::exp(thermal.Value(0));
+
+	for (std::size_t z = 0; z < N; ++z)
+	{
+		double flux_out = 0.0;
+		double T_next = 0.0;
+		if (z + 1 < N)
+		{
+			T_next = Tref * std::exp(thermal.Value(z + 1));
+			flux_out = Conductance(*zn, z, 0.5 * (T_z + T_next)) * (T_next - T_z);
+		}
+
+		double L_nu = 0.0, dL_dT = 0.0;
+		NeutrinoLoss(*zn, z, T_z, L_nu, dL_dT);
+
+		double S = flux_out - flux_in - L_nu;
+		if (opts_.heating)
+			S += opts_.heating(z, t, T_z);
+		if (z + 1 == N && opts_.surface_luminosity)
+			S -= opts_.surface_luminosity(T_z);
+
+		const double dx = S / (HeatCapacity(*zn, z, T_z) * T_z);
+		if (std::isfinite(dx))
+			dYdt.AddTo(State::StateTag::Thermal, z, dx);
+
+		flux_in = flux_out;
+		T_z = T_next;
+	}
+}
+
+// -----------------------------------------------------------------------------
+//  RadialHeatDiffusion::JacobianBands
+// -----------------------------------------------------------------------------
+void RadialHeatDiffusion::JacobianBands(double t,
+										const Evolution::StateVector &Y,
+										const Evolution::DriverContext &ctx,
+										std::vector<double> &lower,
+										std::vector<double> &diag,
+										std::vector<double> &upper) const
+{
+	PROFILE_FUNCTION();
+
+	const auto &thermal = Y.GetThermal();
+	const std::size_t N = thermal.NumComponents();
+
+	lower.assign(N, 0.0);
+	diag.assign(N, 0.0);
+	upper.assign(N, 0.0);
+
+	const Zones *zn = GetZones(ctx, N);
+	if (!zn)
+		return;
+
+	const double Tref = State::ThermalState::Tref_K();
+	std::vector<double> T(N), G(N > 0 ? N - 1 : 0);
+	for (std::size_t z = 0; z < N; ++z)
+		T[z] = Tref * std::exp(thermal.Value(z));
+	for (std::size_t f = 0; f + 1 < N; ++f)
+		G[f] = Conductance(*zn, f, 0.5 * (T[f] + T[f + 1]));
+
+	for (std::size_t z = 0; z < N; ++z)
+	{
+		const double G_lo = (z > 0) ? G[z - 1] : 0.0;
+		const double G_hi = (z + 1 < N) ? G[z] : 0.0;
+
+		double L_nu = 0.0, dL_dT = 0.0;
+		NeutrinoLoss(*zn, z, T[z], L_nu, dL_dT);
+
+		double S = -L_nu;
+		double dS_dT = -(G_lo + G_hi) - dL_dT;
+		if (z > 0)
+			S -= G_lo * (T[z] - T[z - 1]);
+		if (z + 1 < N)
+			S += G_hi * (T[z + 1] - T[z]);
+		if (opts_.heating)
+			S += opts_.heating(z, t, T[z]);
+		if (z + 1 == N && opts_.surface_luminosity)
+		{
+			const double Ls = opts_.surface_luminosity(T[z]);
+			S -= Ls;
+			dS_dT -= (opts_.surface_luminosity(T[z] * (1.0 + kSurfaceEps)) - Ls) / (kSurfaceEps * T[z]);
+		}
+
+		const double CT = HeatCapacity(*zn, z, T[z]) * T[z];
+
+		// ẋ_z = S_z / (C_z(T_z) T_z); ∂T_j/∂x_j = T_j, so
+		// ∂ẋ_z/∂x_z = [T dS/dT − S (1 + d ln C/d ln T)] / (C T).
+		diag[z] = (dS_dT * T[z] - S * (1.0 + HeatCapacityLogSlope(*zn, z, T[z]))) / CT;
+		if (z > 0)
+			lower[z] = G_lo * T[z - 1] / CT;
+		if (z + 1 < N)
+			upper[z] = G_hi * T[z + 1] / CT;
+	}
+}
+
+// -----------------------------------------------------------------------------
+//  RadialHeatDiffusion::ImplicitStep
+// -----------------------------------------------------------------------------
+void RadialHeatDiffusion::ImplicitStep(double t, double dt,
+									   Evolution::StateVector &Y,
+									   const Evolution::DriverContext &ctx) const
+{
+	PROFILE_FUNCTION();
+
+	if (!(dt > 0.0))
+		throw std::runtime_error("RadialHeatDiffusion::ImplicitStep: dt must be positive.");
+
+	auto &thermal = Y.GetThermal();
+	const std::size_t N = thermal.NumComponents();
+	if (N == 0)
+		return;
+
+	const Zones *zn = GetZones(ctx, N);
+	if (!zn)
+		throw std::runtime_error("RadialHeatDiffusion::ImplicitStep: ctx has no star/geometry.");
+
+	const double Tref = State::ThermalState::Tref_K();
+	std::vector<double> T(N), lower(N, 0.0), diag(N, 0.0), upper(N, 0.0), rhs(N, 0.0);
+	for (std::size_t z = 0; z < N; ++z)
+		T[z] = Tref * std::exp(thermal.Value(z));
+
+	// (C/dt)(T' − T) = G⁺(T'₊ − T') − G⁻(T' − T'₋) − [L + L'(T' − T)] + H
+	for (std::size_t z = 0; z < N; ++z)
+	{
+		const double a = HeatCapacity(*zn, z, T[z]) / dt;
+
+		double L = 0.0, dL_dT = 0.0;
+		NeutrinoLoss(*zn, z, T[z], L, dL_dT);
+
+		if (z + 1 == N && opts_.surface_luminosity)
+		{
+			const double Ls = opts_.surface_luminosity(T[z]);
+			L += Ls;
+			dL_dT += (opts_.surface_luminosity(T[z] * (1.0 + kSurfaceEps)) - Ls) / (kSurfaceEps * T[z]);
+		}
+
+		diag[z] = a + dL_dT;
+		rhs[z] = a * T[z] - L + dL_dT * T[z];
+		if (opts_.heating)
+			rhs[z] += opts_.heating(z, t + dt, T[z]);
+
+		if (z + 1 < N)
+		{
+			const double G = Conductance(*zn, z, 0.5 * (T[z] + T[z + 1]));
+			diag[z] += G;
+			diag[z + 1] += G;
+			upper[z] = -G;
+			lower[z + 1] = -G;
+		}
+	}
+
+	SolveTridiagonal(lower, diag, upper, rhs);
+
+	for (std::size_t z = 0; z < N; ++z)
+	{
+		if (!(rhs[z] > 0.0) || !std::isfinite(rhs[z]))
+			throw std::runtime_error("RadialHeatDiffusion::ImplicitStep: non-positive temperature in zone " +
+									 std::to_string(z) + "; reduce dt.");
+		thermal.Value(z) = std::log(rhs[z] / Tref);
+	}
+}
+
+// -----------------------------------------------------------------------------
+//  RadialHeatDiffusion::SolveTridiagonal
+// -----------------------------------------------------------------------------
+void RadialHeatDiffusion::SolveTridiagonal(const std::vector<double> &lower,
+										   std::vector<double> &diag,
+										   const std::vector<double> &upper,
+										   std::vector<double> &rhs)
+{
+	const std::size_t n = diag.size();
+	if (lower.size() != n || upper.size() != n || rhs.size() != n)
+		throw std::runtime_error("RadialHeatDiffusion::SolveTridiagonal: band sizes differ.");
+
+	// Forward elimination
+	for (std::size_t i = 1; i < n; ++i)
+	{
+		if (diag[i - 1] == 0.0)
+			throw std::runtime_error("RadialHeatDiffusion::SolveTridiagonal: zero pivot.");
+		const double m = lower[i] / diag[i - 1];
+		diag[i] -= m * upper[i - 1];
+		rhs[i] -= m * rhs[i - 1];
+	}
+
+	// Back substitution
+	if (n == 0)
+		return;
+	if (diag[n - 1] == 0.0)
+		throw std::runtime_error("RadialHeatDiffusion::SolveTridiagonal: zero pivot.");
+	rhs[n - 1] /= diag[n - 1];
+	for (std::size_t i = n - 1; i-- > 0;)
+		rhs[i] = (rhs[i] - upper[i] * rhs[i + 1]) / diag[i];
+}
+
+} // namespace CompactStar::Physics::Driver::Thermal
@@ -0,0 +1,252 @@
+// -*- lsst-c++ -*-
+/*
+ * CompactStar
+ * See License file at the top of the source tree.
+ *
+ * Copyright (c) 2025
+ * Mohammadreza Zakeri
+ *
+ * MIT License — see LICENSE at repo root.
+ */
+
+/**
+ * @file ThermalTables.cpp
+ * @brief Build and monotone interpolation of the per-star C / L_ν / L_γ tables.
+ */
+
+#include "CompactStar/Physics/Driver/Thermal/ThermalTables.hpp"
+
+#include "CompactStar/Physics/Evolution/GeometryCache.hpp"
+#include "CompactStar/Physics/Evolution/StarContext.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+#include <Zaki/Util/Instrumentor.hpp>
+#include <Zaki/Util/Logger.hpp>
+
+namespace CompactStar::Physics::Driver::Thermal
+{
+
+namespace
+{
+/// Floor applied before taking logs (keeps suppressed entries finite).
+constexpr double kTiny = 1.0e-300;
+
+/// Fritsch–Carlson (harmonic-mean) slopes on a uniform grid of spacing h.
+std::vector<double> MonotoneSlopes(const std::vector<double> &y, double h)
+{
+	const std::size_t n = y.size();
+	std::vector<double> m(n, 0.0);
+	if (n < 2)
+		return m;
+
+	std::vector<double> delta(n - 1);
+	for (std::size_t k = 0; k + 1 < n; ++k)
+		delta[k] = (y[k + 1] - y[k]) / h;
+
+	m[0] = delta[0];
+	m[n - 1] = delta[n - 2];
+	for (std::size_t k = 1; k + 1 < n; ++k)
+	{
+		const double a = delta[k - 1];
+		const double b = delta[k];
+		m[k] = (a * b > 0.0) ? 2.0 * a * b / (a + b) : 0.0;
+	}
+	return m;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//  Build
+// -----------------------------------------------------------------------------
+void ThermalTables::Build(const Evolution::StarContext &star,
+						  const Evolution::GeometryCache &geo,
+						  const Params &par)
+{
+	PROFILE_FUNCTION();
+
+	Clear();
+
+	const TableOptions &tab = par.table;
+	if (!(tab.Tinf_min_K > 0.0) || !(tab.Tinf_max_K > tab.Tinf_min_K) || tab.n_nodes < 2)
+		throw std::runtime_error("ThermalTables::Build: invalid T grid (need 0 < Tinf_min < Tinf_max, n_nodes >= 2).");
+
+	NeutrinoCoolingKernel kernel;
+	kernel.Build(star, geo, par.kernel);
+
+	n_ = tab.n_nodes;
+	ln_T0_ = std::log(tab.Tinf_min_K);
+	dln_T_ = (std::log(tab.Tinf_max_K) - ln_T0_) / static_cast<double>(n_ - 1);
+	has_photon_ = static_cast<bool>(par.photon_luminosity);
+
+	std::array<std::vector<double>, kNumColumns> Q;
+	for (auto &col : Q)
+		col.assign(n_, 0.0);
+
+	const bool reduced = par.reduction_C || par.reduction_DU || par.reduction_MU;
+	const std::size_t n_shells = kernel.Size();
+	const double *exp_minus_nu = geo.ExpMinusNu().Data();
+
+	// ---------------------------------------------------------------------
+	// 1) Radial integrals at every grid temperature
+	// ---------------------------------------------------------------------
+	for (std::size_t k = 0; k < n_; ++k)
+	{
+		const double T = std::exp(ln_T0_ + static_cast<double>(k) * dln_T_);
+
+		if (!reduced)
+		{
+			const NeutrinoCoolingKernel::Result r = kernel.Evaluate(T);
+			Q[kC][k] = r.C_erg_K;
+			Q[kDU][k] = r.L_DU_erg_s;
+			Q[kMU][k] = r.L_MU_erg_s;
+			Q[kBrem][k] = r.L_brem_erg_s;
+		}
+		else
+		{
+			const double T9 = T * 1.0e-9;
+			const double T9_2 = T9 * T9;
+			const double T9_6 = T9_2 * T9_2 * T9_2;
+			const double T9_8 = T9_6 * T9_2;
+
+			double C = 0.0, L_DU = 0.0, L_MU = 0.0, L_brem = 0.0;
+			for (std::size_t i = 0; i < n_shells; ++i)
+			{
+				const double T_loc = T * exp_minus_nu[i];
+				const double R_C = par.reduction_C ? par.reduction_C(i, T_loc) : 1.0;
+				const double R_DU = par.reduction_DU ? par.reduction_DU(i, T_loc) : 1.0;
+				const double R_MU = par.reduction_MU ? par.reduction_MU(i, T_loc) : 1.0;
+
+				C += kernel.WeightC()[i] * R_C;
+				L_DU += kernel.WeightDU()[i] * R_DU;
+				L_MU += kernel.WeightMU()[i] * R_MU;
+				L_brem += kernel.WeightBrem()[i] * R_MU;
+			}
+
+			Q[kC][k] = C * T;
+			Q[kDU][k] = L_DU * T9_6;
+			Q[kMU][k] = L_MU * T9_8;
+			Q[kBrem][k] = L_brem * T9_8;
+		}
+
+		if (has_photon_)
+			Q[kGamma][k] = par.photon_luminosity(T);
+	}
+
+	// ---------------------------------------------------------------------
+	// 2) Log columns and monotone slopes
+	// ---------------------------------------------------------------------
+	for (std::size_t c = 0; c < kNumColumns; ++c)
+	{
+		zero_[c] = std::all_of(Q[c].begin(), Q[c].end(), [](double v) { return !(v > 0.0); });
+
+		ln_Q_[c].resize(n_);
+		for (std::size_t k = 0; k < n_; ++k)
+			ln_Q_[c][k] = std::log(std::max(Q[c][k], kTiny));
+
+		slope_[c] = MonotoneSlopes(ln_Q_[c], dln_T_);
+	}
+
+	if (zero_[kC])
+		throw std::runtime_error("ThermalTables::Build: heat capacity vanishes on the whole grid.");
+
+	built_ = true;
+
+	Z_LOG_INFO("ThermalTables: " + std::to_string(n_) + " nodes over T = [" +
+			   std::to_string(tab.Tinf_min_K) + ", " + std::to_string(tab.Tinf_max_K) + "] K" +
+			   (reduced ? " (superfluid reduction applied)" : "") +
+			   (has_photon_ ? ", with L_gamma." : "."));
+}
+
+// -----------------------------------------------------------------------------
+//  Clear
+// -----------------------------------------------------------------------------
+void ThermalTables::Clear()
+{
+	built_ = false;
+	has_photon_ = false;
+	n_ = 0;
+	ln_T0_ = dln_T_ = 0.0;
+	for (std::size_t c = 0; c < kNumColumns; ++c)
+	{
+		ln_Q_[c].clear();
+		slope_[c].clear();
+		zero_[c] = false;
+	}
+}
+
+// -----------------------------------------------------------------------------
+//  Interpolation
+// -----------------------------------------------------------------------------
+void ThermalTables::Locate(double ln_T, std::size_t &k, double &s) const
+{
+	const double u = (ln_T - ln_T0_) / dln_T_;
+	const double k_max = static_cast<double>(n_ - 2);
+	const double kf = std::clamp(std::floor(u), 0.0, k_max);
+
+	k = static_cast<std::size_t>(kf);
+	s = u - kf; // outside [0, 1] only in the end segments (extrapolation)
+}
+
+//--------------------------------------------------------------
+double ThermalTables::Interp(std::size_t c, std::size_t k, double s) const
+{
+	const std::vector<double> &y = ln_Q_[c];
+	const std::vector<double> &m = slope_[c];
+	const double h = dln_T_;
+
+	if (s < 0.0)
+		return y[k] + m[k] * s * h;
+	if (s > 1.0)
+		return y[k + 1] + m[k + 1] * (s - 1.0) * h;
+
+	const double s2 = s * s;
+	const double s3 = s2 * s;
+	return (2.0 * s3 - 3.0 * s2 + 1.0) * y[k] + (s3 - 2.0 * s2 + s) * h * m[k] +
+		   (-2.0 * s3 + 3.0 * s2) * y[k + 1] + (s3 - s2) * h * m[k + 1];
+}
+
+//--------------------------------------------------------------
+double ThermalTables::Lookup(std::size_t c, double Tinf_K) const
+{
+	if (!built_ || !(Tinf_K > 0.0) || zero_[c])
+		return 0.0;
+
+	std::size_t k = 0;
+	double s = 0.0;
+	Locate(std::log(Tinf_K), k, s);
+	return std::exp(Interp(c, k, s));
+}
+
+//--------------------------------------------------------------
+double ThermalTables::L_nu(double Tinf_K) const
+{
+	const Sample q = Evaluate(Tinf_K);
+	return q.L_DU_erg_s + q.L_MU_erg_s + q.L_brem_erg_s;
+}
+
+//--------------------------------------------------------------
+ThermalTables::Sample ThermalTables::Evaluate(double Tinf_K) const
+{
+	Sample q;
+	if (!built_ || !(Tinf_K > 0.0))
+		return q;
+
+	std::size_t k = 0;
+	double s = 0.0;
+	Locate(std::log(Tinf_K), k, s);
+
+	auto col = [&](std::size_t c) { return zero_[c] ? 0.0 : std::exp(Interp(c, k, s)); };
+
+	q.C_erg_K = col(kC);
+	q.L_DU_erg_s = col(kDU);
+	q.L_MU_erg_s = col(kMU);
+	q.L_brem_erg_s = col(kBrem);
+	q.L_gamma_erg_s = has_photon_ ? col(kGamma) : 0.0;
+	return q;
+}
+
+} // namespace CompactStar::Physics::Driver::Thermal
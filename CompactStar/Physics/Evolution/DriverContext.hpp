@@ -48,6 +48,7 @@ namespace Evolution
 {
 class StarContext;
 class GeometryCache;
+class SequenceGeometry;
 struct Config;
 
 class StateVector;	  ///< Composite view over sub-states (Spin/Thermal/Chem/…)
@@ -63,7 +64,12 @@ namespace Boundary
 {
 class IEnvelope; ///< Tb -> Ts boundary condition interface (optional in context).
 } // namespace Boundary
+class ThermalTables; ///< Per-star C(T̃), L_ν(T̃), L_γ(T̃) tables (optional in context).
 } // namespace Thermal
+namespace Chem
+{
+class BNVRateTables; ///< Per-star BNV Γ(T̃, η), L_heat(T̃, η) tables (optional in context).
+} // namespace Chem
 } // namespace Driver
 
 namespace Evolution
@@ -125,6 +131,35 @@ struct DriverContext
 	 */
 	const Driver::Thermal::Boundary::IEnvelope *envelope = nullptr;
 
+	/**
+	 * @brief Optional per-star thermal tables (heat capacity, luminosities vs T̃).
+	 *
+	 * Built once per star (ThermalTables::Build) and shared by the thermal
+	 * drivers. When set, NeutrinoCooling takes C(T̃) and L_ν(T̃) from it and
+	 * PhotonCooling takes C(T̃) from it; when nullptr each driver uses its own
+	 * kernel / options.
+	 */
+	const Driver::Thermal::ThermalTables *thermal_tables = nullptr;
+
+	/**
+	 * @brief Optional per-star BNV rate / heating tables.
+	 *
+	 * Built once per star (BNVRateTables::Build) from the BNV channels.
+	 * When set, BNVSource takes Γ(T̃, η) and L_heat(T̃, η) from it; when
+	 * nullptr BNVSource builds its own from its options.
+	 */
+	const Driver::Chem::BNVRateTables *bnv_tables = nullptr;
+
+	/**
+	 * @brief Optional structure interpolated along the star's sequence.
+	 *
+	 * For runs in which the star moves along its equilibrium sequence
+	 * (spin-down, BNV). Drivers that use it look up columns and registered
+	 * integrals at the current sequence parameter instead of reading the
+	 * frozen @ref star / @ref geo. May be nullptr.
+	 */
+	const SequenceGeometry *sequence = nullptr;
+
 	/**
 	 * @brief Global evolution configuration (policy + toggles + numerics).
 	 *
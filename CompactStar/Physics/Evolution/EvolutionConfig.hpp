@@ -42,6 +42,10 @@ namespace Evolution
  *  - Use an explicit RK method (RKF45 / RKCK / RK8PD) for non-stiff
  *    or exploratory runs.
  *  - Use MSBDF for stiff late-time thermal/chemical evolution.
+ *  - Use Auto to let GSLIntegrator switch between an explicit and an
+ *    implicit stepper as the problem becomes (non-)stiff.
+ *  - For stiff systems with a banded Jacobian (multi-zone thermal runs),
+ *    use BandedIntegrator instead of GSLIntegrator (stepper is ignored).
  */
 enum class StepperType
 {
@@ -50,7 +54,10 @@ enum class StepperType
 	RK8PD, /*!< Dormand–Prince 8(5,3) — high-accuracy explicit RK (more expensive).   */
 	RK2,   /*!< Simple RK2 (midpoint) — mainly for debugging and sanity checks.       */
 
-	MSBDF /*!< Multistep BDF — stiff solver; good default for late-time evolution.   */
+	MSBDF, /*!< Multistep BDF — stiff solver; good default for late-time evolution.  */
+
+	Auto /*!< Switch between Config::auto_explicit and Config::auto_implicit
+			  at run time from a stiffness estimate (see GSLIntegrator).     */
 };
 
 //==============================================================
@@ -78,6 +85,22 @@ enum class StepperType
  *  - `rtol, atol` : relative/absolute tolerances for adaptive stepping.
  *  - `max_steps`  : hard cap on total number of internal steps.
  *  - `dt_save`    : cadence at which we *request* output samples.
+ *  - `profile_drivers` : per-driver wall-time accounting in IntegratorStats
+ *                   (off by default: it costs two clock reads per driver
+ *                   call; call counts are always collected).
+ *  - `auto_*`     : stiffness detection for `StepperType::Auto`. Every
+ *                   `auto_check_every` accepted steps the dominant Jacobian
+ *                   eigenvalue |λ| is estimated by power iteration on
+ *                   finite-difference J·v products. The explicit stepper is
+ *                   replaced by the implicit one when h|λ| exceeds
+ *                   `auto_stiff_hlambda` (the step is stability-limited) or
+ *                   the rejected-step / RHS-call ratio over the window
+ *                   exceeds `auto_reject_ratio`; the implicit stepper is
+ *                   replaced by the explicit one when h|λ| drops below
+ *                   `auto_nonstiff_hlambda`.
+ *  - `multirate_ratio` : MultirateIntegrator groups state blocks whose
+ *                   timescales |y| / |dy/dt| lie within this factor of each
+ *                   other; groups further apart are advanced at separate rates.
  *
  * The actual integrator is implemented in `GSLIntegrator.cpp` and uses
  * these settings to construct a `gsl_odeiv2_driver`.
@@ -89,6 +112,18 @@ struct Config
 	double rtol = 1e-6;						  /*!< Relative tolerance for adaptive stepping.  */
 	double atol = 1e-10;					  /*!< Absolute tolerance for adaptive stepping.  */
 	std::size_t max_steps = 1000000;		  /*!< Safety cap on total GSL steps.            */
+	bool profile_drivers = false;			  /*!< Time each driver's AccumulateRHS (IntegratorStats, opt-in). */
+
+	// ---- Auto stepper (stepper == StepperType::Auto) ---------------------
+	StepperType auto_explicit = StepperType::RKF45; /*!< Stepper for non-stiff phases.            */
+	StepperType auto_implicit = StepperType::MSBDF; /*!< Stepper for stiff phases.                */
+	std::size_t auto_check_every = 50;				/*!< Accepted steps between stiffness checks. */
+	double auto_stiff_hlambda = 2.0;				/*!< Explicit → implicit above this h|λ|.     */
+	double auto_nonstiff_hlambda = 0.5;				/*!< Implicit → explicit below this h|λ|.     */
+	double auto_reject_ratio = 0.05;				/*!< Explicit → implicit above this rejected/RHS ratio. */
+
+	// ---- Multirate (MultirateIntegrator) ---------------------------------
+	double multirate_ratio = 100.0; /*!< Timescale separation that splits blocks into rate groups. */
 
 	// ---- Output ----------------------------------------------------------
 	double dt_save = 1.0e2; /*!< Spacing of requested saved samples (s). */
@@ -0,0 +1,124 @@
+// -*- lsst-c++ -*-
+/*
+ * CompactStar
+ * See License file at the top of the source tree.
+ *
+ * Copyright (c) 2025
+ * Mohammadreza Zakeri
+ *
+ * MIT License — see LICENSE at repo root.
+ */
+
+/**
+ * @file EvolutionEvent.hpp
+ * @brief Event functions g(t, Y) located by root finding during integration.
+ *
+ * An event fires when its function g(t, Y) changes sign across an accepted
+ * integrator step. GSLIntegrator then locates the crossing time on the
+ * cubic Hermite interpolant of the step (Illinois regula falsi, i.e.
+ * bisection-safe secant), notifies observers via IObserver::OnEvent, and
+ * performs the event's action:
+ *
+ *  - Continue : record and keep integrating.
+ *  - Stop     : end the run at the event time (state interpolated there).
+ *  - Restart  : move the state to the event time, call the event handler
+ *               (which may modify y or driver options, i.e. switch the
+ *               run to a different mode) and restart the stepper there.
+ *
+ * Typical functions:
+ *  - T_s - T_threshold           (surface temperature drops below a value),
+ *  - 2π/Ω - P_target             (spin period reaches a value),
+ *  - η_i                         (chemical imbalance changes sign).
+ *
+ * Events are registered on the EvolutionSystem, either by the user
+ * (EvolutionSystem::AddEvent) or by drivers (IDriver::RegisterEvents).
+ *
+ * @ingroup PhysicsEvolution
+ */
+
+#ifndef CompactStar_Physics_Evolution_EvolutionEvent_H
+#define CompactStar_Physics_Evolution_EvolutionEvent_H
+
+#include <cstddef>
+#include <functional>
+#include <string>
+
+namespace CompactStar::Physics::Evolution
+{
+class StateVector;
+struct DriverContext;
+
+/// Which sign changes of g trigger the event.
+enum class EventDirection
+{
+	Any,	/*!< Both - → + and + → -. */
+	Rising, /*!< Only - → +.           */
+	Falling /*!< Only + → -.           */
+};
+
+/// What the integrator does once the event is located.
+enum class EventAction
+{
+	Continue, /*!< Record and keep integrating.                          */
+	Stop,	  /*!< End the run at the event time.                        */
+	Restart	  /*!< Apply the handler at the event time and restart there. */
+};
+
+/**
+ * @struct EventSpec
+ * @brief Definition of one event function.
+ */
+struct EventSpec
+{
+	/// Event function signature: g(t, Y, ctx). Y is a view of the state at t.
+	using Function = std::function<double(double t,
+										  const StateVector &Y,
+										  const DriverContext &ctx)>;
+
+	/// Handler for EventAction::Restart: may modify the flat state y (size dim).
+	using Handler = std::function<void(double t, double *y, std::size_t dim)>;
+
+	/// Stable name (reported to observers and in IntegratorStats).
+	std::string name;
+
+	/// The event function.
+	Function g;
+
+	/// Sign changes that trigger the event.
+	EventDirection direction = EventDirection::Any;
+
+	/// Action after the event is located.
+	EventAction action = EventAction::Continue;
+
+	/// Optional handler (only used with EventAction::Restart).
+	Handler on_restart;
+
+	/// Absolute time tolerance for the root [s]; <= 0 uses a relative 1e-12 of t.
+	double t_tol = 0.0;
+};
+
+/**
+ * @struct EventRecord
+ * @brief A located event occurrence.
+ */
+struct EventRecord
+{
+	/// EventSpec::name.
+	std::string name;
+
+	/// Index of the event in EvolutionSystem::Events().
+	std::size_t index = 0;
+
+	/// Located crossing time.
+	double t = 0.0;
+
+	/// True for a - → + crossing.
+	bool rising = false;
+
+	/// Action that was taken.
+	EventAction action = EventAction::Continue;
+};
+
+} // namespace CompactStar::Physics::Evolution
+
+#endif /* CompactStar_Physics_Evolution_EvolutionEvent_H */
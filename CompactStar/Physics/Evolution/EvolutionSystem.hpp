@@ -24,12 +24,13 @@
  *
  * It does **not** implement any physics directly. The workflow is:
  *
- *  1. Unpack the flat y[] into State blocks (StatePacking::UnpackStateVector).
- *  2. Clear RHSAccumulator.
+ *  1. Alias the State blocks onto their slices of y[] and the RHSAccumulator
+ *     blocks onto their slices of dydt[] (StatePacking::BindStateViews,
+ *     StatePacking::BindRHSToArray). No data is copied.
+ *  2. Clear RHSAccumulator (zeroes dydt[] in place).
  *  3. For each driver:
  *        driver->AccumulateRHS(t, state, rhs, runtime_context);
- *  4. Scatter RHSAccumulator back into dydt[]
- *     (StatePacking::ScatterRHSFromAccumulator).
+ *  4. Release the views. dydt[] already holds the accumulated RHS.
  *
  * Designed to be wrapped by a GSL driver.
  *
@@ -39,10 +40,13 @@
 #ifndef CompactStar_Physics_Evolution_EvolutionSystem_H
 #define CompactStar_Physics_Evolution_EvolutionSystem_H
 
+#include <cstdint>
 #include <memory>
 #include <vector>
 
 #include "CompactStar/Physics/Evolution/DriverContext.hpp"
+#include "CompactStar/Physics/Evolution/EvolutionEvent.hpp"
+#include "CompactStar/Physics/Evolution/Integrator/IntegratorStats.hpp"
 
 namespace CompactStar
 {
@@ -94,9 +98,13 @@ using ObserverPtr = std::shared_ptr<Observers::IObserver>;
  * @brief GSL-compatible RHS functor for dY/dt.
  *
  * EvolutionSystem owns no physics; it only coordinates:
- *  - unpacking y[] into State blocks,
+ *  - aliasing State blocks onto y[] (zero-copy views),
  *  - invoking each IDriver to accumulate into RHSAccumulator,
- *  - scattering RHS back into dydt[].
+ *    whose blocks are bound directly onto dydt[].
+ *
+ * The State blocks are only bound for the duration of operator() and the
+ * Notify*() calls; NotifyFinish() copies the final y[] into them so they
+ * stay valid after integration.
  */
 class EvolutionSystem
 {
@@ -133,6 +141,11 @@ class EvolutionSystem
 					const StateLayout &layout,
 					std::vector<DriverPtr> drivers);
 
+	virtual ~EvolutionSystem() = default;
+
+	EvolutionSystem(const EvolutionSystem &) = delete;
+	EvolutionSystem &operator=(const EvolutionSystem &) = delete;
+
 	/**
 	 * @brief Evaluate RHS \f$\dot{y} = f(t,y)\f$.
 	 *
@@ -144,6 +157,23 @@ class EvolutionSystem
 	 */
 	int operator()(double t, const double *y, double *dydt) const;
 
+	/**
+	 * @brief Evaluate the contributions of a subset of drivers only.
+	 *
+	 * Same as operator(), but only the drivers at @p driver_indices (indices
+	 * into Drivers()) are run. Components of @p dydt that none of them
+	 * update are left at zero. Used by MultirateIntegrator to advance one
+	 * group of state blocks with just the drivers that update it.
+	 */
+	int EvaluateSubset(double t, const double *y, double *dydt,
+					   const std::vector<std::size_t> &driver_indices) const;
+
+	/// Layout of the flat y[] / dydt[] arrays.
+	[[nodiscard]] const StateLayout &Layout() const { return m_layout; }
+
+	/// Registered physics drivers (in evaluation order).
+	[[nodiscard]] const std::vector<DriverPtr> &Drivers() const { return m_drivers; }
+
 	/**
 	 * @brief Register an observer to receive evolution callbacks.
 	 *
@@ -185,8 +215,87 @@ class EvolutionSystem
 	 * @param t Final time reached.
 	 * @param y Flat state array at final time.
 	 * @param ok Whether integrator considers the run successful.
+	 * @param stats Optional integrator statistics forwarded via FinishInfo::stats.
+	 */
+	void NotifyFinish(double t, const double *y, bool ok,
+					  const IntegratorStats *stats = nullptr) const;
+
+	// ---------------------------------------------------------------------
+	//  Events
+	// ---------------------------------------------------------------------
+
+	/**
+	 * @brief Register an event function g(t, Y) located by the integrator.
+	 *
+	 * Drivers' events (IDriver::RegisterEvents) are collected at
+	 * construction; user events are appended after them.
+	 *
+	 * @throws std::runtime_error if @p ev.g is empty.
+	 */
+	void AddEvent(EventSpec ev);
+
+	/// All registered events (driver events first, then user events).
+	[[nodiscard]] const std::vector<EventSpec> &Events() const { return m_events; }
+
+	/**
+	 * @brief Evaluate every event function at (t, y).
+	 * @param g_out Output array of Events().size() values.
 	 */
-	void NotifyFinish(double t, const double *y, bool ok) const;
+	void EvaluateEvents(double t, const double *y, double *g_out) const;
+
+	/// Evaluate event @p i at (t, y).
+	[[nodiscard]] double EvaluateEvent(std::size_t i, double t, const double *y) const;
+
+	/**
+	 * @brief Notify observers that an event was located.
+	 * @param ev Located event.
+	 * @param y  Flat state array at ev.t.
+	 */
+	void NotifyEvent(const EventRecord &ev, const double *y) const;
+
+	// ---------------------------------------------------------------------
+	//  Run statistics
+	// ---------------------------------------------------------------------
+
+	/**
+	 * @brief Zero the RHS-call and per-driver counters.
+	 *
+	 * Counters are mutable (operator() is const), so this is const as well.
+	 * GSLIntegrator calls it at the start of each Integrate().
+	 */
+	void ResetStats() const;
+
+	/// Number of operator() calls since the last ResetStats().
+	[[nodiscard]] std::uint64_t NumRHSCalls() const { return m_rhs_calls; }
+
+	/// Per-driver AccumulateRHS call counts and cumulative wall time
+	/// (times are zero unless Config::profile_drivers is set).
+	[[nodiscard]] std::vector<DriverCost> DriverCosts() const;
+
+  protected:
+	/**
+	 * @brief Run every driver on the currently bound state/RHS views.
+	 *
+	 * Called once per operator() call. The default loops over Drivers()
+	 * through the IDriver interface; StaticEvolutionSystem overrides it
+	 * with a fold over statically typed drivers.
+	 */
+	virtual void AccumulateAll(double t) const;
+
+	/// @name Access for derived systems (valid while views are bound)
+	/// @{
+	[[nodiscard]] StateVector &State() const { return m_state; }
+	[[nodiscard]] RHSAccumulator &RHS() const { return m_rhs; }
+	[[nodiscard]] const DriverContext &Context() const { return m_ctx; }
+	[[nodiscard]] bool ProfilingDrivers() const { return m_profile_drivers; }
+	/// @}
+
+	/// Count one call of driver @p k and add @p seconds to its wall time.
+	void RecordDriverCall(std::size_t k, double seconds) const
+	{
+		++m_drv_calls[k];
+		m_drv_time_s[k] += seconds;
+	}
 
   private:
 	/**
@@ -196,11 +305,22 @@ class EvolutionSystem
 	 */
 	void ValidateContext() const;
 
+	/// Run driver @p k on the currently bound state/RHS views (with accounting).
+	void RunDriver(std::size_t k, double t) const;
+
 	DriverContext m_ctx;			  ///< static model context (non-owning pointers)
 	StateVector &m_state;			  ///< logical state blocks (non-owning)
 	RHSAccumulator &m_rhs;			  ///< RHS scratch storage (non-owning)
 	const StateLayout &m_layout;	  ///< y[] / dydt[] layout (non-owning)
 	std::vector<DriverPtr> m_drivers; ///< owned physics drivers
+	std::vector<EventSpec> m_events;  ///< event functions (drivers' + user)
+
+	// Low-overhead counters (plain increments; two clock reads per driver call
+	// only when Config::profile_drivers is set).
+	mutable std::uint64_t m_rhs_calls = 0;			  ///< operator() calls
+	mutable std::vector<std::uint64_t> m_drv_calls; ///< per-driver call counts
+	mutable std::vector<double> m_drv_time_s;		  ///< per-driver wall time [s]
+	bool m_profile_drivers = false;					  ///< from Config::profile_drivers
 
 	/**
 	 * @brief Registered observers (side-effectful consumers of accepted steps).
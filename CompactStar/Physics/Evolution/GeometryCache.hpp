@@ -26,7 +26,7 @@
 
 /**
  * @file GeometryCache.hpp
- * @brief Precomputed geometric factors for fast radial integration (DataColumn-native).
+ * @brief Precomputed geometric factors for fast radial integration (aligned SoA, lazy columns).
  *
  * Metric convention assumed:
  * \f[
@@ -37,14 +37,24 @@
  *  - \f$\nu(r)\f$ is the time metric exponent
  *  - \f$\Lambda(r)\f$ is the radial metric exponent
  *
- * This cache stores primitive, reusable columns:
- *  - \f$r\f$ (km)
+ * Storage is structure-of-arrays: every column is one contiguous,
+ * cache-line-aligned array of N doubles, so radial reductions stream
+ * through memory and vectorise.
+ *
+ * Primitive columns (built eagerly in the constructor):
+ *  - \f$r\f$ (km), \f$m\f$ (km), \f$\nu\f$, \f$\Lambda\f$
+ *
+ * Derived columns (built lazily, once, on first request):
  *  - \f$A(r)=4\pi r^2\f$
  *  - \f$e^{\nu}\f$, \f$e^{-\nu}\f$, \f$e^{2\nu}\f$
  *  - \f$e^{\Lambda}\f$, \f$e^{-\Lambda}\f$
  *  - \f$e^{\nu-\Lambda}\f$, \f$e^{-(\nu+\Lambda)}\f$
  *  - \f$w_V(r)=4\pi r^2 e^{\Lambda}\f$     (proper-volume shell weight)
  *  - \f$w_V e^{\nu}\f$, \f$w_V e^{2\nu}\f$ (common redshifted variants)
+ *  - trapezoid \f$\Delta r\f$ and \f$w_V\Delta r\f$
+ *
+ * Drivers may register further derived columns by name (Register()); they
+ * are built on first Column() call and shared by every driver of the run.
  *
  * @ingroup PhysicsEvolution
  */
@@ -53,15 +63,16 @@
 #define CompactStar_Physics_Evolution_GeometryCache_H
 
 #include <Zaki/Vector/DataSet.hpp>
-#include <cstddef>
 
-// namespace Zaki
-// {
-// namespace Vector
-// {
-// class DataColumn;
-// } // namespace Vector
-// } // namespace Zaki
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <string>
+#include <vector>
 
 namespace CompactStar
 {
@@ -72,21 +83,136 @@ namespace Evolution
 
 class StarContext;
 
+namespace detail
+{
+//--------------------------------------------------------------
+/**
+ * @brief Minimal allocator returning @p Align-byte aligned storage.
+ */
+template <class T, std::size_t Align>
+struct AlignedAllocator
+{
+	using value_type = T;
+
+	template <class U>
+	struct rebind
+	{
+		using other = AlignedAllocator<U, Align>;
+	};
+
+	AlignedAllocator() noexcept = default;
+	template <class U>
+	AlignedAllocator(const AlignedAllocator<U, Align> &) noexcept {}
+
+	T *allocate(std::size_t n)
+	{
+		return static_cast<T *>(::operator new(n * sizeof(T), std::align_val_t(Align)));
+	}
+	void deallocate(T *p, std::size_t) noexcept
+	{
+		::operator delete(p, std::align_val_t(Align));
+	}
+
+	template <class U>
+	bool operator==(const AlignedAllocator<U, Align> &) const noexcept { return true; }
+	template <class U>
+	bool operator!=(const AlignedAllocator<U, Align> &) const noexcept { return false; }
+};
+} // namespace detail
+
+//--------------------------------------------------------------
+/**
+ * @class GeometryColumn
+ * @brief Non-owning read-only view of one GeometryCache column.
+ *
+ * Valid as long as the owning GeometryCache lives. Indexing follows
+ * DataColumn: negative indices count from the end (`col[-1]` = surface).
+ */
+class GeometryColumn
+{
+  public:
+	GeometryColumn() = default;
+	GeometryColumn(const double *data, std::size_t n) : m_data(data), m_n(n) {}
+
+	/** @brief Number of radial samples. */
+	[[nodiscard]] std::size_t Size() const { return m_n; }
+
+	/** @brief Pointer to the first (cache-line-aligned) element. */
+	[[nodiscard]] const double *Data() const { return m_data; }
+
+	/** @brief Element @p i (negative: counted from the end). */
+	double operator[](std::ptrdiff_t i) const
+	{
+		return (i < 0) ? m_data[static_cast<std::ptrdiff_t>(m_n) + i] : m_data[i];
+	}
+
+	const double *begin() const { return m_data; }
+	const double *end() const { return m_data + m_n; }
+
+	/** @brief Copy into a DataColumn (for DataColumn algebra / output). */
+	Zaki::Vector::DataColumn ToDataColumn(const std::string &label = "") const
+	{
+		return Zaki::Vector::DataColumn(label, std::vector<double>(begin(), end()));
+	}
+
+  private:
+	const double *m_data = nullptr;
+	std::size_t m_n = 0;
+};
+
 /**
  * @class GeometryCache
  * @brief Geometry-only cached columns for repeated integrals.
  *
  * This class is intended to be:
- *  - Cheap to copy/move (columns store vectors internally),
  *  - Purely geometric (no microphysics),
- *  - DataColumn-native (supports algebra and Mathematica-like indexing).
+ *  - Built once per star and shared (by const pointer) by all drivers,
+ *  - Thread-safe: lazy builds and registrations are serialised internally,
+ *    reads of built columns are lock-free.
+ *
+ * Columns are addressed by ColumnId; the built-in ones have fixed ids
+ * (Builtin) and named accessors.
  */
 class GeometryCache
 {
   public:
+	/// Alignment of every column (bytes; one cache line, >= widest SIMD register).
+	static constexpr std::size_t kAlignment = 64;
+
+	/// Maximum number of columns (built-in + registered).
+	static constexpr std::size_t kMaxColumns = 64;
+
+	using Buffer = std::vector<double, detail::AlignedAllocator<double, kAlignment>>;
+	using ColumnId = std::size_t;
+
+	/// Fill @p out[0..geo.Size()) with the column values; may read other columns of @p geo.
+	using Builder = std::function<void(const GeometryCache &geo, double *out)>;
+
+	/// Returned by Find() for unknown names.
+	static constexpr ColumnId kNoColumn = static_cast<ColumnId>(-1);
+
+	/// Ids of the built-in derived columns.
+	enum Builtin : ColumnId
+	{
+		kArea = 0,
+		kExpNu,
+		kExpMinusNu,
+		kExp2Nu,
+		kExpLambda,
+		kExpMinusLambda,
+		kExpNuMinusLambda,
+		kExpMinusNuMinusLambda,
+		kWV,
+		kWVExpNu,
+		kWVExp2Nu,
+		kDr,
+		kQuadWeights,
+		kNumBuiltin
+	};
+
 	//--------------------------------------------------------------
 	/**
-	 * @brief Construct and build cache columns from a StarContext.
+	 * @brief Construct from a StarContext (primitive columns only).
 	 *
 	 * Requirements:
 	 *  - ctx.Radius() != nullptr and Size() > 0
@@ -102,43 +228,123 @@ class GeometryCache
 	 */
 	explicit GeometryCache(const StarContext &ctx);
 
+	GeometryCache(const GeometryCache &) = delete;
+	GeometryCache &operator=(const GeometryCache &) = delete;
+
 	//--------------------------------------------------------------
 	/** @brief Number of radial samples (N). */
 	[[nodiscard]] std::size_t Size() const;
 
 	//--------------------------------------------------------------
-	/** @name Primitive grids / exponentials */
+	/** @name Primitive grids (eager) */
+	///@{
+	GeometryColumn R() const;	   ///< r(km)
+	GeometryColumn Mass() const;   ///< m(km) (empty if the profile has no mass column)
+	GeometryColumn Nu() const;	   ///< nu
+	GeometryColumn Lambda() const; ///< Lambda (profile or derived from m, r)
+	///@}
+
+	//--------------------------------------------------------------
+	/** @name Metric exponentials (lazy) */
+	///@{
+	GeometryColumn Area() const { return Column(kArea); }					///< 4*pi*r^2
+	GeometryColumn ExpNu() const { return Column(kExpNu); }					///< exp(nu)
+	GeometryColumn ExpMinusNu() const { return Column(kExpMinusNu); }		///< exp(-nu)
+	GeometryColumn Exp2Nu() const { return Column(kExp2Nu); }				///< exp(2*nu)
+	GeometryColumn ExpLambda() const { return Column(kExpLambda); }			///< exp(Lambda)
+	GeometryColumn ExpMinusLambda() const { return Column(kExpMinusLambda); } ///< exp(-Lambda)
+	///@}
+
+	//--------------------------------------------------------------
+	/** @name Common mixed metric products (lazy) */
+	///@{
+	GeometryColumn ExpNuMinusLambda() const { return Column(kExpNuMinusLambda); }			///< exp(nu - Lambda)
+	GeometryColumn ExpMinusNuMinusLambda() const { return Column(kExpMinusNuMinusLambda); } ///< exp(-(nu + Lambda))
+	///@}
+
+	//--------------------------------------------------------------
+	/** @name Canonical weights (lazy) */
 	///@{
-	const Zaki::Vector::DataColumn &R() const;				///< r(km)
-	const Zaki::Vector::DataColumn &Mass() const;			///< m(km)
-	const Zaki::Vector::DataColumn &Area() const;			///< 4*pi*r^2
-	const Zaki::Vector::DataColumn &ExpNu() const;			///< exp(nu)
-	const Zaki::Vector::DataColumn &ExpMinusNu() const;		///< exp(-nu)
-	const Zaki::Vector::DataColumn &Exp2Nu() const;			///< exp(2*nu)
-	const Zaki::Vector::DataColumn &ExpLambda() const;		///< exp(Lambda)
-	const Zaki::Vector::DataColumn &ExpMinusLambda() const; ///< exp(-Lambda)
+	GeometryColumn WV() const { return Column(kWV); }			  ///< 4*pi*r^2*exp(Lambda)
+	GeometryColumn WVExpNu() const { return Column(kWVExpNu); }	  ///< WV*exp(nu)
+	GeometryColumn WVExp2Nu() const { return Column(kWVExp2Nu); } ///< WV*exp(2nu)
 	///@}
 
 	//--------------------------------------------------------------
-	/** @name Common mixed metric products */
+	/**
+	 * @name Quadrature weights (lazy)
+	 *
+	 * Trapezoid weights on the (possibly non-uniform, e.g. resampled) grid:
+	 * \f$\int f\,dr \approx \sum_i f_i\,\Delta r_i\f$ and
+	 * \f$\int f\,dV \approx \sum_i f_i\,w_{V,i}\Delta r_i\f$.
+	 */
 	///@{
-	const Zaki::Vector::DataColumn &ExpNuMinusLambda() const;	   ///< exp(nu - Lambda)
-	const Zaki::Vector::DataColumn &ExpMinusNuMinusLambda() const; ///< exp(-(nu + Lambda))
+	GeometryColumn Dr() const { return Column(kDr); }					///< trapezoid Δr_i (km)
+	GeometryColumn QuadWeights() const { return Column(kQuadWeights); } ///< WV*Δr (km^3), proper volume of shell i
 	///@}
 
 	//--------------------------------------------------------------
-	/** @name Canonical weights */
+	/** @name Driver-registered columns */
 	///@{
-	const Zaki::Vector::DataColumn &WV() const;		  ///< 4*pi*r^2*exp(Lambda)
-	const Zaki::Vector::DataColumn &WVExpNu() const;  ///< WV*exp(nu)
-	const Zaki::Vector::DataColumn &WVExp2Nu() const; ///< WV*exp(2nu)
-													  ///@}
+	/**
+	 * @brief Register a derived column under @p name (built on first use).
+	 *
+	 * Registering an existing name returns its id and ignores @p build, so
+	 * drivers may call this unconditionally (e.g. from a lazy kernel build).
+	 *
+	 * @throws std::runtime_error if @p build is empty or kMaxColumns is reached.
+	 */
+	ColumnId Register(const std::string &name, Builder build) const;
+
+	/** @brief Id of column @p name, or kNoColumn. */
+	ColumnId Find(const std::string &name) const;
+
+	/**
+	 * @brief Column @p id, building it (and its dependencies) on first call.
+	 * @throws std::runtime_error for an unknown id.
+	 */
+	GeometryColumn Column(ColumnId id) const;
+
+	/** @brief Column by name. @throws std::runtime_error if not registered. */
+	GeometryColumn Column(const std::string &name) const;
+
+	/** @brief True if column @p id has been built. */
+	bool IsBuilt(ColumnId id) const;
+
+	/** @brief Number of registered columns (built-in included). */
+	std::size_t NumColumns() const;
+	///@}
+
+	//--------------------------------------------------------------
+	/**
+	 * @brief Vectorised radial reduction \f$\sum_i w_i f_i\f$ with weight column @p weight.
+	 *
+	 * @param f Array of Size() values (aligned storage not required).
+	 */
+	double WeightedSum(ColumnId weight, const double *f) const;
 
   private:
+	/// One derived column.
+	struct Slot
+	{
+		std::string name;
+		Builder build;
+		Buffer data;
+		std::atomic<bool> ready{false};
+	};
+
 	//--------------------------------------------------------------
-	/** @brief Build all cached columns (called in ctor). */
+	/** @brief Copy the primitive columns and register the built-in ones (called in ctor). */
 	void Build_(const StarContext &ctx);
 
+	//--------------------------------------------------------------
+	/** @brief Build slot @p id under the lock (no-op if already built). */
+	void Materialise_(ColumnId id) const;
+
+	//--------------------------------------------------------------
+	/** @brief Register without checks; the lock must be held. */
+	ColumnId Register_(const std::string &name, Builder build) const;
+
 	//--------------------------------------------------------------
 	/**
 	 * @brief Derive Lambda from mass and radius, row-by-row, with safety clamp.
@@ -148,38 +354,34 @@ class GeometryCache
 	 *   \Lambda_i = -\tfrac12\ln(\max(1-2m_i/r_i,\epsilon))
 	 * \f]
 	 *
-	 * @param r Radius column (km)
-	 * @param m Mass column (km)
+	 * @param r   Radius (km)
+	 * @param m   Mass (km)
+	 * @param n   Number of rows
+	 * @param out Lambda (n rows)
 	 * @param eps Clamp value for denom <= 0
 	 */
-	static Zaki::Vector::DataColumn
-	DeriveLambdaFromMR_(const Zaki::Vector::DataColumn &r,
-						const Zaki::Vector::DataColumn &m,
-						double eps = 1e-15);
+	static void DeriveLambdaFromMR_(const double *r, const double *m,
+									std::size_t n, double *out,
+									double eps = 1e-15);
 
 	//--------------------------------------------------------------
-	// Cached columns
-	Zaki::Vector::DataColumn m_r;
-	Zaki::Vector::DataColumn m_mass; // in km
-	Zaki::Vector::DataColumn m_area;
+	// Primitive columns
+	std::size_t m_n = 0;
+	Buffer m_r;
+	Buffer m_mass; // in km
+	Buffer m_nu;
+	Buffer m_lambda;
 
-	Zaki::Vector::DataColumn m_expNu;
-	Zaki::Vector::DataColumn m_expMinusNu;
-	Zaki::Vector::DataColumn m_exp2Nu;
-
-	Zaki::Vector::DataColumn m_expLam;
-	Zaki::Vector::DataColumn m_expMinusLam;
-
-	Zaki::Vector::DataColumn m_expNuMinusLam;
-	Zaki::Vector::DataColumn m_expMinusNuMinusLam;
-
-	Zaki::Vector::DataColumn m_wV;
-	Zaki::Vector::DataColumn m_wVExpNu;
-	Zaki::Vector::DataColumn m_wVExp2Nu;
+	//--------------------------------------------------------------
+	// Derived columns. Slots are never moved once published (fixed array),
+	// so readers only need the acquire loads of m_numSlots and Slot::ready.
+	mutable std::recursive_mutex m_mtx;
+	mutable std::array<std::unique_ptr<Slot>, kMaxColumns> m_slots;
+	mutable std::atomic<std::size_t> m_numSlots{0};
 };
 
 } // namespace Evolution
 } // namespace Physics
 } // namespace CompactStar
 
-#endif /* CompactStar_Physics_Evolution_GeometryCache_H */
\ No newline at end of file
+#endif /* CompactStar_Physics_Evolution_GeometryCache_H */
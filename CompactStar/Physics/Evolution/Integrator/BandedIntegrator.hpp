@@ -0,0 +1,112 @@
+// -*- lsst-c++ -*-
+/*
+ * CompactStar
+ * See License file at the top of the source tree.
+ *
+ * Copyright (c) 2025
+ * Mohammadreza Zakeri
+ *
+ * MIT License — see LICENSE at repo root.
+ */
+
+/**
+ * @file BandedIntegrator.hpp
+ * @brief Linearly implicit integrator for systems with a banded Jacobian.
+ *
+ * GSL's msbdf factorises a dense Jacobian built from dim + 2 RHS calls, so a
+ * stiff run with N radial zones (Thermal::RadialHeatDiffusion) costs O(N)
+ * RHS calls and O(N³) work per Jacobian. When the Jacobian is banded with
+ * lower / upper half-bandwidths (kl, ku), BandedIntegrator brings a step
+ * down to O(N):
+ *
+ *  - Jacobian by coloured finite differences: columns j ≡ c (mod kl+ku+1)
+ *    touch disjoint rows and are perturbed together, so J costs kl + ku + 1
+ *    RHS calls (3 for a tridiagonal system) whatever N is.
+ *  - W = I − γ h J is factorised by banded LU (no pivoting) in
+ *    O(N kl (kl + ku)) and solved in O(N (kl + ku)).
+ *  - Steps use the two-stage Rosenbrock W-method ROS2 (Verwer et al. 1999,
+ *    γ = 1 + 1/√2), L-stable and second order for *any* W, with the
+ *    linearly implicit Euler solution as embedded first-order estimate for
+ *    step-size control in the atol + rtol |y| norm.
+ *
+ * Because ROS2 keeps its order with an approximate Jacobian, entries outside
+ * the band (e.g. a one-component Spin block coupled to every thermal zone)
+ * may be dropped: they only cost step size, not accuracy. J is reused after
+ * a rejected step (only W is refactorised).
+ *
+ * Observers are notified as by GSLIntegrator (OnStart, OnSample every
+ * dt_save, OnFinish with IntegratorStats). Event functions and dense output
+ * are not supported.
+ *
+ * @ingroup PhysicsEvolution
+ */
+
+#ifndef CompactStar_Physics_Evolution_BandedIntegrator_H
+#define CompactStar_Physics_Evolution_BandedIntegrator_H
+
+#include <cstddef>
+
+#include "CompactStar/Physics/Evolution/Integrator/IntegratorStats.hpp"
+
+namespace CompactStar::Physics::Evolution
+{
+
+class EvolutionSystem;
+struct Config;
+
+/**
+ * @class BandedIntegrator
+ * @brief Drop-in alternative to GSLIntegrator for stiff banded systems.
+ *
+ * Usage is identical to GSLIntegrator:
+ *   - `BandedIntegrator integrator(sys, cfg, N);`  (tridiagonal by default)
+ *   - `integrator.Integrate(t0, t1, y.data(), stats);`
+ *
+ * Config::stepper is ignored; rtol, atol, max_steps and dt_save are used.
+ */
+class BandedIntegrator
+{
+  public:
+	/**
+	 * @brief Construct from RHS functor, configuration, dimension and bandwidth.
+	 *
+	 * @param sys       Reference to the evolution RHS functor.
+	 * @param cfg       Evolution configuration (tolerances, max_steps, dt_save).
+	 * @param dim       Dimension of the flat ODE vector y[] (must match StateLayout::TotalSize()).
+	 * @param lower_bw  Number of sub-diagonals kl of ∂f/∂y kept.
+	 * @param upper_bw  Number of super-diagonals ku of ∂f/∂y kept.
+	 */
+	BandedIntegrator(const EvolutionSystem &sys,
+					 const Config &cfg,
+					 std::size_t dim,
+					 std::size_t lower_bw = 1,
+					 std::size_t upper_bw = 1);
+
+	/**
+	 * @brief Integrate from t0 to t1 in-place on y[].
+	 *
+	 * @return true if the integration reached t1 successfully; false if the
+	 *         step size underflowed, the RHS failed or max_steps was exceeded.
+	 */
+	bool Integrate(double t0, double t1, double *y) const;
+
+	/**
+	 * @brief Integrate from t0 to t1 in-place on y[] and report run statistics.
+	 *
+	 * rhs_calls includes the kl + ku + 1 calls of every Jacobian.
+	 *
+	 * @return stats.ok
+	 */
+	bool Integrate(double t0, double t1, double *y, IntegratorStats &stats) const;
+
+  private:
+	const EvolutionSystem *m_sys = nullptr;
+	const Config *m_cfg = nullptr;
+	std::size_t m_dim = 0;
+	std::size_t m_kl = 1;
+	std::size_t m_ku = 1;
+};
+
+} // namespace CompactStar::Physics::Evolution
+
+#endif /* CompactStar_Physics_Evolution_BandedIntegrator_H */
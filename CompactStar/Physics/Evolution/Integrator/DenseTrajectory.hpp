@@ -0,0 +1,170 @@
+// -*- lsst-c++ -*-
+/*
+ * CompactStar
+ * See License file at the top of the source tree.
+ *
+ * Copyright (c) 2025
+ * Mohammadreza Zakeri
+ *
+ * MIT License — see LICENSE at repo root.
+ */
+
+/**
+ * @file DenseTrajectory.hpp
+ * @brief Dense output of an evolution run (cubic Hermite over accepted steps).
+ *
+ * When attached to GSLIntegrator (GSLIntegrator::RecordDenseOutput), every
+ * accepted step endpoint (t_k, y_k, f_k = dy/dt(t_k)) is appended here. On each
+ * step [t_k, t_{k+1}] the state is reconstructed with the cubic Hermite
+ * interpolant built from (y_k, f_k, y_{k+1}, f_{k+1}), which is third-order
+ * accurate and C^1 across steps. This answers questions such as "state at
+ * t = 10^3.7 yr" after the run, at any resolution, without re-integrating.
+ *
+ * Storage is structure-of-arrays: t[n], y[n*dim], f[n*dim] (row-major per
+ * step), i.e. 8 (1 + 2 dim) bytes per accepted step. Save()/Load() write and
+ * read the same arrays as a flat binary file.
+ *
+ * @ingroup PhysicsEvolution
+ */
+
+#ifndef CompactStar_Physics_Evolution_DenseTrajectory_H
+#define CompactStar_Physics_Evolution_DenseTrajectory_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace CompactStar::Physics::Evolution
+{
+class StateVector;
+class StateLayout;
+
+/**
+ * @class DenseTrajectory
+ * @brief Hermite dense-output record of a run, with point and batched queries.
+ */
+class DenseTrajectory
+{
+  public:
+	DenseTrajectory() = default;
+
+	/// Construct for a system of dimension @p dim.
+	explicit DenseTrajectory(std::size_t dim) { Reset(dim); }
+
+	// ---------------------------------------------------------------------
+	//  Recording
+	// ---------------------------------------------------------------------
+
+	/// Drop all nodes and set the system dimension.
+	void Reset(std::size_t dim);
+
+	/// Pre-allocate storage for @p n_nodes nodes.
+	void Reserve(std::size_t n_nodes);
+
+	/**
+	 * @brief Append a node (t, y, dy/dt).
+	 *
+	 * A node at the same time as the last one is kept as a jump: queries at
+	 * that time, and after it, use the newer node (e.g. after an event
+	 * handler modified the state).
+	 *
+	 * @throws std::runtime_error if the trajectory has no dimension or @p t
+	 *         decreases.
+	 */
+	void Append(double t, const double *y, const double *dydt);
+
+	// ---------------------------------------------------------------------
+	//  Queries
+	// ---------------------------------------------------------------------
+
+	[[nodiscard]] std::size_t Dim() const { return dim_; }
+	[[nodiscard]] std::size_t NumNodes() const { return t_.size(); }
+	[[nodiscard]] bool Empty() const { return t_.empty(); }
+
+	/// First / last recorded time (0 if empty).
+	[[nodiscard]] double TMin() const { return t_.empty() ? 0.0 : t_.front(); }
+	[[nodiscard]] double TMax() const { return t_.empty() ? 0.0 : t_.back(); }
+
+	/// Node times (one per accepted step plus the initial point).
+	[[nodiscard]] const std::vector<double> &Times() const { return t_; }
+
+	/**
+	 * @brief Interpolated state at time @p t.
+	 *
+	 * @param t     Query time, within [TMin(), TMax()].
+	 * @param y_out Output array of Dim() doubles.
+	 *
+	 * @throws std::runtime_error if the trajectory is empty or @p t is outside
+	 *         the recorded range.
+	 */
+	void Evaluate(double t, double *y_out) const;
+
+	/// Convenience overload returning a vector.
+	[[nodiscard]] std::vector<double> Evaluate(double t) const;
+
+	/// Interpolated single component @p i at time @p t.
+	[[nodiscard]] double EvaluateComponent(double t, std::size_t i) const;
+
+	/**
+	 * @brief Batched query at @p n times.
+	 *
+	 * @p y_out receives n * Dim() doubles (row-major, one row per query).
+	 * Queries sorted in ascending order are located in amortized O(1) by a
+	 * moving cursor; unsorted queries fall back to binary search.
+	 */
+	void EvaluateMany(const double *ts, std::size_t n, double *y_out) const;
+
+	/// Convenience overload returning a row-major vector (ts.size() * Dim()).
+	[[nodiscard]] std::vector<double> EvaluateMany(const std::vector<double> &ts) const;
+
+	/**
+	 * @brief Interpolate and unpack into State blocks.
+	 *
+	 * Equivalent to Evaluate() followed by UnpackStateVector().
+	 */
+	void StateAt(double t, StateVector &state, const StateLayout &layout) const;
+
+	// ---------------------------------------------------------------------
+	//  Persistence
+	// ---------------------------------------------------------------------
+
+	/// Write to a binary file. @throws std::runtime_error on I/O failure.
+	void Save(const std::string &path) const;
+
+	/// Replace contents from a file written by Save(). @throws std::runtime_error on I/O failure.
+	void Load(const std::string &path);
+
+	// ---------------------------------------------------------------------
+	//  Hermite kernel
+	// ---------------------------------------------------------------------
+
+	/**
+	 * @brief Cubic Hermite interpolation on one step [ta, tb].
+	 *
+	 * @param dim   Number of components.
+	 * @param ta,ya,fa  Left node time, state and derivative.
+	 * @param tb,yb,fb  Right node time, state and derivative.
+	 * @param t     Query time (extrapolates if outside [ta, tb]).
+	 * @param out   Output array of @p dim doubles.
+	 */
+	static void Hermite(std::size_t dim,
+						double ta, const double *ya, const double *fa,
+						double tb, const double *yb, const double *fb,
+						double t, double *out);
+
+  private:
+	/// Index k of the segment [t_k, t_{k+1}] containing @p t, starting the search at @p hint.
+	std::size_t Locate(double t, std::size_t hint) const;
+
+	/// Interpolate on segment @p k.
+	void EvaluateSegment(std::size_t k, double t, double *y_out) const;
+
+	std::size_t dim_ = 0;
+	std::vector<double> t_;
+	std::vector<double> y_;
+	std::vector<double> f_;
+};
+
+} // namespace CompactStar::Physics::Evolution
+
+#endif /* CompactStar_Physics_Evolution_DenseTrajectory_H */
@@ -21,6 +21,18 @@
  *  - The integrator does *not* know about StateVector/StateLayout; callers
  *    are responsible for packing/unpacking via StatePacking helpers.
  *  - The RHS callback simply forwards to `EvolutionSystem::operator()`.
+ *  - Steps are taken one at a time (gsl_odeiv2_evolve_apply on the driver's
+ *    evolve/control/step objects) so that accepted/rejected steps and step
+ *    sizes can be counted (IntegratorStats).
+ *  - After each accepted step, the EvolutionSystem's event functions
+ *    (EvolutionEvent.hpp) are checked for sign changes; crossings are
+ *    located on the step's Hermite interpolant and reported to observers,
+ *    and may stop the run or restart the stepper at the event time.
+ *  - With StepperType::Auto, the stiffness of the problem is estimated
+ *    periodically (power iteration for the dominant Jacobian eigenvalue,
+ *    plus the rejected-step rate) and the GSL driver is swapped between
+ *    Config::auto_explicit and Config::auto_implicit mid-run; y[], t and the
+ *    observer cadence are unaffected by a switch.
  *
  * @ingroup PhysicsEvolution
  */
@@ -30,10 +42,13 @@
 
 #include <cstddef>
 
+#include "CompactStar/Physics/Evolution/Integrator/IntegratorStats.hpp"
+
 namespace CompactStar::Physics::Evolution
 {
 
 class EvolutionSystem;
+class DenseTrajectory;
 struct Config;
 
 /**
@@ -69,15 +84,41 @@ class GSLIntegrator
 	 * @param t1   End time (s).
 	 * @param y    In/out state vector of length `dim` (provided at construction).
 	 *
-	 * @return true if the integration reached t1 successfully;
+	 * @return true if the integration reached t1 (or a Stop event) successfully;
 	 *         false if GSL reported an error or max_steps was exceeded.
 	 */
 	bool Integrate(double t0, double t1, double *y) const;
 
+	/**
+	 * @brief Integrate from t0 to t1 in-place on y[] and report run statistics.
+	 *
+	 * Same as Integrate(t0, t1, y), but additionally fills @p stats with RHS
+	 * call counts, accepted/rejected steps, step-size range and per-driver
+	 * cost. The same stats are passed to observers via FinishInfo::stats.
+	 *
+	 * @return stats.ok
+	 */
+	bool Integrate(double t0, double t1, double *y, IntegratorStats &stats) const;
+
+	/**
+	 * @brief Record dense output (Hermite step data) into @p traj on every Integrate().
+	 *
+	 * @p traj is reset at the start of each Integrate() and receives the
+	 * initial point plus every accepted step endpoint with its derivative.
+	 * Pass nullptr to disable (default). Non-owning; @p traj must outlive
+	 * the integrations that use it.
+	 *
+	 * For steppers that return the exact end-of-step derivative (the explicit
+	 * RK family, MSBDF) this costs no extra RHS evaluations; otherwise one
+	 * RHS call per accepted step is added.
+	 */
+	void RecordDenseOutput(DenseTrajectory *traj) { m_dense = traj; }
+
   private:
 	const EvolutionSystem *m_sys = nullptr;
 	const Config *m_cfg = nullptr;
 	std::size_t m_dim = 0;
+	DenseTrajectory *m_dense = nullptr; ///< optional dense-output sink (non-owning)
 };
 
 } // namespace CompactStar::Physics::Evolution
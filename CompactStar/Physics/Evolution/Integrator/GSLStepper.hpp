@@ -0,0 +1,96 @@
+// -*- lsst-c++ -*-
+/*
+ * CompactStar
+ * See License file at the top of the source tree.
+ *
+ * Copyright (c) 2025
+ * Mohammadreza Zakeri
+ *
+ * MIT License — see LICENSE at repo root.
+ */
+
+/**
+ * @file GSLStepper.hpp
+ * @brief Mapping from Config's StepperType to GSL stepper types, and the
+ *        finite-difference Jacobian the implicit steppers need.
+ *
+ * Shared by GSLIntegrator and MultirateIntegrator.
+ *
+ * @ingroup PhysicsEvolution
+ */
+
+#ifndef CompactStar_Physics_Evolution_GSLStepper_H
+#define CompactStar_Physics_Evolution_GSLStepper_H
+
+#include <cstddef>
+#include <vector>
+
+#include <gsl/gsl_odeiv2.h>
+
+#include "CompactStar/Physics/Evolution/EvolutionConfig.hpp"
+
+namespace CompactStar::Physics::Evolution
+{
+
+/**
+ * @brief Map StepperType → GSL stepper type.
+ *
+ * Throws std::runtime_error if the enum value is not recognized, or for
+ * StepperType::Auto (which the integrator must resolve first). This is
+ * intentionally strict so invalid configurations fail fast and loudly.
+ */
+const gsl_odeiv2_step_type *SelectStepper(StepperType type);
+
+/**
+ * @brief Human-readable name for logging.
+ */
+const char *StepperTypeName(StepperType type);
+
+/**
+ * @class FDJacobianSystem
+ * @brief gsl_odeiv2_system whose Jacobian is built by finite differences.
+ *
+ * gsl_odeiv2_step_msbdf (StepperType::MSBDF, and Auto once it detects
+ * stiffness) calls sys.jacobian on every Newton setup; the drivers provide
+ * no analytic one. This wraps an RHS callback and supplies
+ *
+ *   ∂f_i/∂y_j ≈ [f_i(t, y + δ_j e_j) − f_i(t, y)] / δ_j,
+ *   δ_j = sqrt(eps) max(|y_j|, atol / rtol),
+ *   ∂f/∂t   ≈ [f(t + δ_t, y) − f(t, y)] / δ_t,
+ *
+ * at dim + 2 RHS evaluations per Jacobian. Explicit steppers never call it.
+ *
+ * System() points back at this object (params), so it must outlive every
+ * GSL driver allocated with it and cannot be copied or moved.
+ */
+class FDJacobianSystem
+{
+  public:
+	/// RHS callback with the gsl_odeiv2_system::function signature.
+	using RHSFn = int (*)(double t, const double y[], double dydt[], void *params);
+
+	FDJacobianSystem(RHSFn f, void *params, std::size_t dim, double atol, double rtol);
+
+	FDJacobianSystem(const FDJacobianSystem &) = delete;
+	FDJacobianSystem &operator=(const FDJacobianSystem &) = delete;
+
+	/// System description to pass to gsl_odeiv2_driver_alloc_*.
+	gsl_odeiv2_system *System() { return &sys_; }
+
+  private:
+	static int Function(double t, const double y[], double dydt[], void *self);
+	static int Jacobian(double t, const double y[], double *dfdy, double dfdt[], void *self);
+
+	RHSFn f_;
+	void *params_;
+	std::size_t dim_;
+	double atol_;
+	double rtol_;
+
+	std::vector<double> y_pert_, f0_, f_pert_; ///< Jacobian scratch
+	gsl_odeiv2_system sys_;
+};
+
+} // namespace CompactStar::Physics::Evolution
+
+#endif /* CompactStar_Physics_Evolution_GSLStepper_H */
@@ -0,0 +1,143 @@
+// -*- lsst-c++ -*-
+/*
+ * CompactStar
+ * See License file at the top of the source tree.
+ *
+ * Copyright (c) 2025
+ * Mohammadreza Zakeri
+ *
+ * MIT License — see LICENSE at repo root.
+ */
+
+/**
+ * @file IntegratorStats.hpp
+ * @brief Per-run counters reported by GSLIntegrator::Integrate.
+ *
+ * Collected with plain integer increments (no Instrumentor mutex), so they
+ * can stay enabled in production runs:
+ *  - RHS evaluations (EvolutionSystem::operator() calls),
+ *  - accepted / rejected steps and min / max accepted step size,
+ *  - per-driver call count and, with Config::profile_drivers (opt-in, two
+ *    steady_clock reads per driver call), cumulative wall time in AccumulateRHS,
+ *  - located events (EvolutionEvent.hpp), in time order.
+ *
+ * @ingroup PhysicsEvolution
+ */
+
+#ifndef CompactStar_Physics_Evolution_IntegratorStats_H
+#define CompactStar_Physics_Evolution_IntegratorStats_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "CompactStar/Physics/Evolution/EvolutionEvent.hpp"
+
+namespace CompactStar::Physics::Evolution
+{
+
+namespace Diagnostics
+{
+class DiagnosticPacket;
+}
+
+/**
+ * @brief Cumulative cost of one driver's AccumulateRHS calls.
+ */
+struct DriverCost
+{
+	/// IDriver::Name().
+	std::string name;
+
+	/// Number of AccumulateRHS calls.
+	std::uint64_t calls = 0;
+
+	/// Cumulative wall time spent in AccumulateRHS [s] (0 if timing disabled).
+	double total_s = 0.0;
+};
+
+/**
+ * @brief Integrator counters for a single Integrate() call.
+ */
+struct IntegratorStats
+{
+	/// True if the integration reached t1.
+	bool ok = false;
+
+	/// Time at which the integration stopped.
+	double t_final = 0.0;
+
+	/// If !ok, the failure reason (may be empty).
+	std::string message;
+
+	/// Name of the GSL stepper used ("Auto(<explicit>/<implicit>)" for StepperType::Auto).
+	std::string stepper;
+
+	/// Number of explicit ↔ implicit stepper switches (StepperType::Auto only).
+	std::uint64_t stepper_switches = 0;
+
+	/// Accepted / rejected macro steps (MultirateIntegrator only).
+	std::uint64_t macro_steps = 0;
+	std::uint64_t macro_rejected = 0;
+
+	/// Inner group steps (accepted and rejected attempts) spent on rejected
+	/// macro steps; not part of accepted_steps / rejected_steps, but their
+	/// RHS calls are in rhs_calls (MultirateIntegrator only).
+	std::uint64_t macro_discarded_steps = 0;
+
+	/// Number of RHS evaluations f(t, y).
+	std::uint64_t rhs_calls = 0;
+
+	/// Number of accepted steps.
+	std::uint64_t accepted_steps = 0;
+
+	/// Number of rejected step attempts (step-size reductions).
+	std::uint64_t rejected_steps = 0;
+
+	/// Smallest accepted step size [s] (0 if no step was taken).
+	double dt_min = 0.0;
+
+	/// Largest accepted step size [s].
+	double dt_max = 0.0;
+
+	/// Last accepted step size [s].
+	double dt_last = 0.0;
+
+	/// Wall time of the whole Integrate() call [s].
+	double wall_time_s = 0.0;
+
+	/// Per-driver cost, in EvolutionSystem driver order.
+	std::vector<DriverCost> drivers;
+
+	/// Events located during the run, in time order.
+	std::vector<EventRecord> events;
+
+	/// Record an accepted step of size @p dt.
+	void RecordStep(double dt)
+	{
+		if (accepted_steps == 0 || dt < dt_min)
+			dt_min = dt;
+		if (dt > dt_max)
+			dt_max = dt;
+		dt_last = dt;
+		++accepted_steps;
+	}
+
+	/// One-line human-readable summary (for logs).
+	[[nodiscard]] std::string Summary() const;
+
+	/**
+	 * @brief Write all counters into a diagnostic packet.
+	 *
+	 * Keys: rhs_calls, accepted_steps, rejected_steps, dt_min_s, dt_max_s,
+	 * wall_time_s, stepper_switches, macro_steps, macro_rejected,
+	 * macro_discarded_steps, events, and per driver "<name>.calls" / "<name>.time_s".
+	 * Each located event is also added as a note.
+	 * The producer label is set to "GSLIntegrator".
+	 */
+	void FillPacket(Diagnostics::DiagnosticPacket &pkt) const;
+};
+
+} // namespace CompactStar::Physics::Evolution
+
+#endif /* CompactStar_Physics_Evolution_IntegratorStats_H */
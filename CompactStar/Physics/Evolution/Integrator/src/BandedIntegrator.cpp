@@ -0,0 +1,426 @@
+// -*- lsst-c++ -*-
+/*
+ * CompactStar
+ * See License file at the top of the source tree.
+ *
+ * Copyright (c) 2025
+ * Mohammadreza Zakeri
+ *
+ * MIT License — see LICENSE at repo root.
+ */
+
+/**
+ * @file BandedIntegrator.cpp
+ * @brief Implementation of BandedIntegrator (ROS2 with a banded Jacobian).
+ */
+
+#include "CompactStar/Physics/Evolution/Integrator/BandedIntegrator.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <gsl/gsl_errno.h>
+
+#include <Zaki/Util/Instrumentor.hpp> // PROFILE_FUNCTION
+#include <Zaki/Util/Logger.hpp>		  // Z_LOG_INFO, Z_LOG_ERROR
+
+#include "CompactStar/Physics/Evolution/EvolutionConfig.hpp"
+#include "CompactStar/Physics/Evolution/EvolutionSystem.hpp"
+#include "CompactStar/Physics/Evolution/StateLayout.hpp"
+
+namespace CompactStar::Physics::Evolution
+{
+
+namespace
+{
+/// ROS2 diagonal coefficient γ = 1 + 1/√2 (L-stable).
+constexpr double kGamma = 1.7071067811865475;
+
+/// sqrt(DBL_EPSILON), relative finite-difference increment.
+constexpr double kSqrtEps = 1.4901161193847656e-08;
+
+//--------------------------------------------------------------
+/**
+ * @brief Square matrix with kl sub- and ku super-diagonals.
+ *
+ * Row-major band storage: A(i, j) lives at a[i * (kl + ku + 1) + (j − i + kl)]
+ * for −kl ≤ j − i ≤ ku. LU without pivoting keeps this structure.
+ */
+struct BandMatrix
+{
+	std::size_t n = 0, kl = 0, ku = 0;
+	std::vector<double> a;
+
+	void Resize(std::size_t n_, std::size_t kl_, std::size_t ku_)
+	{
+		n = n_;
+		kl = kl_;
+		ku = ku_;
+		a.assign(n * (kl + ku + 1), 0.0);
+	}
+
+	double &operator()(std::size_t i, std::size_t j) { return a[i * (kl + ku + 1) + (j + kl - i)]; }
+	double operator()(std::size_t i, std::size_t j) const { return a[i * (kl + ku + 1) + (j + kl - i)]; }
+
+	/// First / one-past-last column stored in row i.
+	std::size_t ColBegin(std::size_t i) const { return (i > kl) ? i - kl : 0; }
+	std::size_t ColEnd(std::size_t i) const { return std::min(n, i + ku + 1); }
+};
+
+//--------------------------------------------------------------
+/**
+ * @brief Banded Jacobian J(i, j) ≈ ∂f_i/∂y_j by coloured finite differences.
+ *
+ * Columns j ≡ c (mod kl + ku + 1) affect disjoint row ranges [j − ku, j + kl]
+ * and are perturbed in the same RHS call.
+ *
+ * @param f0  f(t, y), already evaluated.
+ * @return RHS status (GSL_SUCCESS on success).
+ */
+int BandedJacobian(const EvolutionSystem &sys, const Config &cfg,
+				   double t, const std::vector<double> &y, const std::vector<double> &f0,
+				   BandMatrix &J, std::vector<double> &y_pert, std::vector<double> &f_pert,
+				   std::vector<double> &dy)
+{
+	const std::size_t n = J.n;
+	const std::size_t n_colours = J.kl + J.ku + 1;
+	const double y_floor = (cfg.rtol > 0.0) ? cfg.atol / cfg.rtol : 1.0;
+
+	std::fill(J.a.begin(), J.a.end(), 0.0);
+	y_pert = y;
+
+	for (std::size_t c = 0; c < n_colours && c < n; ++c)
+	{
+		for (std::size_t j = c; j < n; j += n_colours)
+		{
+			double h = kSqrtEps * std::max(std::abs(y[j]), y_floor);
+			if (!(h > 0.0))
+				h = kSqrtEps;
+			y_pert[j] = y[j] + h;
+			dy[j] = y_pert[j] - y[j]; // exactly representable step
+		}
+
+		const int status = sys(t, y_pert.data(), f_pert.data());
+
+		for (std::size_t j = c; j < n; j += n_colours)
+		{
+			y_pert[j] = y[j];
+
+			const std::size_t i_begin = (j > J.ku) ? j - J.ku : 0;
+			const std::size_t i_end = std::min(n, j + J.kl + 1);
+			for (std::size_t i = i_begin; i < i_end; ++i)
+				J(i, j) = (f_pert[i] - f0[i]) / dy[j];
+		}
+
+		if (status != GSL_SUCCESS)
+			return status;
+	}
+
+	return GSL_SUCCESS;
+}
+
+//--------------------------------------------------------------
+/**
+ * @brief W = I − γ h J, factorised in place (banded LU, no pivoting).
+ *
+ * @return false on a zero or non-finite pivot (the caller shrinks h;
+ *         W → I as h → 0).
+ */
+bool FactorW(const BandMatrix &J, double gh, BandMatrix &W)
+{
+	const std::size_t n = J.n;
+
+	for (std::size_t k = 0; k < W.a.size(); ++k)
+		W.a[k] = -gh * J.a[k];
+	for (std::size_t i = 0; i < n; ++i)
+		W(i, i) += 1.0;
+
+	for (std::size_t k = 0; k < n; ++k)
+	{
+		const double piv = W(k, k);
+		if (!(std::abs(piv) > 0.0) || !std::isfinite(piv))
+			return false;
+
+		const std::size_t i_end = std::min(n, k + W.kl + 1);
+		const std::size_t j_end = W.ColEnd(k);
+		for (std::size_t i = k + 1; i < i_end; ++i)
+		{
+			const double l = W(i, k) / piv;
+			W(i, k) = l;
+			if (l == 0.0)
+				continue;
+			for (std::size_t j = k + 1; j < j_end; ++j)
+				W(i, j) -= l * W(k, j);
+		}
+	}
+
+	return true;
+}
+
+//--------------------------------------------------------------
+/// Solve (LU) x = b in place with the factors of FactorW.
+void SolveW(const BandMatrix &LU, std::vector<double> &x)
+{
+	const std::size_t n = LU.n;
+
+	for (std::size_t i = 0; i < n; ++i)
+	{
+		double s = x[i];
+		for (std::size_t j = LU.ColBegin(i); j < i; ++j)
+			s -= LU(i, j) * x[j];
+		x[i] = s;
+	}
+
+	for (std::size_t i = n; i-- > 0;)
+	{
+		double s = x[i];
+		for (std::size_t j = i + 1; j < LU.ColEnd(i); ++j)
+			s -= LU(i, j) * x[j];
+		x[i] = s / LU(i, i);
+	}
+}
+} // namespace
+
+//--------------------------------------------------------------
+//  BandedIntegrator::BandedIntegrator
+//--------------------------------------------------------------
+BandedIntegrator::BandedIntegrator(const EvolutionSystem &sys,
+								   const Config &cfg,
+								   std::size_t dim,
+								   std::size_t lower_bw,
+								   std::size_t upper_bw)
+	: m_sys(&sys),
+	  m_cfg(&cfg),
+	  m_dim(dim),
+	  m_kl(std::min(lower_bw, dim ? dim - 1 : 0)),
+	  m_ku(std::min(upper_bw, dim ? dim - 1 : 0))
+{
+	if (m_dim == 0)
+	{
+		throw std::runtime_error("BandedIntegrator: dimension must be > 0.");
+	}
+	if (m_sys->Layout().TotalSize() != m_dim)
+	{
+		throw std::runtime_error("BandedIntegrator: dimension does not match the system layout.");
+	}
+}
+
+//--------------------------------------------------------------
+//  BandedIntegrator::Integrate
+//--------------------------------------------------------------
+bool BandedIntegrator::Integrate(double t0, double t1, double *y) const
+{
+	IntegratorStats stats;
+	return Integrate(t0, t1, y, stats);
+}
+
+//--------------------------------------------------------------
+//  BandedIntegrator::Integrate (with stats)
+//--------------------------------------------------------------
+bool BandedIntegrator::Integrate(double t0, double t1, double *y, IntegratorStats &stats) const
+{
+	PROFILE_FUNCTION();
+
+	if (!y)
+	{
+		throw std::runtime_error("BandedIntegrator::Integrate: y pointer must not be null.");
+	}
+
+	const auto wall_start = std::chrono::steady_clock::now();
+
+	stats = IntegratorStats{};
+	stats.stepper = "BandedROS2(kl=" + std::to_string(m_kl) + ",ku=" + std::to_string(m_ku) + ")";
+	stats.t_final = t0;
+	m_sys->ResetStats();
+
+	std::ostringstream oss;
+	oss << "Using banded ROS2 integration (kl=" << m_kl
+		<< ", ku=" << m_ku
+		<< ", rtol=" << m_cfg->rtol
+		<< ", atol=" << m_cfg->atol
+		<< ", max_steps=" << m_cfg->max_steps
+		<< ", dt_save=" << m_cfg->dt_save
+		<< ")";
+	Z_LOG_INFO(oss.str());
+
+	if (!m_sys->Events().empty())
+	{
+		Z_LOG_WARNING("BandedIntegrator: event functions are not located; "
+					  "use GSLIntegrator for runs with events.");
+	}
+
+	if (t0 >= t1)
+	{
+		stats.ok = true;
+		return true;
+	}
+
+	// Collect counters into stats (called on every exit path below).
+	auto finalize = [&](double t_end, bool ok, std::string msg)
+	{
+		stats.ok = ok;
+		stats.t_final = t_end;
+		stats.message = std::move(msg);
+		stats.rhs_calls = m_sys->NumRHSCalls();
+		stats.drivers = m_sys->DriverCosts();
+		stats.wall_time_s = std::chrono::duration<double>(
+								std::chrono::steady_clock::now() - wall_start)
+								.count();
+
+		Z_LOG_INFO("BandedIntegrator stats: " + stats.Summary());
+		m_sys->NotifyFinish(t_end, y, ok, &stats);
+	};
+
+	const std::size_t n = m_dim;
+	std::vector<double> yv(y, y + n), f0(n), k1(n), k2(n), y_stage(n), y_new(n);
+	std::vector<double> y_pert(n), f_pert(n), dy(n);
+
+	BandMatrix J, W;
+	J.Resize(n, m_kl, m_ku);
+	W.Resize(n, m_kl, m_ku);
+
+	const double dt_save = (m_cfg->dt_save > 0.0) ? m_cfg->dt_save : (t1 - t0);
+
+	m_sys->NotifyStart(t0, t1, y);
+
+	double t = t0;
+	double h = 0.0;
+	std::size_t sample_index = 0;
+
+	// Fail with the current state reported as the last sample.
+	auto fail = [&](const std::string &msg)
+	{
+		Z_LOG_ERROR(msg);
+		std::copy(yv.begin(), yv.end(), y);
+		m_sys->NotifySample(t, y, sample_index);
+		finalize(t, false, msg);
+		return false;
+	};
+
+	while (t < t1)
+	{
+		const double t_target = std::min(t + dt_save, t1);
+
+		while (t < t_target)
+		{
+			// f and J at the start of the step (kept across rejections).
+			if ((*m_sys)(t, yv.data(), f0.data()) != GSL_SUCCESS)
+				return fail("BandedIntegrator: RHS evaluation failed at t=" + std::to_string(t));
+
+			if (BandedJacobian(*m_sys, *m_cfg, t, yv, f0, J, y_pert, f_pert, dy) != GSL_SUCCESS)
+				return fail("BandedIntegrator: RHS evaluation failed in the Jacobian at t=" + std::to_string(t));
+
+			// Initial step: 1% of the fastest component timescale.
+			if (h <= 0.0)
+			{
+				double rate = 0.0;
+				for (std::size_t i = 0; i < n; ++i)
+					rate = std::max(rate, std::abs(f0[i]) / (m_cfg->atol + m_cfg->rtol * std::abs(yv[i])));
+				h = (rate > 0.0) ? 0.01 / rate : (t_target - t);
+			}
+
+			const double h_min = 1e-14 * std::max(std::abs(t), std::abs(t1 - t0));
+
+			bool accepted = false;
+			while (!accepted)
+			{
+				const double h_try = std::min(h, t_target - t);
+				if (h_try < h_min)
+				{
+					std::ostringstream fail_msg;
+					fail_msg << "BandedIntegrator: step size underflow (h=" << h_try
+							 << ") at t=" << t << ".";
+					return fail(fail_msg.str());
+				}
+
+				if (!FactorW(J, kGamma * h_try, W))
+				{
+					++stats.rejected_steps;
+					h = 0.25 * h_try;
+					continue;
+				}
+
+				// Stage 1: W k1 = f(t, y)
+				k1 = f0;
+				SolveW(W, k1);
+
+				// Stage 2: W k2 = f(t + h, y + h k1) − 2 k1
+				for (std::size_t i = 0; i < n; ++i)
+					y_stage[i] = yv[i] + h_try * k1[i];
+
+				const int status = (*m_sys)(t + h_try, y_stage.data(), k2.data());
+				if (status != GSL_SUCCESS)
+				{
+					++stats.rejected_steps;
+					h = 0.25 * h_try;
+					continue;
+				}
+				for (std::size_t i = 0; i < n; ++i)
+					k2[i] -= 2.0 * k1[i];
+				SolveW(W, k2);
+
+				// y_new = y + h (3/2 k1 + 1/2 k2); error vs. y + h k1.
+				double err = 0.0;
+				for (std::size_t i = 0; i < n; ++i)
+				{
+					y_new[i] = yv[i] + h_try * (1.5 * k1[i] + 0.5 * k2[i]);
+					const double e = 0.5 * h_try * (k1[i] + k2[i]);
+					const double w = m_cfg->atol + m_cfg->rtol * std::max(std::abs(yv[i]), std::abs(y_new[i]));
+					err = std::max(err, std::abs(e) / w);
+				}
+
+				if (!std::isfinite(err))
+				{
+					++stats.rejected_steps;
+					h = 0.25 * h_try;
+					continue;
+				}
+
+				const double factor = (err > 0.0) ? std::clamp(0.9 / std::sqrt(err), 0.2, 5.0) : 5.0;
+
+				if (err > 1.0)
+				{
+					++stats.rejected_steps;
+					h = h_try * factor;
+					continue;
+				}
+
+				// Accept.
+				accepted = true;
+				yv.swap(y_new);
+				t = (h_try >= t_target - t) ? t_target : t + h_try;
+				stats.RecordStep(h_try);
+
+				// Keep the controller's step if this one was cut to hit t_target.
+				h = (h_try < h) ? std::max(h, factor * h_try) : factor * h_try;
+			}
+
+			if (stats.accepted_steps > m_cfg->max_steps)
+			{
+				std::ostringstream fail_msg;
+				fail_msg << "BandedIntegrator: exceeded max_steps=" << m_cfg->max_steps
+						 << " (t=" << t << ")";
+				return fail(fail_msg.str());
+			}
+		}
+
+		// Notify observers once per dt_save chunk (sample cadence)
+		std::copy(yv.begin(), yv.end(), y);
+		m_sys->NotifySample(t, y, sample_index);
+		++sample_index;
+	}
+
+	std::copy(yv.begin(), yv.end(), y);
+	finalize(t, true, "");
+
+	return true;
+}
+
+//--------------------------------------------------------------
+
+} // namespace CompactStar::Physics::Evolution
@@ -0,0 +1,271 @@
+// -*- lsst-c++ -*-
+/*
+ * CompactStar
+ * See License file at the top of the source tree.
+ *
+ * Copyright (c) 2025
+ * Mohammadreza Zakeri
+ *
+ * MIT License — see LICENSE at repo root.
+ */
+
+/**
+ * @file DenseTrajectory.cpp
+ * @brief Implementation of DenseTrajectory (Hermite dense output).
+ */
+
+#include "CompactStar/Physics/Evolution/Integrator/DenseTrajectory.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+#include "CompactStar/Physics/Evolution/StateLayout.hpp"
+#include "CompactStar/Physics/Evolution/StatePacking.hpp"
+#include "CompactStar/Physics/Evolution/StateVector.hpp"
+
+namespace CompactStar::Physics::Evolution
+{
+
+namespace
+{
+/// File magic + format version for Save()/Load().
+constexpr char kMagic[8] = {'C', 'S', 'D', 'E', 'N', 'S', 'E', '1'};
+} // namespace
+
+//--------------------------------------------------------------
+//  Recording
+//--------------------------------------------------------------
+void DenseTrajectory::Reset(std::size_t dim)
+{
+	dim_ = dim;
+	t_.clear();
+	y_.clear();
+	f_.clear();
+}
+
+//--------------------------------------------------------------
+void DenseTrajectory::Reserve(std::size_t n_nodes)
+{
+	t_.reserve(n_nodes);
+	y_.reserve(n_nodes * dim_);
+	f_.reserve(n_nodes * dim_);
+}
+
+//--------------------------------------------------------------
+void DenseTrajectory::Append(double t, const double *y, const double *dydt)
+{
+	if (dim_ == 0)
+		throw std::runtime_error("DenseTrajectory::Append: dimension not set (call Reset(dim)).");
+
+	if (!t_.empty() && t < t_.back())
+		throw std::runtime_error("DenseTrajectory::Append: time must be non-decreasing.");
+
+	t_.push_back(t);
+	y_.insert(y_.end(), y, y + dim_);
+	f_.insert(f_.end(), dydt, dydt + dim_);
+}
+
+//--------------------------------------------------------------
+//  Hermite kernel
+//--------------------------------------------------------------
+void DenseTrajectory::Hermite(std::size_t dim,
+							  double ta, const double *ya, const double *fa,
+							  double tb, const double *yb, const double *fb,
+							  double t, double *out)
+{
+	const double h = tb - ta;
+	if (!(h > 0.0))
+	{
+		// Zero-width (jump) segment: take the newer node.
+		std::copy(yb, yb + dim, out);
+		return;
+	}
+
+	const double s = (t - ta) / h;
+	const double s2 = s * s;
+	const double s3 = s2 * s;
+
+	const double h00 = 2.0 * s3 - 3.0 * s2 + 1.0;
+	const double h10 = (s3 - 2.0 * s2 + s) * h;
+	const double h01 = -2.0 * s3 + 3.0 * s2;
+	const double h11 = (s3 - s2) * h;
+
+	for (std::size_t i = 0; i < dim; ++i)
+		out[i] = h00 * ya[i] + h10 * fa[i] + h01 * yb[i] + h11 * fb[i];
+}
+
+//--------------------------------------------------------------
+//  Queries
+//--------------------------------------------------------------
+std::size_t DenseTrajectory::Locate(double t, std::size_t hint) const
+{
+	const std::size_t n = t_.size();
+
+	if (t_.empty() || t < t_.front() || t > t_.back())
+	{
+		throw std::runtime_error("DenseTrajectory: query time " + std::to_string(t) +
+								 " outside recorded range [" + std::to_string(TMin()) +
+								 ", " + std::to_string(TMax()) + "].");
+	}
+
+	if (n == 1)
+		return 0;
+
+	const std::size_t last_seg = n - 2;
+	if (hint > last_seg)
+		hint = last_seg;
+
+	// Fast path: still in (or right after) the hinted segment.
+	if (t >= t_[hint])
+	{
+		if (t <= t_[hint + 1])
+			return hint;
+		if (hint + 1 <= last_seg && t <= t_[hint + 2])
+			return hint + 1;
+
+		const auto it = std::upper_bound(t_.begin() + static_cast<std::ptrdiff_t>(hint), t_.end(), t);
+		const std::size_t k = static_cast<std::size_t>(it - t_.begin());
+		return std::min(k - 1, last_seg);
+	}
+
+	const auto it = std::upper_bound(t_.begin(), t_.begin() + static_cast<std::ptrdiff_t>(hint) + 1, t);
+	const std::size_t k = static_cast<std::size_t>(it - t_.begin());
+	return (k == 0) ? 0 : std::min(k - 1, last_seg);
+}
+
+//--------------------------------------------------------------
+void DenseTrajectory::EvaluateSegment(std::size_t k, double t, double *y_out) const
+{
+	if (t_.size() == 1)
+	{
+		std::copy(y_.begin(), y_.begin() + static_cast<std::ptrdiff_t>(dim_), y_out);
+		return;
+	}
+
+	const double *ya = y_.data() + k * dim_;
+	const double *fa = f_.data() + k * dim_;
+	Hermite(dim_, t_[k], ya, fa, t_[k + 1], ya + dim_, fa + dim_, t, y_out);
+}
+
+//--------------------------------------------------------------
+void DenseTrajectory::Evaluate(double t, double *y_out) const
+{
+	EvaluateSegment(Locate(t, 0), t, y_out);
+}
+
+//--------------------------------------------------------------
+std::vector<double> DenseTrajectory::Evaluate(double t) const
+{
+	std::vector<double> out(dim_);
+	Evaluate(t, out.data());
+	return out;
+}
+
+//--------------------------------------------------------------
+double DenseTrajectory::EvaluateComponent(double t, std::size_t i) const
+{
+	if (i >= dim_)
+		throw std::runtime_error("DenseTrajectory::EvaluateComponent: component index out of range.");
+
+	const std::size_t k = Locate(t, 0);
+	if (t_.size() == 1)
+		return y_[i];
+
+	double out = 0.0;
+	const double *ya = y_.data() + k * dim_ + i;
+	const double *fa = f_.data() + k * dim_ + i;
+	Hermite(1, t_[k], ya, fa, t_[k + 1], ya + dim_, fa + dim_, t, &out);
+	return out;
+}
+
+//--------------------------------------------------------------
+void DenseTrajectory::EvaluateMany(const double *ts, std::size_t n, double *y_out) const
+{
+	std::size_t k = 0;
+	for (std::size_t q = 0; q < n; ++q)
+	{
+		k = Locate(ts[q], k);
+		EvaluateSegment(k, ts[q], y_out + q * dim_);
+	}
+}
+
+//--------------------------------------------------------------
+std::vector<double> DenseTrajectory::EvaluateMany(const std::vector<double> &ts) const
+{
+	std::vector<double> out(ts.size() * dim_);
+	EvaluateMany(ts.data(), ts.size(), out.data());
+	return out;
+}
+
+//--------------------------------------------------------------
+void DenseTrajectory::StateAt(double t, StateVector &state, const StateLayout &layout) const
+{
+	if (layout.TotalSize() != dim_)
+		throw std::runtime_error("DenseTrajectory::StateAt: layout size does not match trajectory dimension.");
+
+	const std::vector<double> y = Evaluate(t);
+	UnpackStateVector(state, layout, y.data());
+}
+
+//--------------------------------------------------------------
+//  Persistence
+//--------------------------------------------------------------
+void DenseTrajectory::Save(const std::string &path) const
+{
+	std::ofstream out(path, std::ios::out | std::ios::binary | std::ios::trunc);
+	if (!out)
+		throw std::runtime_error("DenseTrajectory::Save: cannot open '" + path + "'.");
+
+	const std::uint64_t dim = dim_;
+	const std::uint64_t n = t_.size();
+
+	out.write(kMagic, sizeof(kMagic));
+	out.write(reinterpret_cast<const char *>(&dim), sizeof(dim));
+	out.write(reinterpret_cast<const char *>(&n), sizeof(n));
+	out.write(reinterpret_cast<const char *>(t_.data()), static_cast<std::streamsize>(t_.size() * sizeof(double)));
+	out.write(reinterpret_cast<const char *>(y_.data()), static_cast<std::streamsize>(y_.size() * sizeof(double)));
+	out.write(reinterpret_cast<const char *>(f_.data()), static_cast<std::streamsize>(f_.size() * sizeof(double)));
+
+	if (!out)
+		throw std::runtime_error("DenseTrajectory::Save: write failed for '" + path + "'.");
+}
+
+//--------------------------------------------------------------
+void DenseTrajectory::Load(const std::string &path)
+{
+	std::ifstream in(path, std::ios::in | std::ios::binary);
+	if (!in)
+		throw std::runtime_error("DenseTrajectory::Load: cannot open '" + path + "'.");
+
+	char magic[sizeof(kMagic)] = {};
+	std::uint64_t dim = 0, n = 0;
+
+	in.read(magic, sizeof(magic));
+	in.read(reinterpret_cast<char *>(&dim), sizeof(dim));
+	in.read(reinterpret_cast<char *>(&n), sizeof(n));
+
+	if (!in || std::memcmp(magic, kMagic, sizeof(kMagic)) != 0)
+		throw std::runtime_error("DenseTrajectory::Load: '" + path + "' is not a dense trajectory file.");
+
+	Reset(static_cast<std::size_t>(dim));
+	t_.resize(n);
+	y_.resize(n * dim);
+	f_.resize(n * dim);
+
+	in.read(reinterpret_cast<char *>(t_.data()), static_cast<std::streamsize>(t_.size() * sizeof(double)));
+	in.read(reinterpret_cast<char *>(y_.data()), static_cast<std::streamsize>(y_.size() * sizeof(double)));
+	in.read(reinterpret_cast<char *>(f_.data()), static_cast<std::streamsize>(f_.size() * sizeof(double)));
+
+	if (!in)
+	{
+		Reset(0);
+		throw std::runtime_error("DenseTrajectory::Load: truncated file '" + path + "'.");
+	}
+}
+
+//--------------------------------------------------------------
+} // namespace CompactStar::Physics::Evolution
@@ -17,7 +17,13 @@
 #include "CompactStar/Physics/Evolution/Integrator/GSLIntegrator.hpp"
 
 #include <algorithm> // std::min
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <sstream>
 #include <stdexcept>
+#include <string>
+#include <vector>
 
 #include <gsl/gsl_errno.h>
 #include <gsl/gsl_odeiv2.h>
@@ -27,6 +33,8 @@
 
 #include "CompactStar/Physics/Evolution/EvolutionConfig.hpp"
 #include "CompactStar/Physics/Evolution/EvolutionSystem.hpp"
+#include "CompactStar/Physics/Evolution/Integrator/DenseTrajectory.hpp"
+#include "CompactStar/Physics/Evolution/Integrator/GSLStepper.hpp"
 
 namespace CompactStar::Physics::Evolution
 {
@@ -36,67 +44,186 @@ namespace CompactStar::Physics::Evolution
 //--------------------------------------------------------------
 
 /**
- * @brief Map StepperType → GSL stepper type.
+ * @brief GSL-compatible RHS callback forwarding to EvolutionSystem.
+ *
+ * This function matches the `gsl_odeiv2_system::function` signature and
+ * simply forwards to `EvolutionSystem::operator()`.
+ */
+static int GslRHS(double t, const double y[], double dydt[], void *params)
+{
+	auto *sys = static_cast<EvolutionSystem *>(params);
+	return sys->operator()(t, y, dydt);
+}
+
+//--------------------------------------------------------------
+/**
+ * @brief Validate the Config::auto_* fields for StepperType::Auto.
+ */
+static void ValidateAutoConfig(const Config &cfg)
+{
+	if (cfg.auto_explicit == StepperType::MSBDF || cfg.auto_explicit == StepperType::Auto)
+		throw std::runtime_error("GSLIntegrator: Config::auto_explicit must be an explicit RK stepper.");
+	if (cfg.auto_implicit != StepperType::MSBDF)
+		throw std::runtime_error("GSLIntegrator: Config::auto_implicit must be MSBDF.");
+	if (cfg.auto_check_every == 0)
+		throw std::runtime_error("GSLIntegrator: Config::auto_check_every must be > 0.");
+	if (!(cfg.auto_nonstiff_hlambda < cfg.auto_stiff_hlambda))
+		throw std::runtime_error("GSLIntegrator: Config::auto_nonstiff_hlambda must be < auto_stiff_hlambda.");
+}
+
+//--------------------------------------------------------------
+/**
+ * @brief Estimate the spectral radius |λ| of J = ∂f/∂y at (t, y).
  *
- * Throws std::runtime_error if the enum value is not recognized. This is
- * intentionally strict so invalid configurations fail fast and loudly.
+ * Power iteration on finite-difference products
+ *   J·v ≈ [f(t, y + δ v) − f(t, y)] / δ,
+ * carried out in the error-weighted variables z_i = y_i / (atol + rtol |y_i|)
+ * (a diagonal similarity, so eigenvalues are unchanged) to keep components
+ * of very different magnitude (ln T, Ω, η) on an equal footing. @p v is the
+ * warm-start vector and is updated in place; each iteration costs one RHS
+ * evaluation.
  */
-static const gsl_odeiv2_step_type *SelectStepper(StepperType type)
+static double EstimateSpectralRadius(void *params, double t, const double *y, const double *f0,
+									 std::size_t dim, double atol, double rtol, int n_iter,
+									 std::vector<double> &v,
+									 std::vector<double> &y_pert, std::vector<double> &f_pert)
 {
-	using ST = StepperType;
+	static constexpr double kSqrtEps = 1.4901161193847656e-08; // sqrt(DBL_EPSILON)
+
+	y_pert.resize(dim);
+	f_pert.resize(dim);
 
-	switch (type)
+	auto normalize = [&]() -> bool
 	{
-	case ST::RKF45:
-		return gsl_odeiv2_step_rkf45;
-	case ST::RKCK:
-		return gsl_odeiv2_step_rkck;
-	case ST::RK8PD:
-		return gsl_odeiv2_step_rk8pd;
-	case ST::RK2:
-		return gsl_odeiv2_step_rk2;
-	case ST::MSBDF:
-		return gsl_odeiv2_step_msbdf;
-	default:
-		throw std::runtime_error("GSLIntegrator::SelectStepper: unsupported StepperType value.");
+		double n2 = 0.0;
+		for (double vi : v)
+			n2 += vi * vi;
+		if (!(n2 > 0.0) || !std::isfinite(n2))
+			return false;
+		const double inv = 1.0 / std::sqrt(n2);
+		for (double &vi : v)
+			vi *= inv;
+		return true;
+	};
+
+	if (v.size() != dim || !normalize())
+	{
+		v.assign(dim, 1.0);
+		normalize();
+	}
+
+	double lambda = 0.0;
+	for (int it = 0; it < n_iter; ++it)
+	{
+		// Perturbation δy_i = s w_i v_i, with s chosen so that the largest
+		// relative perturbation is sqrt(eps).
+		double rel_max = 0.0;
+		for (std::size_t i = 0; i < dim; ++i)
+		{
+			const double w = atol + rtol * std::abs(y[i]);
+			rel_max = std::max(rel_max, std::abs(w * v[i]) / (std::abs(y[i]) + atol));
+		}
+		if (!(rel_max > 0.0))
+			break;
+		const double s = kSqrtEps / rel_max;
+
+		for (std::size_t i = 0; i < dim; ++i)
+			y_pert[i] = y[i] + s * (atol + rtol * std::abs(y[i])) * v[i];
+
+		if (GslRHS(t, y_pert.data(), f_pert.data(), params) != 0)
+			break;
+
+		// v ← W^{-1} J W v
+		for (std::size_t i = 0; i < dim; ++i)
+			v[i] = (f_pert[i] - f0[i]) / (s * (atol + rtol * std::abs(y[i])));
+
+		double n2 = 0.0;
+		for (double vi : v)
+			n2 += vi * vi;
+		lambda = std::sqrt(n2);
+
+		if (!normalize())
+		{
+			v.assign(dim, 1.0);
+			normalize();
+			break;
+		}
 	}
+
+	return std::isfinite(lambda) ? lambda : 0.0;
 }
 
+//--------------------------------------------------------------
 /**
- * @brief Human-readable name for logging.
+ * @brief True if an event function went from @p ga to @p gb across zero in
+ *        a direction accepted by @p dir.
  */
-static const char *StepperTypeName(StepperType type)
+static bool EventCrossed(double ga, double gb, EventDirection dir)
 {
-	using ST = StepperType;
+	const bool rising = (ga < 0.0 && gb >= 0.0);
+	const bool falling = (ga > 0.0 && gb <= 0.0);
 
-	switch (type)
+	switch (dir)
 	{
-	case ST::RKF45:
-		return "RKF45";
-	case ST::RKCK:
-		return "RKCK";
-	case ST::RK8PD:
-		return "RK8PD";
-	case ST::RK2:
-		return "RK2";
-	case ST::MSBDF:
-		return "MSBDF";
+	case EventDirection::Rising:
+		return rising;
+	case EventDirection::Falling:
+		return falling;
 	default:
-		return "UnknownStepper";
+		return rising || falling;
 	}
 }
 
 //--------------------------------------------------------------
 /**
- * @brief GSL-compatible RHS callback forwarding to EvolutionSystem.
+ * @brief Locate the root of event @p k inside the step [ta, tb].
  *
- * This function matches the `gsl_odeiv2_system::function` signature and
- * simply forwards to `EvolutionSystem::operator()`.
+ * Illinois regula falsi on g(t, y_H(t)), where y_H is the cubic Hermite
+ * interpolant of the step (DenseTrajectory::Hermite), so no extra RHS
+ * evaluations are needed; each iteration costs one event-function call.
+ * Returns the bracket end on the post-crossing side, so the state there
+ * has already "triggered" the event.
  */
-static int GslRHS(double t, const double y[], double dydt[], void *params)
+static double LocateEventRoot(const EvolutionSystem &sys, std::size_t k, std::size_t dim,
+							  double ta, const double *ya, const double *fa,
+							  double tb, const double *yb, const double *fb,
+							  double ga, double gb, double t_tol, double *y_work)
 {
-	auto *sys = static_cast<EvolutionSystem *>(params);
-	return sys->operator()(t, y, dydt);
+	constexpr int max_iter = 100;
+
+	const bool pre_negative = (ga < 0.0);
+	double a = ta, b = tb;
+	int last_side = 0; // -1: b moved last, +1: a moved last
+
+	for (int it = 0; it < max_iter && (b - a) > t_tol; ++it)
+	{
+		double c = (a * gb - b * ga) / (gb - ga);
+		if (!(c > a && c < b))
+			c = 0.5 * (a + b);
+
+		DenseTrajectory::Hermite(dim, ta, ya, fa, tb, yb, fb, c, y_work);
+		const double gc = sys.EvaluateEvent(k, c, y_work);
+
+		const bool post = pre_negative ? (gc >= 0.0) : (gc <= 0.0);
+		if (post)
+		{
+			b = c;
+			gb = gc;
+			if (last_side == -1)
+				ga *= 0.5; // Illinois: damp the stagnant end
+			last_side = -1;
+		}
+		else
+		{
+			a = c;
+			ga = gc;
+			if (last_side == +1)
+				gb *= 0.5;
+			last_side = +1;
+		}
+	}
+
+	return b;
 }
 
 //--------------------------------------------------------------
@@ -127,6 +254,15 @@ GSLIntegrator::GSLIntegrator(const EvolutionSystem &sys,
 //  GSLIntegrator::Integrate
 //--------------------------------------------------------------
 bool GSLIntegrator::Integrate(double t0, double t1, double *y) const
+{
+	IntegratorStats stats;
+	return Integrate(t0, t1, y, stats);
+}
+
+//--------------------------------------------------------------
+//  GSLIntegrator::Integrate (with stats)
+//--------------------------------------------------------------
+bool GSLIntegrator::Integrate(double t0, double t1, double *y, IntegratorStats &stats) const
 {
 	PROFILE_FUNCTION();
 
@@ -135,17 +271,36 @@ bool GSLIntegrator::Integrate(double t0, double t1, double *y) const
 		throw std::runtime_error("GSLIntegrator::Integrate: y pointer must not be null.");
 	}
 
+	const auto wall_start = std::chrono::steady_clock::now();
+
+	stats = IntegratorStats{};
+	stats.stepper = StepperTypeName(m_cfg->stepper);
+	stats.t_final = t0;
+	m_sys->ResetStats();
+
+	// Auto: start on the explicit stepper; the stiffness check below moves
+	// to the implicit one (and back) as needed.
+	const bool auto_stepper = (m_cfg->stepper == StepperType::Auto);
+	StepperType active_stepper = m_cfg->stepper;
+	if (auto_stepper)
+	{
+		ValidateAutoConfig(*m_cfg);
+		active_stepper = m_cfg->auto_explicit;
+		stats.stepper = std::string("Auto(") + StepperTypeName(m_cfg->auto_explicit) + "/" +
+						StepperTypeName(m_cfg->auto_implicit) + ")";
+	}
+
 	// ---------------------------------------------------------------------
 	//  Build GSL system description
 	// ---------------------------------------------------------------------
-	gsl_odeiv2_system sys;
-	sys.function = &GslRHS;
-	sys.jacobian = nullptr; // analytic Jacobian not implemented (let GSL approximate / not use)
-	sys.dimension = m_dim;
-	sys.params = const_cast<EvolutionSystem *>(m_sys);
+	// The implicit stepper (MSBDF, also reached from Auto) needs a Jacobian;
+	// the drivers provide none, so it is built by finite differences.
+	void *rhs_params = const_cast<EvolutionSystem *>(m_sys);
+	FDJacobianSystem fd_sys(&GslRHS, rhs_params, m_dim, m_cfg->atol, m_cfg->rtol);
+	gsl_odeiv2_system &sys = *fd_sys.System();
 
 	// Select stepper; will throw if configuration is invalid.
-	const gsl_odeiv2_step_type *step_type = SelectStepper(m_cfg->stepper);
+	const gsl_odeiv2_step_type *step_type = SelectStepper(active_stepper);
 
 	// ---------------------------------------------------------------------
 	//  Initial step size heuristic
@@ -191,7 +346,7 @@ bool GSLIntegrator::Integrate(double t0, double t1, double *y) const
 	// ---------------------------------------------------------------------
 	std::ostringstream oss;
 	oss << "Using GSL stepper '"
-		<< StepperTypeName(m_cfg->stepper)
+		<< stats.stepper
 		<< "' (rtol=" << m_cfg->rtol
 		<< ", atol=" << m_cfg->atol
 		<< ", max_steps=" << m_cfg->max_steps
@@ -204,27 +359,271 @@ bool GSLIntegrator::Integrate(double t0, double t1, double *y) const
 	if (t0 >= t1)
 	{
 		gsl_odeiv2_driver_free(driver);
+		stats.ok = true;
 		return true;
 	}
 
+	// gsl_odeiv2_driver_reset() (event restarts) and stepper switches
+	// (Auto) start a fresh e->failed_steps count.
+	std::uint64_t rejected_before_restart = 0;
+
+	// Collect counters into stats (called on every exit path below).
+	auto finalize = [&](double t_end, bool ok, std::string msg)
+	{
+		stats.ok = ok;
+		stats.t_final = t_end;
+		stats.message = std::move(msg);
+		stats.rhs_calls = m_sys->NumRHSCalls();
+		stats.rejected_steps = rejected_before_restart + driver->e->failed_steps;
+		stats.drivers = m_sys->DriverCosts();
+		stats.wall_time_s = std::chrono::duration<double>(
+								std::chrono::steady_clock::now() - wall_start)
+								.count();
+
+		gsl_odeiv2_driver_free(driver);
+
+		Z_LOG_INFO("GSLIntegrator stats: " + stats.Summary());
+		m_sys->NotifyFinish(t_end, y, ok, &stats);
+	};
+
+	// ---------------------------------------------------------------------
+	//  Step-endpoint data for dense output and events
+	// ---------------------------------------------------------------------
+	//
+	// Both (and the Auto stiffness check) need f(t, y) at every accepted
+	// step endpoint. After a successful evolve_apply, e->dydt_out holds it
+	// when the stepper reports gives_exact_dydt_out; otherwise we evaluate
+	// it explicitly.
+	const std::vector<EventSpec> &events = m_sys->Events();
+	const std::size_t n_ev = events.size();
+	const bool need_node_data = (m_dense != nullptr) || (n_ev > 0) || auto_stepper;
+	bool exact_dydt_out = (driver->s->type->gives_exact_dydt_out != 0);
+
+	std::vector<double> f_cur;
+	if (need_node_data)
+	{
+		f_cur.resize(m_dim);
+		GslRHS(t0, y, f_cur.data(), rhs_params);
+	}
+	if (m_dense)
+	{
+		m_dense->Reset(m_dim);
+		m_dense->Append(t0, y, f_cur.data());
+	}
+
+	// Start-of-step copies and event values (only used when events exist).
+	std::vector<double> y_prev, f_prev, y_work, g_prev, g_new;
+	if (n_ev > 0)
+	{
+		y_prev.resize(m_dim);
+		f_prev.resize(m_dim);
+		y_work.resize(m_dim);
+		g_prev.resize(n_ev);
+		g_new.resize(n_ev);
+		m_sys->EvaluateEvents(t0, y, g_prev.data());
+	}
+
+	// ---------------------------------------------------------------------
+	//  Auto stepper: stiffness check and switch
+	// ---------------------------------------------------------------------
+	//
+	// Switching frees the GSL driver and allocates one with the other
+	// stepper at the current step size. y[], t, the sample cadence, dense
+	// output and event bookkeeping all live outside the driver, so the run
+	// (and what observers see) continues seamlessly.
+	static constexpr int kPowerIterations = 6;
+	std::vector<double> power_v, power_y, power_f;
+	std::uint64_t check_steps = 0, check_rhs = 0, check_rejected = 0;
+
+	auto check_stiffness = [&](double t_now)
+	{
+		const std::uint64_t rejected = rejected_before_restart + driver->e->failed_steps;
+		const std::uint64_t rhs_window = m_sys->NumRHSCalls() - check_rhs;
+		const double reject_ratio = (rhs_window > 0)
+										? static_cast<double>(rejected - check_rejected) /
+											  static_cast<double>(rhs_window)
+										: 0.0;
+
+		const double lambda = EstimateSpectralRadius(rhs_params, t_now, y, f_cur.data(), m_dim,
+													 m_cfg->atol, m_cfg->rtol, kPowerIterations,
+													 power_v, power_y, power_f);
+		const double h = std::abs(driver->h);
+		const double h_lambda = h * lambda;
+
+		const bool on_explicit = (active_stepper == m_cfg->auto_explicit);
+		StepperType next = active_stepper;
+		if (on_explicit &&
+			(h_lambda > m_cfg->auto_stiff_hlambda || reject_ratio > m_cfg->auto_reject_ratio))
+			next = m_cfg->auto_implicit;
+		else if (!on_explicit && h_lambda < m_cfg->auto_nonstiff_hlambda)
+			next = m_cfg->auto_explicit;
+
+		if (next != active_stepper)
+		{
+			// Leaving the implicit stepper: start the explicit one inside
+			// its stability region.
+			double h_new = h;
+			if (!on_explicit && lambda > 0.0)
+				h_new = std::min(h_new, m_cfg->auto_nonstiff_hlambda / lambda);
+
+			std::ostringstream sw;
+			sw << "GSLIntegrator: switching stepper " << StepperTypeName(active_stepper)
+			   << " -> " << StepperTypeName(next) << " at t=" << t_now
+			   << " (h|lambda|=" << h_lambda << ", rejected/rhs=" << reject_ratio << ")";
+			Z_LOG_INFO(sw.str());
+
+			rejected_before_restart += driver->e->failed_steps;
+			gsl_odeiv2_driver_free(driver);
+			driver = gsl_odeiv2_driver_alloc_y_new(&sys, SelectStepper(next), h_new,
+												   m_cfg->atol, m_cfg->rtol);
+			if (!driver)
+				throw std::runtime_error("GSLIntegrator::Integrate: failed to reallocate GSL driver.");
+
+			active_stepper = next;
+			exact_dydt_out = (driver->s->type->gives_exact_dydt_out != 0);
+			++stats.stepper_switches;
+		}
+
+		check_steps = stats.accepted_steps;
+		check_rhs = m_sys->NumRHSCalls();
+		check_rejected = rejected_before_restart + driver->e->failed_steps;
+	};
+
 	// Notify observers at start (t0 snapshot)
 	m_sys->NotifyStart(t0, t1, y);
 	// ---------------------------------------------------------------------
 	//  Main integration loop
 	// ---------------------------------------------------------------------
+	//
+	// We advance in chunks of dt_save; within a chunk, each call to
+	// gsl_odeiv2_evolve_apply takes exactly one accepted step (retrying with
+	// smaller h internally), which is what gsl_odeiv2_driver_apply does too.
+	//
+	// After each accepted step, event functions are checked for sign
+	// changes; crossings are located on the step's Hermite interpolant and
+	// handled in time order. A Stop/Restart event truncates the step at the
+	// event time (later crossings in the same step are discarded, since the
+	// trajectory beyond the event is no longer the one integrated).
 	double t = t0;
-	std::size_t steps_used = 0;
+	std::size_t sample_index = 0;
+	const EventRecord *stop_event = nullptr;
 
-	// We advance in chunks of dt_save, letting the GSL driver adapt internally.
-	while (t < t1)
+	while (t < t1 && !stop_event)
 	{
 		const double dt_save = (m_cfg->dt_save > 0.0) ? m_cfg->dt_save : (t1 - t0);
 		const double t_target = std::min(t + dt_save, t1);
 
-		int status = gsl_odeiv2_driver_apply(driver, &t, t_target, y);
+		int status = GSL_SUCCESS;
+		while (t < t_target)
+		{
+			const double t_prev = t;
+			if (n_ev > 0)
+			{
+				std::copy(y, y + m_dim, y_prev.begin());
+				std::copy(f_cur.begin(), f_cur.end(), f_prev.begin());
+			}
+
+			status = gsl_odeiv2_evolve_apply(driver->e, driver->c, driver->s,
+											 &sys, &t, t_target, &driver->h, y);
+			if (status != GSL_SUCCESS)
+				break;
+
+			stats.RecordStep(t - t_prev);
+
+			if (need_node_data)
+			{
+				if (exact_dydt_out)
+					std::copy(driver->e->dydt_out, driver->e->dydt_out + m_dim, f_cur.begin());
+				else
+					GslRHS(t, y, f_cur.data(), rhs_params);
+			}
+
+			if (n_ev > 0)
+			{
+				m_sys->EvaluateEvents(t, y, g_new.data());
+
+				std::vector<EventRecord> hits;
+				for (std::size_t k = 0; k < n_ev; ++k)
+				{
+					if (!EventCrossed(g_prev[k], g_new[k], events[k].direction))
+						continue;
+
+					const double tol = (events[k].t_tol > 0.0)
+										   ? events[k].t_tol
+										   : 1e-12 * std::max(std::abs(t), t - t_prev);
+
+					EventRecord rec;
+					rec.name = events[k].name;
+					rec.index = k;
+					rec.rising = (g_new[k] > g_prev[k]);
+					rec.action = events[k].action;
+					rec.t = LocateEventRoot(*m_sys, k, m_dim,
+											t_prev, y_prev.data(), f_prev.data(),
+											t, y, f_cur.data(),
+											g_prev[k], g_new[k], tol, y_work.data());
+					hits.push_back(std::move(rec));
+				}
+
+				std::stable_sort(hits.begin(), hits.end(),
+								 [](const EventRecord &a, const EventRecord &b)
+								 { return a.t < b.t; });
+
+				for (const auto &rec : hits)
+				{
+					DenseTrajectory::Hermite(m_dim, t_prev, y_prev.data(), f_prev.data(),
+											 t, y, f_cur.data(), rec.t, y_work.data());
+
+					stats.events.push_back(rec);
+					m_sys->NotifyEvent(rec, y_work.data());
+					Z_LOG_INFO("GSLIntegrator: event '" + rec.name + "' at t=" + std::to_string(rec.t));
+
+					if (rec.action == EventAction::Continue)
+						continue;
+
+					// Truncate the step at the event.
+					t = rec.t;
+					std::copy(y_work.begin(), y_work.end(), y);
+					GslRHS(t, y, f_cur.data(), rhs_params);
+
+					if (rec.action == EventAction::Restart)
+					{
+						const auto &handler = events[rec.index].on_restart;
+						if (handler)
+						{
+							// Keep the pre-handler state as its own dense node,
+							// so the jump is represented exactly.
+							if (m_dense)
+								m_dense->Append(t, y, f_cur.data());
+							handler(t, y, m_dim);
+							GslRHS(t, y, f_cur.data(), rhs_params);
+						}
+						rejected_before_restart += driver->e->failed_steps;
+						gsl_odeiv2_driver_reset(driver);
+					}
+					else
+					{
+						stop_event = &stats.events.back();
+					}
+
+					m_sys->EvaluateEvents(t, y, g_new.data());
+					break;
+				}
+
+				g_prev.swap(g_new);
+			}
+
+			if (m_dense)
+				m_dense->Append(t, y, f_cur.data());
+
+			if (stop_event || stats.accepted_steps > m_cfg->max_steps)
+				break;
+
+			if (auto_stepper && stats.accepted_steps - check_steps >= m_cfg->auto_check_every)
+				check_stiffness(t);
+		}
 
 		// Notify observers once per dt_save chunk (sample cadence)
-		m_sys->NotifySample(t, y, steps_used);
+		m_sys->NotifySample(t, y, sample_index);
 
 		if (status != GSL_SUCCESS)
 		{
@@ -235,15 +634,12 @@ bool GSLIntegrator::Integrate(double t0, double t1, double *y) const
 				<< " (" << gsl_strerror(status) << ")";
 			Z_LOG_ERROR(oss.str());
 
-			gsl_odeiv2_driver_free(driver);
-
-			m_sys->NotifyFinish(t, y, false);
-
+			finalize(t, false, oss.str());
 			return false;
 		}
 
-		++steps_used;
-		if (steps_used > m_cfg->max_steps)
+		++sample_index;
+		if (stats.accepted_steps > m_cfg->max_steps)
 		{
 			std::ostringstream oss;
 
@@ -252,19 +648,12 @@ bool GSLIntegrator::Integrate(double t0, double t1, double *y) const
 				<< " (t=" << t << ")";
 			Z_LOG_ERROR(oss.str());
 
-			gsl_odeiv2_driver_free(driver);
-
-			m_sys->NotifyFinish(t, y, false);
-
+			finalize(t, false, oss.str());
 			return false;
 		}
-
-		// At this point, in a future phase, we can notify Observers with (t,y).
 	}
 
-	gsl_odeiv2_driver_free(driver);
-
-	m_sys->NotifyFinish(t, y, true);
+	finalize(t, true, stop_event ? "stopped by event '" + stop_event->name + "'" : "");
 
 	return true;
 }
@@ -0,0 +1,148 @@
+// -*- lsst-c++ -*-
+/*
+ * CompactStar
+ * See License file at the top of the source tree.
+ *
+ * Copyright (c) 2025
+ * Mohammadreza Zakeri
+ *
+ * MIT License — see LICENSE at repo root.
+ */
+
+/**
+ * @file GSLStepper.cpp
+ * @brief StepperType ↔ GSL stepper mapping.
+ */
+
+#include "CompactStar/Physics/Evolution/Integrator/GSLStepper.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include <gsl/gsl_errno.h>
+
+namespace CompactStar::Physics::Evolution
+{
+
+//--------------------------------------------------------------
+const gsl_odeiv2_step_type *SelectStepper(StepperType type)
+{
+	using ST = StepperType;
+
+	switch (type)
+	{
+	case ST::RKF45:
+		return gsl_odeiv2_step_rkf45;
+	case ST::RKCK:
+		return gsl_odeiv2_step_rkck;
+	case ST::RK8PD:
+		return gsl_odeiv2_step_rk8pd;
+	case ST::RK2:
+		return gsl_odeiv2_step_rk2;
+	case ST::MSBDF:
+		return gsl_odeiv2_step_msbdf;
+	case ST::Auto:
+		throw std::runtime_error("SelectStepper: StepperType::Auto must be resolved "
+								 "to Config::auto_explicit / auto_implicit first.");
+	default:
+		throw std::runtime_error("SelectStepper: unsupported StepperType value.");
+	}
+}
+
+//--------------------------------------------------------------
+const char *StepperTypeName(StepperType type)
+{
+	using ST = StepperType;
+
+	switch (type)
+	{
+	case ST::RKF45:
+		return "RKF45";
+	case ST::RKCK:
+		return "RKCK";
+	case ST::RK8PD:
+		return "RK8PD";
+	case ST::RK2:
+		return "RK2";
+	case ST::MSBDF:
+		return "MSBDF";
+	case ST::Auto:
+		return "Auto";
+	default:
+		return "UnknownStepper";
+	}
+}
+
+//--------------------------------------------------------------
+//  FDJacobianSystem
+//--------------------------------------------------------------
+FDJacobianSystem::FDJacobianSystem(RHSFn f, void *params, std::size_t dim,
+								   double atol, double rtol)
+	: f_(f), params_(params), dim_(dim), atol_(atol), rtol_(rtol),
+	  y_pert_(dim), f0_(dim), f_pert_(dim)
+{
+	if (!f_ || dim_ == 0)
+		throw std::runtime_error("FDJacobianSystem: null RHS callback or zero dimension.");
+
+	sys_.function = &FDJacobianSystem::Function;
+	sys_.jacobian = &FDJacobianSystem::Jacobian;
+	sys_.dimension = dim_;
+	sys_.params = this;
+}
+
+//--------------------------------------------------------------
+int FDJacobianSystem::Function(double t, const double y[], double dydt[], void *self)
+{
+	const auto *s = static_cast<const FDJacobianSystem *>(self);
+	return s->f_(t, y, dydt, s->params_);
+}
+
+//--------------------------------------------------------------
+int FDJacobianSystem::Jacobian(double t, const double y[], double *dfdy, double dfdt[], void *self)
+{
+	static constexpr double kSqrtEps = 1.4901161193847656e-08; // sqrt(DBL_EPSILON)
+
+	auto *s = static_cast<FDJacobianSystem *>(self);
+	const std::size_t n = s->dim_;
+
+	int status = s->f_(t, y, s->f0_.data(), s->params_);
+	if (status != GSL_SUCCESS)
+		return status;
+
+	// Columns ∂f/∂y_j (row-major dfdy[i * n + j])
+	const double y_floor = (s->rtol_ > 0.0) ? s->atol_ / s->rtol_ : 1.0;
+	std::copy(y, y + n, s->y_pert_.begin());
+	for (std::size_t j = 0; j < n; ++j)
+	{
+		const double yj = y[j];
+		double dy = kSqrtEps * std::max(std::abs(yj), y_floor);
+		if (!(dy > 0.0))
+			dy = kSqrtEps;
+		s->y_pert_[j] = yj + dy;
+		dy = s->y_pert_[j] - yj; // exactly representable step
+
+		status = s->f_(t, s->y_pert_.data(), s->f_pert_.data(), s->params_);
+		s->y_pert_[j] = yj;
+		if (status != GSL_SUCCESS)
+			return status;
+
+		for (std::size_t i = 0; i < n; ++i)
+			dfdy[i * n + j] = (s->f_pert_[i] - s->f0_[i]) / dy;
+	}
+
+	// ∂f/∂t
+	const double t_pert = t + kSqrtEps * std::max(std::abs(t), 1.0);
+	const double dt = t_pert - t;
+	status = s->f_(t_pert, y, s->f_pert_.data(), s->params_);
+	if (status != GSL_SUCCESS)
+		return status;
+
+	for (std::size_t i = 0; i < n; ++i)
+		dfdt[i] = (s->f_pert_[i] - s->f0_[i]) / dt;
+
+	return GSL_SUCCESS;
+}
+
+//--------------------------------------------------------------
+} // namespace CompactStar::Physics::Evolution
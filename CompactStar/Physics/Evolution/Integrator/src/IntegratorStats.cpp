@@ -0,0 +1,109 @@
+// -*- lsst-c++ -*-
+/*
+ * CompactStar
+ * See License file at the top of the source tree.
+ *
+ * Copyright (c) 2025
+ * Mohammadreza Zakeri
+ *
+ * MIT License — see LICENSE at repo root.
+ */
+
+/**
+ * @file IntegratorStats.cpp
+ * @brief Summary and diagnostic-packet export of IntegratorStats.
+ */
+
+#include "CompactStar/Physics/Evolution/Integrator/IntegratorStats.hpp"
+
+#include <sstream>
+
+#include "CompactStar/Physics/Evolution/Diagnostics/DiagnosticPacket.hpp"
+
+namespace CompactStar::Physics::Evolution
+{
+
+//--------------------------------------------------------------
+//  IntegratorStats::Summary
+//--------------------------------------------------------------
+std::string IntegratorStats::Summary() const
+{
+	std::ostringstream oss;
+	oss << "stepper=" << stepper
+		<< " ok=" << (ok ? "true" : "false")
+		<< " t_final=" << t_final
+		<< " rhs_calls=" << rhs_calls
+		<< " accepted=" << accepted_steps
+		<< " rejected=" << rejected_steps
+		<< " dt_min=" << dt_min
+		<< " dt_max=" << dt_max
+		<< " switches=" << stepper_switches;
+
+	if (macro_steps > 0 || macro_rejected > 0)
+		oss << " macro_steps=" << macro_steps << " macro_rejected=" << macro_rejected
+			<< " macro_discarded_steps=" << macro_discarded_steps;
+
+	oss << " events=" << events.size()
+		<< " wall=" << wall_time_s << "s";
+
+	for (const auto &d : drivers)
+	{
+		oss << " | " << d.name << ": " << d.calls << " calls, "
+			<< d.total_s << " s";
+	}
+
+	return oss.str();
+}
+
+//--------------------------------------------------------------
+//  IntegratorStats::FillPacket
+//--------------------------------------------------------------
+void IntegratorStats::FillPacket(Diagnostics::DiagnosticPacket &pkt) const
+{
+	pkt.SetProducer("GSLIntegrator");
+	pkt.SetTime(t_final);
+	pkt.SetStepIndex(static_cast<std::size_t>(accepted_steps));
+
+	pkt.AddScalar("rhs_calls", static_cast<double>(rhs_calls), "",
+				  "Number of RHS evaluations", "integrator");
+	pkt.AddScalar("accepted_steps", static_cast<double>(accepted_steps), "",
+				  "Accepted integrator steps", "integrator");
+	pkt.AddScalar("rejected_steps", static_cast<double>(rejected_steps), "",
+				  "Rejected integrator step attempts", "integrator");
+	pkt.AddScalar("dt_min_s", dt_min, "s", "Smallest accepted step size", "integrator");
+	pkt.AddScalar("dt_max_s", dt_max, "s", "Largest accepted step size", "integrator");
+	pkt.AddScalar("wall_time_s", wall_time_s, "s", "Wall time of Integrate()", "integrator");
+
+	pkt.AddScalar("stepper_switches", static_cast<double>(stepper_switches), "",
+				  "Explicit/implicit stepper switches (Auto)", "integrator");
+	pkt.AddScalar("macro_steps", static_cast<double>(macro_steps), "",
+				  "Accepted multirate macro steps", "integrator");
+	pkt.AddScalar("macro_rejected", static_cast<double>(macro_rejected), "",
+				  "Rejected multirate macro steps (coupling error)", "integrator");
+	pkt.AddScalar("macro_discarded_steps", static_cast<double>(macro_discarded_steps), "",
+				  "Inner steps spent on rejected macro steps", "integrator");
+	pkt.AddScalar("events", static_cast<double>(events.size()), "",
+				  "Located events", "integrator");
+
+	for (const auto &d : drivers)
+	{
+		pkt.AddScalar(d.name + ".calls", static_cast<double>(d.calls), "",
+					  "AccumulateRHS calls", "integrator");
+		pkt.AddScalar(d.name + ".time_s", d.total_s, "s",
+					  "Cumulative AccumulateRHS wall time", "integrator");
+	}
+
+	for (const auto &ev : events)
+	{
+		std::ostringstream note;
+		note << "event '" << ev.name << "' at t=" << ev.t
+			 << (ev.rising ? " (rising)" : " (falling)");
+		pkt.AddNote(note.str());
+	}
+
+	if (!ok && !message.empty())
+		pkt.AddWarning(message);
+}
+
+//--------------------------------------------------------------
+} // namespace CompactStar::Physics::Evolution
@@ -0,0 +1,572 @@
+// -*- lsst-c++ -*-
+/*
+ * CompactStar
+ * See License file at the top of the source tree.
+ *
+ * Copyright (c) 2025
+ * Mohammadreza Zakeri
+ *
+ * MIT License — see LICENSE at repo root.
+ */
+
+/**
+ * @file MultirateIntegrator.cpp
+ * @brief Implementation of MultirateIntegrator (slowest-first multirate).
+ */
+
+#include "CompactStar/Physics/Evolution/Integrator/MultirateIntegrator.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_odeiv2.h>
+
+#include <Zaki/Util/Instrumentor.hpp> // PROFILE_FUNCTION
+#include <Zaki/Util/Logger.hpp>		  // Z_LOG_INFO, Z_LOG_ERROR
+
+#include "CompactStar/Physics/Driver/IDriver.hpp"
+#include "CompactStar/Physics/Evolution/EvolutionConfig.hpp"
+#include "CompactStar/Physics/Evolution/EvolutionSystem.hpp"
+#include "CompactStar/Physics/Evolution/Integrator/DenseTrajectory.hpp"
+#include "CompactStar/Physics/Evolution/Integrator/GSLStepper.hpp"
+#include "CompactStar/Physics/Evolution/StateLayout.hpp"
+
+namespace CompactStar::Physics::Evolution
+{
+
+namespace
+{
+using State::StateTag;
+
+/// Number of StateTag enumeration values.
+constexpr std::size_t kNumTags = static_cast<std::size_t>(StateTag::Custom) + 1;
+
+//--------------------------------------------------------------
+/**
+ * @brief A set of state blocks advanced together with one GSL driver.
+ */
+struct RateGroup
+{
+	std::vector<StateTag> tags;		  ///< blocks in the group
+	std::vector<std::size_t> idx;	  ///< components of y[] owned by the group
+	std::vector<std::size_t> drivers; ///< drivers whose Updates() touch the group
+	bool reads_faster = false;		  ///< some driver DependsOn() a faster group
+	double tau = 0.0;				  ///< timescale of the group's slowest block [s]
+
+	DenseTrajectory track;		///< group trajectory over the current macro step
+	std::vector<double> y_end;	///< group state at the end of the macro step
+	std::vector<double> f_end;	///< group derivative seen at the end of the macro step
+};
+
+//--------------------------------------------------------------
+/**
+ * @brief Parameters of the per-group GSL right-hand side.
+ */
+struct GroupRHSParams
+{
+	const EvolutionSystem *sys = nullptr;
+	std::vector<RateGroup> *groups = nullptr;
+	std::size_t g = 0;			   ///< group being advanced
+	const double *y_base = nullptr; ///< full state at the start of the macro step
+	std::vector<double> y_full;	   ///< assembled full state
+	std::vector<double> f_full;	   ///< full derivative scratch
+	std::vector<double> buf;	   ///< interpolation scratch
+};
+
+//--------------------------------------------------------------
+/**
+ * @brief GSL RHS of one group: assemble the full state, run the group's drivers.
+ *
+ * Slower groups (already advanced) are read from their Hermite track,
+ * faster groups are frozen at the start of the macro step.
+ */
+int GroupRHS(double t, const double y[], double dydt[], void *params)
+{
+	auto *p = static_cast<GroupRHSParams *>(params);
+	const auto &groups = *p->groups;
+
+	std::copy(p->y_base, p->y_base + p->y_full.size(), p->y_full.begin());
+
+	for (std::size_t j = 0; j < p->g; ++j)
+	{
+		const RateGroup &slow = groups[j];
+		const double tq = std::clamp(t, slow.track.TMin(), slow.track.TMax());
+
+		p->buf.resize(slow.idx.size());
+		slow.track.Evaluate(tq, p->buf.data());
+		for (std::size_t k = 0; k < slow.idx.size(); ++k)
+			p->y_full[slow.idx[k]] = p->buf[k];
+	}
+
+	const RateGroup &grp = groups[p->g];
+	for (std::size_t k = 0; k < grp.idx.size(); ++k)
+		p->y_full[grp.idx[k]] = y[k];
+
+	const int status = p->sys->EvaluateSubset(t, p->y_full.data(), p->f_full.data(), grp.drivers);
+
+	for (std::size_t k = 0; k < grp.idx.size(); ++k)
+		dydt[k] = p->f_full[grp.idx[k]];
+
+	return status;
+}
+
+//--------------------------------------------------------------
+/**
+ * @brief Partition the active blocks into rate groups, slowest first.
+ *
+ * @param f  Scratch of size dim; receives the full f(t, y).
+ */
+std::vector<RateGroup> BuildGroups(const EvolutionSystem &sys, const Config &cfg,
+								   double t, const double *y, std::vector<double> &f)
+{
+	sys(t, y, f.data());
+
+	const StateLayout &layout = sys.Layout();
+
+	struct BlockRate
+	{
+		StateTag tag;
+		double tau;
+	};
+
+	std::vector<BlockRate> blocks;
+	for (std::size_t i = 0; i < kNumTags; ++i)
+	{
+		const auto tag = static_cast<StateTag>(i);
+		if (!layout.IsActive(tag) || layout.BlockSize(tag) == 0)
+			continue;
+
+		const auto blk = layout.GetBlock(tag);
+		double tau = std::numeric_limits<double>::infinity();
+		for (std::size_t k = blk.offset; k < blk.offset + blk.size; ++k)
+		{
+			const double rate = std::abs(f[k]);
+			if (rate > 0.0)
+				tau = std::min(tau, (std::abs(y[k]) + cfg.atol) / rate);
+		}
+		blocks.push_back({tag, tau});
+	}
+
+	std::stable_sort(blocks.begin(), blocks.end(),
+					 [](const BlockRate &a, const BlockRate &b)
+					 { return a.tau > b.tau; });
+
+	std::vector<RateGroup> groups;
+	std::array<int, kNumTags> group_of;
+	group_of.fill(-1);
+
+	for (const auto &b : blocks)
+	{
+		// Open a new group when this block is much faster than the group's
+		// slowest one (inf/inf is NaN, which keeps frozen blocks together).
+		if (groups.empty() || groups.back().tau / b.tau > cfg.multirate_ratio)
+		{
+			groups.emplace_back();
+			groups.back().tau = b.tau;
+		}
+
+		RateGroup &grp = groups.back();
+		grp.tags.push_back(b.tag);
+		group_of[static_cast<std::size_t>(b.tag)] = static_cast<int>(groups.size() - 1);
+
+		const auto blk = layout.GetBlock(b.tag);
+		for (std::size_t k = blk.offset; k < blk.offset + blk.size; ++k)
+			grp.idx.push_back(k);
+	}
+
+	// Assign drivers by the blocks they update; flag groups whose drivers
+	// read a faster (frozen) group.
+	const auto &drivers = sys.Drivers();
+	for (std::size_t d = 0; d < drivers.size(); ++d)
+	{
+		if (!drivers[d])
+			continue;
+
+		for (std::size_t g = 0; g < groups.size(); ++g)
+		{
+			bool updates_group = false;
+			for (const auto tag : drivers[d]->Updates())
+				updates_group = updates_group || (group_of[static_cast<std::size_t>(tag)] == static_cast<int>(g));
+
+			if (!updates_group)
+				continue;
+
+			groups[g].drivers.push_back(d);
+			for (const auto tag : drivers[d]->DependsOn())
+			{
+				if (group_of[static_cast<std::size_t>(tag)] > static_cast<int>(g))
+					groups[g].reads_faster = true;
+			}
+		}
+	}
+
+	return groups;
+}
+
+//--------------------------------------------------------------
+/// Human-readable partition, e.g. "[Spin] [Thermal]".
+std::string DescribeGroups(const std::vector<RateGroup> &groups)
+{
+	std::ostringstream oss;
+	for (std::size_t g = 0; g < groups.size(); ++g)
+	{
+		oss << (g ? " [" : "[");
+		for (std::size_t i = 0; i < groups[g].tags.size(); ++i)
+			oss << (i ? "," : "") << State::ToString(groups[g].tags[i]);
+		oss << "]";
+	}
+	return oss.str();
+}
+
+//--------------------------------------------------------------
+/**
+ * @brief Advance group p.g from @p T to @p T_end with its own GSL driver.
+ *
+ * @param h           In: initial step; out: last step size of the driver.
+ * @param trial       Inner steps of the current macro-step attempt (accepted
+ *                    and rejected); merged into the run's stats only if the
+ *                    macro step is accepted.
+ * @param steps_done  Accepted inner steps of the run so far (for max_steps).
+ * @param msg         Failure reason if false is returned.
+ *
+ * @return false on a GSL error or if max_steps was exceeded.
+ */
+bool AdvanceGroup(GroupRHSParams &p, const gsl_odeiv2_step_type *type, const Config &cfg,
+				  double T, double T_end, double &h,
+				  IntegratorStats &trial, std::uint64_t steps_done, std::string &msg)
+{
+	RateGroup &grp = (*p.groups)[p.g];
+	const std::size_t n = grp.idx.size();
+
+	grp.y_end.resize(n);
+	grp.f_end.resize(n);
+	for (std::size_t k = 0; k < n; ++k)
+		grp.y_end[k] = p.y_base[grp.idx[k]];
+
+	// Finite-difference Jacobian for the implicit stepper (Auto gives the
+	// fastest group MSBDF).
+	FDJacobianSystem fd_sub(&GroupRHS, &p, n, cfg.atol, cfg.rtol);
+	gsl_odeiv2_system &sub = *fd_sub.System();
+
+	gsl_odeiv2_driver *driver = gsl_odeiv2_driver_alloc_y_new(&sub, type, h, cfg.atol, cfg.rtol);
+	if (!driver)
+		throw std::runtime_error("MultirateIntegrator::Integrate: failed to allocate GSL driver.");
+
+	const bool exact_dydt_out = (driver->s->type->gives_exact_dydt_out != 0);
+
+	grp.track.Reset(n);
+	GroupRHS(T, grp.y_end.data(), grp.f_end.data(), &p);
+	grp.track.Append(T, grp.y_end.data(), grp.f_end.data());
+
+	double t = T;
+	bool ok = true;
+	while (t < T_end)
+	{
+		const double t_prev = t;
+		const int status = gsl_odeiv2_evolve_apply(driver->e, driver->c, driver->s,
+												   &sub, &t, T_end, &driver->h, grp.y_end.data());
+		if (status != GSL_SUCCESS)
+		{
+			std::ostringstream oss;
+			oss << "MultirateIntegrator: GSL step failed at t=" << t
+				<< " with status=" << status
+				<< " (" << gsl_strerror(status) << ")";
+			msg = oss.str();
+			ok = false;
+			break;
+		}
+
+		trial.RecordStep(t - t_prev);
+
+		if (exact_dydt_out)
+			std::copy(driver->e->dydt_out, driver->e->dydt_out + n, grp.f_end.begin());
+		else
+			GroupRHS(t, grp.y_end.data(), grp.f_end.data(), &p);
+		grp.track.Append(t, grp.y_end.data(), grp.f_end.data());
+
+		if (steps_done + trial.accepted_steps > cfg.max_steps)
+		{
+			std::ostringstream oss;
+			oss << "MultirateIntegrator: exceeded max_steps=" << cfg.max_steps
+				<< " (t=" << t << ")";
+			msg = oss.str();
+			ok = false;
+			break;
+		}
+	}
+
+	h = driver->h;
+	trial.rejected_steps += driver->e->failed_steps;
+	gsl_odeiv2_driver_free(driver);
+
+	return ok;
+}
+} // namespace
+
+//--------------------------------------------------------------
+//  MultirateIntegrator::MultirateIntegrator
+//--------------------------------------------------------------
+MultirateIntegrator::MultirateIntegrator(const EvolutionSystem &sys,
+										 const Config &cfg,
+										 std::size_t dim)
+	: m_sys(&sys),
+	  m_cfg(&cfg),
+	  m_dim(dim)
+{
+	if (m_dim == 0)
+	{
+		throw std::runtime_error("MultirateIntegrator: dimension must be > 0.");
+	}
+	if (m_sys->Layout().TotalSize() != m_dim)
+	{
+		throw std::runtime_error("MultirateIntegrator: dimension does not match the system layout.");
+	}
+	if (!(m_cfg->multirate_ratio > 1.0))
+	{
+		throw std::runtime_error("MultirateIntegrator: Config::multirate_ratio must be > 1.");
+	}
+}
+
+//--------------------------------------------------------------
+//  MultirateIntegrator::Integrate
+//--------------------------------------------------------------
+bool MultirateIntegrator::Integrate(double t0, double t1, double *y) const
+{
+	IntegratorStats stats;
+	return Integrate(t0, t1, y, stats);
+}
+
+//--------------------------------------------------------------
+//  MultirateIntegrator::Integrate (with stats)
+//--------------------------------------------------------------
+bool MultirateIntegrator::Integrate(double t0, double t1, double *y, IntegratorStats &stats) const
+{
+	PROFILE_FUNCTION();
+
+	if (!y)
+	{
+		throw std::runtime_error("MultirateIntegrator::Integrate: y pointer must not be null.");
+	}
+
+	const auto wall_start = std::chrono::steady_clock::now();
+
+	stats = IntegratorStats{};
+	stats.stepper = std::string("Multirate(") + StepperTypeName(m_cfg->stepper) + ")";
+	stats.t_final = t0;
+	m_sys->ResetStats();
+
+	std::ostringstream oss;
+	oss << "Using multirate integration with GSL stepper '"
+		<< StepperTypeName(m_cfg->stepper)
+		<< "' (rtol=" << m_cfg->rtol
+		<< ", atol=" << m_cfg->atol
+		<< ", multirate_ratio=" << m_cfg->multirate_ratio
+		<< ", max_steps=" << m_cfg->max_steps
+		<< ", dt_save=" << m_cfg->dt_save
+		<< ")";
+	Z_LOG_INFO(oss.str());
+
+	if (!m_sys->Events().empty())
+	{
+		Z_LOG_WARNING("MultirateIntegrator: event functions are not located in multirate mode; "
+					  "use GSLIntegrator for runs with events.");
+	}
+
+	if (t0 >= t1)
+	{
+		stats.ok = true;
+		return true;
+	}
+
+	// Inner steps of the current macro-step attempt; merged into stats only
+	// when the macro step is accepted (or the run fails inside it).
+	IntegratorStats trial;
+	auto merge_trial = [&]()
+	{
+		if (trial.accepted_steps > 0)
+		{
+			stats.dt_min = (stats.accepted_steps == 0) ? trial.dt_min : std::min(stats.dt_min, trial.dt_min);
+			stats.dt_max = std::max(stats.dt_max, trial.dt_max);
+			stats.dt_last = trial.dt_last;
+			stats.accepted_steps += trial.accepted_steps;
+		}
+		stats.rejected_steps += trial.rejected_steps;
+		trial = IntegratorStats{};
+	};
+
+	// Collect counters into stats (called on every exit path below).
+	auto finalize = [&](double t_end, bool ok, std::string msg)
+	{
+		stats.ok = ok;
+		stats.t_final = t_end;
+		stats.message = std::move(msg);
+		stats.rhs_calls = m_sys->NumRHSCalls();
+		stats.drivers = m_sys->DriverCosts();
+		stats.wall_time_s = std::chrono::duration<double>(
+								std::chrono::steady_clock::now() - wall_start)
+								.count();
+
+		Z_LOG_INFO("MultirateIntegrator stats: " + stats.Summary());
+		m_sys->NotifyFinish(t_end, y, ok, &stats);
+	};
+
+	// Macro-step controller state.
+	const double dt_save = (m_cfg->dt_save > 0.0) ? m_cfg->dt_save : (t1 - t0);
+	const double H_min = 1e-12 * (t1 - t0);
+	double H = 0.1 * dt_save;
+
+	// Last internal step size per block, reused when its group is re-formed.
+	std::array<double, kNumTags> h_block;
+	h_block.fill(0.0);
+
+	std::vector<double> f_full(m_dim), y_new(m_dim), f_check(m_dim);
+
+	GroupRHSParams params;
+	params.sys = m_sys;
+	params.y_full.resize(m_dim);
+	params.f_full.resize(m_dim);
+
+	std::string partition;
+
+	m_sys->NotifyStart(t0, t1, y);
+
+	double t = t0;
+	std::size_t sample_index = 0;
+
+	while (t < t1)
+	{
+		const double t_target = std::min(t + dt_save, t1);
+
+		while (t < t_target)
+		{
+			const double H_try = std::min(H, t_target - t);
+			const double T_end = (H_try >= t_target - t) ? t_target : t + H_try;
+
+			// 1) Rate groups for this macro step.
+			std::vector<RateGroup> groups = BuildGroups(*m_sys, *m_cfg, t, y, f_full);
+
+			const std::string desc = DescribeGroups(groups);
+			if (desc != partition)
+			{
+				Z_LOG_INFO("MultirateIntegrator: rate groups (slowest first) " + desc +
+						   " at t=" + std::to_string(t));
+				partition = desc;
+			}
+
+			// 2) Advance slowest first.
+			params.groups = &groups;
+			params.y_base = y;
+
+			std::string msg;
+			bool ok = true;
+			trial = IntegratorStats{};
+			for (std::size_t g = 0; g < groups.size() && ok; ++g)
+			{
+				params.g = g;
+
+				StepperType type = m_cfg->stepper;
+				if (type == StepperType::Auto)
+					type = (g + 1 == groups.size()) ? m_cfg->auto_implicit : m_cfg->auto_explicit;
+
+				double h = 0.0;
+				for (const auto tag : groups[g].tags)
+				{
+					const double hb = h_block[static_cast<std::size_t>(tag)];
+					if (hb > 0.0)
+						h = (h > 0.0) ? std::min(h, hb) : hb;
+				}
+				h = (h > 0.0) ? std::min(h, T_end - t) : 0.1 * (T_end - t);
+
+				ok = AdvanceGroup(params, SelectStepper(type), *m_cfg, t, T_end, h,
+								  trial, stats.accepted_steps, msg);
+
+				for (const auto tag : groups[g].tags)
+					h_block[static_cast<std::size_t>(tag)] = h;
+			}
+
+			if (!ok)
+			{
+				merge_trial();
+				Z_LOG_ERROR(msg);
+				m_sys->NotifySample(t, y, sample_index);
+				finalize(t, false, msg);
+				return false;
+			}
+
+			std::copy(y, y + m_dim, y_new.begin());
+			for (const auto &grp : groups)
+			{
+				for (std::size_t k = 0; k < grp.idx.size(); ++k)
+					y_new[grp.idx[k]] = grp.y_end[k];
+			}
+
+			// 3) Coupling error of groups that read frozen faster groups.
+			double err = 0.0;
+			for (const auto &grp : groups)
+			{
+				if (!grp.reads_faster)
+					continue;
+
+				m_sys->EvaluateSubset(T_end, y_new.data(), f_check.data(), grp.drivers);
+				for (std::size_t k = 0; k < grp.idx.size(); ++k)
+				{
+					const std::size_t i = grp.idx[k];
+					const double w = m_cfg->atol + m_cfg->rtol * std::abs(y_new[i]);
+					err = std::max(err, 0.5 * H_try * std::abs(f_check[i] - grp.f_end[k]) / w);
+				}
+			}
+
+			if (err > 1.0)
+			{
+				if (H_try <= H_min)
+				{
+					std::ostringstream fail;
+					fail << "MultirateIntegrator: coupling error " << err
+						 << " > 1 at the minimum macro step H=" << H_try
+						 << " (t=" << t << "); the rate groups cannot be decoupled here.";
+					Z_LOG_ERROR(fail.str());
+					m_sys->NotifySample(t, y, sample_index);
+					finalize(t, false, fail.str());
+					return false;
+				}
+
+				// Inner steps of a rejected macro step are counted separately
+				// (their RHS calls are already in rhs_calls).
+				++stats.macro_rejected;
+				stats.macro_discarded_steps += trial.accepted_steps + trial.rejected_steps;
+				H = H_try * std::max(0.2, 0.9 / std::sqrt(err));
+				continue;
+			}
+
+			// Accept.
+			merge_trial();
+			std::copy(y_new.begin(), y_new.end(), y);
+			t = T_end;
+			++stats.macro_steps;
+
+			const double grow = (err > 0.0) ? std::clamp(0.9 / std::sqrt(err), 0.2, 5.0) : 5.0;
+			H = (H_try < H) ? std::max(H, grow * H_try) : grow * H_try;
+		}
+
+		// Notify observers once per dt_save chunk (sample cadence)
+		m_sys->NotifySample(t, y, sample_index);
+		++sample_index;
+	}
+
+	finalize(t, true, "");
+
+	return true;
+}
+
+//--------------------------------------------------------------
+
+} // namespace CompactStar::Physics::Evolution
@@ -94,6 +94,9 @@ class DiagnosticsObserver final : public IObserver
 
 		/// Output path for the catalog JSON. If empty, derive from output_path.
 		Zaki::String::Directory catalog_output_path = "";
+
+		/// If true, append one "GSLIntegrator" packet with IntegratorStats at OnFinish().
+		bool record_integrator_stats = true;
 	};
 
 	/// Construct from options (copy).
@@ -131,6 +134,16 @@ class DiagnosticsObserver final : public IObserver
 				 const StateVector &Y0,
 				 const DriverContext &ctx) override;
 
+	/**
+	 * @brief Called once after integration ends.
+	 *
+	 * Writes the integrator statistics packet (if provided in @p fin and
+	 * Options::record_integrator_stats is set) and flushes the output.
+	 */
+	void OnFinish(const FinishInfo &fin,
+				  const StateVector &Yf,
+				  const DriverContext &ctx) override;
+
   private:
 	/// Decide whether we should record at current (t, step_counter_).
 	bool ShouldRecord(double t) const;
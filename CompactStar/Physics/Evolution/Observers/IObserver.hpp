@@ -29,6 +29,8 @@
  *  2) During integration, at each "save point":
  *        obs->OnSample(sample, Y, ctx)
  *     (optionally, future: obs->OnStep(step, Y, ctx) for every integrator step)
+ *     and, whenever the integrator locates an event (EvolutionEvent.hpp):
+ *        obs->OnEvent(event, Y_event, ctx)
  *  3) obs->OnFinish(result, Y_final, ctx)
  *
  * @ingroup Evolution
@@ -37,10 +39,13 @@
 #include <cstdint>
 #include <string>
 
+#include "CompactStar/Physics/Evolution/EvolutionEvent.hpp"
+
 namespace CompactStar::Physics::Evolution
 {
 class StateVector;
 class DriverContext;
+struct IntegratorStats;
 } // namespace CompactStar::Physics::Evolution
 
 namespace CompactStar::Physics::Evolution::Observers
@@ -98,6 +103,9 @@ struct FinishInfo
 
 	/// If !ok, a brief reason string (may be empty).
 	std::string message;
+
+	/// Integrator counters for the run (nullptr if the caller did not collect them).
+	const Evolution::IntegratorStats *stats = nullptr;
 };
 
 /**
@@ -144,6 +152,20 @@ class IObserver
 						  const Evolution::StateVector &Y,
 						  const Evolution::DriverContext &ctx) = 0;
 
+	/**
+	 * @brief Called when the integrator locates an event (default: no-op).
+	 *
+	 * Called before the event's action is applied, so for EventAction::Stop
+	 * this precedes the final OnSample / OnFinish.
+	 *
+	 * @param ev  Located event (name, time, direction, action).
+	 * @param Y   State interpolated at ev.t (read-only).
+	 * @param ctx Driver context (read-only).
+	 */
+	virtual void OnEvent(const Evolution::EventRecord &ev,
+						 const Evolution::StateVector &Y,
+						 const Evolution::DriverContext &ctx);
+
 	/**
 	 * @brief Called once after the integration ends (success or failure).
 	 *
@@ -10,6 +10,7 @@
  */
 
 #include "CompactStar/Physics/Evolution/Observers/DiagnosticsObserver.hpp"
+#include "CompactStar/Physics/Evolution/Integrator/IntegratorStats.hpp"
 
 #include <stdexcept>
 
@@ -382,6 +383,33 @@ void DiagnosticsObserver::OnSample(const SampleInfo &s,
 	Record(s.t, Y, ctx);
 }
 // -----------------------------------------------------------------------------
+//  OnFinish
+// -----------------------------------------------------------------------------
+void DiagnosticsObserver::OnFinish(const FinishInfo &fin,
+								   const StateVector &Yf,
+								   const DriverContext &ctx)
+{
+	(void)Yf;
+	(void)ctx;
+
+	if (!out_)
+		return;
+
+	if (opts_.record_integrator_stats && fin.stats)
+	{
+		const Diagnostics::UnitVocabulary *vocab_ptr =
+			(opts_.unit_vocab.Allowed().empty() ? nullptr : &opts_.unit_vocab);
+
+		Diagnostics::DiagnosticPacket pkt;
+		fin.stats->FillPacket(pkt);
+		pkt.ValidateBasic();
+
+		Diagnostics::DiagnosticsJson::WritePacketJsonl(out_, pkt, vocab_ptr);
+	}
+
+	out_.flush();
+}
+// -----------------------------------------------------------------------------
 bool DiagnosticsObserver::ApproximatelyEqual(double a, double b, double atol, double rtol)
 {
 	// Handle exact equality fast (also handles infinities, though those should be caught elsewhere)
@@ -25,6 +25,15 @@ void IObserver::OnStart(const RunInfo &run,
 	(void)ctx;
 }
 
+void IObserver::OnEvent(const Evolution::EventRecord &ev,
+						const Evolution::StateVector &Y,
+						const Evolution::DriverContext &ctx)
+{
+	(void)ev;
+	(void)Y;
+	(void)ctx;
+}
+
 void IObserver::OnFinish(const FinishInfo &fin,
 						 const Evolution::StateVector &Yf,
 						 const Evolution::DriverContext &ctx)
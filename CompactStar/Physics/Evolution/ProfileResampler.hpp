@@ -0,0 +1,114 @@
+// -*- lsst-c++ -*-
+/*
+ * CompactStar
+ * See License file at the top of the source tree.
+ *
+ * Copyright (c) 2025
+ * Mohammadreza Zakeri
+ *
+ * MIT License — see LICENSE at repo root.
+ */
+
+/**
+ * @file ProfileResampler.hpp
+ * @brief Error-controlled decimation of a StarProfile before building the caches.
+ *
+ * TOVSolver profiles carry ~10^4 radial rows. Every radial reduction in a
+ * driver kernel (and every GeometryCache column) then costs 10^4 terms,
+ * although the integrands are smooth and a few hundred well-placed nodes
+ * reproduce them to 10^-3.
+ *
+ * ResampleProfile() keeps a subset of the rows of the fine profile chosen
+ * greedily (Douglas–Peucker style): starting from the two end rows, the
+ * segment with the largest interpolation error is split at its worst row
+ * until
+ *
+ *   max_i |f(r_i) − f_lin(r_i)| / max|f| <= rtol
+ *
+ * for every controlled integrand f (structure columns, species fractions and
+ * user integrands), subject to min_nodes <= N <= max_nodes. All columns of
+ * the profile are copied at the kept rows, so the result is a regular
+ * StarProfile: StarContext, GeometryCache and every per-star kernel are then
+ * built on the coarse grid, and GeometryCache::QuadWeights() gives the
+ * matching trapezoid quadrature weights.
+ *
+ * Typical use:
+ *   - `Core::StarProfile coarse = Evolution::ResampleProfile(fine);`
+ *   - `Evolution::StarContext star(coarse);`
+ *   - `Evolution::GeometryCache geo(star);`
+ *
+ * @ingroup PhysicsEvolution
+ */
+
+#ifndef CompactStar_Physics_Evolution_ProfileResampler_H
+#define CompactStar_Physics_Evolution_ProfileResampler_H
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+#include "CompactStar/Core/StarProfile.hpp"
+
+namespace CompactStar::Physics::Evolution
+{
+
+/// Extra integrand evaluated on the fine profile at row @p i.
+using ResampleIntegrand = std::function<double(const Core::StarProfile &prof, std::size_t i)>;
+
+/**
+ * @struct ResampleOptions
+ * @brief Accuracy target and node budget of ResampleProfile().
+ */
+struct ResampleOptions
+{
+	/// Maximum interpolation error relative to max|f| of each controlled integrand.
+	double rtol = 1.0e-3;
+
+	/// Minimum number of kept rows (filled by splitting the widest segments).
+	std::size_t min_nodes = 100;
+
+	/// Maximum number of kept rows (the error target is relaxed if reached).
+	std::size_t max_nodes = 300;
+
+	/// Control the structure columns (m, ν, λ, p, ε, n_B) and the volume weight r² e^λ.
+	bool control_structure = true;
+
+	/// Control every species column of the profile.
+	bool control_species = true;
+
+	/// Additional integrands to control (e.g. a driver's emissivity proxy).
+	std::vector<ResampleIntegrand> integrands;
+};
+
+/**
+ * @struct ResampleReport
+ * @brief What ResampleProfile() did.
+ */
+struct ResampleReport
+{
+	std::size_t n_fine = 0;		   ///< rows of the input profile
+	std::size_t n_coarse = 0;	   ///< rows kept
+	double max_error = 0.0;		   ///< achieved max relative interpolation error
+	std::vector<std::size_t> rows; ///< kept row indices of the fine profile (ascending)
+};
+
+/**
+ * @brief Select an error-controlled subset of rows of @p fine.
+ *
+ * @param fine   Input profile (unchanged).
+ * @param opts   Accuracy target and node budget.
+ * @param report Optional report (kept rows, achieved error).
+ *
+ * @return A copy of @p fine with every radial column restricted to the kept
+ *         rows. If @p fine has no more than min_nodes rows it is returned as is.
+ *
+ * @throws std::runtime_error if @p fine has no radius column or the options
+ *         are inconsistent (max_nodes < 2 or min_nodes > max_nodes).
+ */
+Core::StarProfile ResampleProfile(const Core::StarProfile &fine,
+								  const ResampleOptions &opts = {},
+								  ResampleReport *report = nullptr);
+
+} // namespace CompactStar::Physics::Evolution
+
+#endif /* CompactStar_Physics_Evolution_ProfileResampler_H */
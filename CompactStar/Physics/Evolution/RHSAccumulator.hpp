@@ -24,10 +24,13 @@
  *
  * In a typical evolution setup:
  *  - System calls Configure(tag, size) for each active state block.
- *  - Before assembling the RHS, System calls Clear().
- *  - Each driver adds its contributions via AddTo(...).
- *  - Once all drivers have run, System uses Block(tag) to access the
- *    assembled RHS for that state and update the associated State object.
+ *  - Before assembling the RHS, System binds each block onto its slice of
+ *    the integrator's dydt[] (BindBlock) and calls Clear().
+ *  - Each driver adds its contributions via AddTo(...), which then writes
+ *    straight into dydt[].
+ *  - After the drivers have run, System releases the bindings
+ *    (ReleaseBlocks). Unbound blocks accumulate into internal storage and
+ *    are read via Block(tag), as before.
  *
  * @ingroup PhysicsEvolution
  */
@@ -35,6 +38,7 @@
 #ifndef CompactStar_Physics_Evolution_RHSAccumulator_H
 #define CompactStar_Physics_Evolution_RHSAccumulator_H
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <stdexcept>
@@ -95,6 +99,7 @@ class RHSAccumulator
 	{
 		auto &block = blocks_[Index(tag)];
 		block.data.assign(size, 0.0);
+		block.ext = nullptr;
 		block.configured = true;
 	}
 
@@ -133,14 +138,14 @@ class RHSAccumulator
 		{
 			throw std::runtime_error("RHSAccumulator::AddTo: component index out of range.");
 		}
-		block.data[component] += value;
+		block.Target()[component] += value;
 	}
 
 	/**
 	 * @brief Reset all configured blocks to zero.
 	 *
 	 * This does not change the sizes or configuration flags; it just
-	 * zeroes the stored RHS values.
+	 * zeroes the stored RHS values (or the bound dydt[] slices).
 	 */
 	void Clear()
 	{
@@ -148,14 +153,62 @@ class RHSAccumulator
 		{
 			if (block.configured)
 			{
-				for (auto &v : block.data)
-				{
-					v = 0.0;
-				}
+				std::fill_n(block.Target(), block.data.size(), 0.0);
 			}
 		}
 	}
 
+	// ---------------------------------------------------------------------
+	//  External binding (zero-copy dydt[])
+	// ---------------------------------------------------------------------
+
+	/**
+	 * @brief Route accumulation for @p tag directly into @p dst.
+	 *
+	 * @p dst must hold the configured block size and stay valid until
+	 * ReleaseBlocks(). While bound, Block(tag) is unavailable; use
+	 * BlockData(tag) instead.
+	 *
+	 * @throws std::runtime_error if the tag is not configured or @p dst is null.
+	 */
+	void BindBlock(Physics::State::StateTag tag, double *dst)
+	{
+		auto &block = blocks_[Index(tag)];
+		if (!block.configured)
+		{
+			throw std::runtime_error("RHSAccumulator::BindBlock: tag '" +
+									 std::string(Physics::State::ToString(tag)) +
+									 "' not configured.");
+		}
+		if (!dst)
+		{
+			throw std::runtime_error("RHSAccumulator::BindBlock: null destination.");
+		}
+		block.ext = dst;
+	}
+
+	/// Drop all external bindings (accumulation returns to internal storage).
+	void ReleaseBlocks() noexcept
+	{
+		for (auto &block : blocks_)
+		{
+			block.ext = nullptr;
+		}
+	}
+
+	/// Configured number of components for @p tag (0 if not configured).
+	[[nodiscard]] std::size_t BlockSize(Physics::State::StateTag tag) const
+	{
+		const auto &block = blocks_[Index(tag)];
+		return block.configured ? block.data.size() : 0;
+	}
+
+	/// True if @p tag is currently bound to external storage.
+	[[nodiscard]] bool IsBound(Physics::State::StateTag tag) const
+	{
+		return blocks_[Index(tag)].ext != nullptr;
+	}
+
 	// ---------------------------------------------------------------------
 	//  Accessors
 	// ---------------------------------------------------------------------
@@ -177,9 +230,32 @@ class RHSAccumulator
 									 std::string(Physics::State::ToString(tag)) +
 									 "' not configured.");
 		}
+		if (block.ext)
+		{
+			throw std::runtime_error("RHSAccumulator::Block(const): tag '" +
+									 std::string(Physics::State::ToString(tag)) +
+									 "' is bound to external storage; use BlockData().");
+		}
 		return block.data;
 	}
 
+	/**
+	 * @brief Pointer to the current RHS values for @p tag (bound or internal).
+	 *
+	 * @throws std::runtime_error if the tag has not been configured.
+	 */
+	[[nodiscard]] const double *BlockData(Physics::State::StateTag tag) const
+	{
+		const auto &block = blocks_[Index(tag)];
+		if (!block.configured)
+		{
+			throw std::runtime_error("RHSAccumulator::BlockData: tag '" +
+									 std::string(Physics::State::ToString(tag)) +
+									 "' not configured.");
+		}
+		return block.Target();
+	}
+
 	/**
 	 * @brief Mutable access to the RHS block for a given tag.
 	 *
@@ -197,6 +273,12 @@ class RHSAccumulator
 									 std::string(Physics::State::ToString(tag)) +
 									 "' not configured.");
 		}
+		if (block.ext)
+		{
+			throw std::runtime_error("RHSAccumulator::Block: tag '" +
+									 std::string(Physics::State::ToString(tag)) +
+									 "' is bound to external storage; use BlockData().");
+		}
 		return block.data;
 	}
 
@@ -213,7 +295,7 @@ class RHSAccumulator
 		{
 			throw std::runtime_error("RHSAccumulator::Peek: component index out of range.");
 		}
-		return block.data[i];
+		return block.Target()[i];
 	}
 
   private:
@@ -225,7 +307,11 @@ class RHSAccumulator
 	struct BlockStorage
 	{
 		std::vector<double> data;
+		double *ext = nullptr; ///< bound dydt[] slice (nullptr = use data)
 		bool configured = false;
+
+		double *Target() noexcept { return ext ? ext : data.data(); }
+		const double *Target() const noexcept { return ext ? ext : data.data(); }
 	};
 
 	/// Number of StateTag enumerators (Spin, Thermal, Chem, …, Custom).
@@ -0,0 +1,244 @@
+// -*- lsst-c++ -*-
+/*
+ * CompactStar
+ * See License file at the top of the source tree.
+ *
+ * Copyright (c) 2025
+ * Mohammadreza Zakeri
+ *
+ * MIT License — see LICENSE at repo root.
+ */
+
+/**
+ * @file SequenceGeometry.hpp
+ * @brief Stellar structure interpolated along a precomputed sequence.
+ *
+ * StarContext and GeometryCache describe one frozen profile. Spin-down and
+ * baryon-number violation move the star along its equilibrium sequence
+ * (central density, baryon number), which a single profile cannot follow.
+ *
+ * SequenceGeometry holds a few neighbouring profiles of one sequence,
+ * ordered by a sequence parameter s (baryon number b or central energy
+ * density ε_c, taken from StarProfile::seq_point). At construction every
+ * profile is mapped onto a common normalised grid x = r/R, so that a
+ * structural column at any s is the linear blend
+ *
+ *   f(x_j; s) = (1 − w) f_k(x_j) + w f_{k+1}(x_j),   w = (s − s_k)/(s_{k+1} − s_k).
+ *
+ * Radial integrals that drivers need (heat capacity coefficients, emissivity
+ * weights, ...) are registered once; each is evaluated on the exact
+ * StarContext/GeometryCache of every node profile and then interpolated in s
+ * in O(1). Registration is const and internally synchronised, so drivers
+ * may register through the const DriverContext::sequence, also lazily from
+ * concurrent RHS calls.
+ *
+ * The bracket (k, w) is cached and updated by hunting from the previous
+ * bracket, so consecutive RHS calls at nearby s cost a comparison or two.
+ *
+ * Drivers reach it through DriverContext::sequence and pass the current
+ * value of s from whichever state block carries it.
+ *
+ * @ingroup PhysicsEvolution
+ */
+
+#ifndef CompactStar_Physics_Evolution_SequenceGeometry_H
+#define CompactStar_Physics_Evolution_SequenceGeometry_H
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "CompactStar/Core/SeqPoint.hpp"
+#include "CompactStar/Core/StarProfile.hpp"
+
+namespace CompactStar::Physics::Evolution
+{
+
+class StarContext;
+class GeometryCache;
+
+//==============================================================
+//                   SequenceGeometry Class
+//==============================================================
+/**
+ * @class SequenceGeometry
+ * @brief Structural columns and integrals as functions of a sequence parameter.
+ */
+class SequenceGeometry
+{
+  public:
+	/// Which SeqPoint field orders the sequence.
+	enum class Parameter
+	{
+		BaryonNumber,		 ///< seq_point.b
+		CentralEnergyDensity ///< seq_point.ec
+	};
+
+	/// Interpolated structural columns (on the common x = r/R grid).
+	enum Field : std::size_t
+	{
+		kRadius = 0,	///< r (km)
+		kMass,			///< m (km)
+		kNu,			///< ν
+		kLambda,		///< Λ (derived from m, r if the profile has none)
+		kBaryonDensity, ///< n_B (fm^-3), zero if absent
+		kPressure,		///< p (km^-2), zero if absent
+		kEnergyDensity, ///< ε (km^-2), zero if absent
+		kNumFields
+	};
+
+	/// Radial integral of one node profile.
+	using IntegralFn = std::function<double(const StarContext &star, const GeometryCache &geo)>;
+
+	/// Returned by FindIntegral() for unknown names.
+	static constexpr std::size_t kNoIntegral = static_cast<std::size_t>(-1);
+
+	/**
+	 * @struct Options
+	 * @brief Sequence parameter and common grid size.
+	 */
+	struct Options
+	{
+		Parameter parameter = Parameter::BaryonNumber;
+
+		/// Nodes of the common x = r/R grid (>= 2).
+		std::size_t n_nodes = 200;
+
+		/// Species labels to interpolate as extra fields (after kNumFields).
+		std::vector<std::string> species;
+	};
+
+	/**
+	 * @struct Bracket
+	 * @brief Cached interpolation weights at one s.
+	 */
+	struct Bracket
+	{
+		std::size_t k = 0;	  ///< lower node
+		double w = 0.0;		  ///< weight of node k+1, in [0, 1]
+		bool clamped = false; ///< s was outside [s_min, s_max]
+	};
+
+	/**
+	 * @brief Build from profiles of one sequence (any order; sorted by s).
+	 *
+	 * @throws std::runtime_error if fewer than two profiles are given, two
+	 *         profiles share the same s, or a profile lacks r, m or ν.
+	 */
+	SequenceGeometry(std::vector<Core::StarProfile> profiles, const Options &opts);
+
+	/// Same, with default Options (avoids `Options opts = {}` on a nested struct).
+	explicit SequenceGeometry(std::vector<Core::StarProfile> profiles)
+		: SequenceGeometry(std::move(profiles), Options{}) {}
+	~SequenceGeometry();
+
+	SequenceGeometry(const SequenceGeometry &) = delete;
+	SequenceGeometry &operator=(const SequenceGeometry &) = delete;
+
+	//--------------------------------------------------------------
+	/** @name Nodes */
+	///@{
+	std::size_t NumProfiles() const { return m_nodes.size(); }
+	double ParameterAt(std::size_t k) const;
+	double ParameterMin() const { return ParameterAt(0); }
+	double ParameterMax() const { return ParameterAt(m_nodes.size() - 1); }
+	const Core::StarProfile &Profile(std::size_t k) const;
+	const StarContext &Star(std::size_t k) const;
+	const GeometryCache &Geometry(std::size_t k) const;
+	///@}
+
+	//--------------------------------------------------------------
+	/** @name Interpolation in s */
+	///@{
+	/** @brief Bracket and weight at @p s (cached; clamped to the sequence ends). */
+	Bracket Locate(double s) const;
+
+	/** @brief Linearly interpolated sequence point (M, R, I, b, ε_c, p_c). */
+	Core::SeqPoint PointAt(double s) const;
+
+	/** @brief Number of grid nodes of every interpolated column. */
+	std::size_t Size() const { return m_x.size(); }
+
+	/** @brief Common grid x = r/R. */
+	const std::vector<double> &X() const { return m_x; }
+
+	/**
+	 * @brief Field index of species @p label (one of Options::species).
+	 * @throws std::runtime_error if the species was not requested.
+	 */
+	std::size_t SpeciesField(const std::string &label) const;
+
+	/** @brief Interpolated column @p field at @p s into @p out (resized to Size()). */
+	void Column(std::size_t field, double s, std::vector<double> &out) const;
+
+	/** @brief Interpolated value of @p field at grid node @p j. */
+	double Value(std::size_t field, std::size_t j, double s) const;
+	///@}
+
+	//--------------------------------------------------------------
+	/** @name Registered integrals */
+	///@{
+	/**
+	 * @brief Evaluate @p fn on every node profile and keep the values.
+	 *
+	 * Registering an existing name returns its id without re-evaluating.
+	 * Thread-safe; @p fn runs without the registry lock held.
+	 */
+	std::size_t RegisterIntegral(const std::string &name, IntegralFn fn) const;
+
+	/** @brief Id of integral @p name, or kNoIntegral. */
+	std::size_t FindIntegral(const std::string &name) const;
+
+	/** @brief Integral @p id linearly interpolated at @p s. */
+	double Integral(std::size_t id, double s) const;
+
+	/** @brief Slope d(Integral)/ds of the bracketing segment at @p s. */
+	double IntegralSlope(std::size_t id, double s) const;
+	///@}
+
+  private:
+	/// One profile of the sequence with its exact contexts.
+	struct Node
+	{
+		Core::StarProfile profile;
+		std::unique_ptr<StarContext> star;
+		std::unique_ptr<GeometryCache> geo;
+		double s = 0.0;
+
+		/// Fields on the common x grid: fields[f][j].
+		std::vector<std::vector<double>> fields;
+	};
+
+	/// Map one profile's columns onto m_x.
+	void Resample_(Node &node) const;
+
+	/// Node value of SeqPoint field selected by m_opts.parameter.
+	double ParameterOf_(const Core::SeqPoint &sp) const;
+
+	Options m_opts;
+	std::vector<double> m_x;
+	std::vector<std::unique_ptr<Node>> m_nodes;
+
+	/// Id of @p name, or kNoIntegral (caller holds m_integralsMtx).
+	std::size_t FindIntegral_(const std::string &name) const;
+
+	// Registered integrals; appended by the const RegisterIntegral().
+	mutable std::shared_mutex m_integralsMtx;
+	mutable std::vector<std::string> m_integralNames;
+	mutable std::vector<std::vector<double>> m_integrals; // [id][k]
+
+	// Cached bracket of the last Locate() call.
+	mutable std::mutex m_mtx;
+	mutable double m_lastS = 0.0;
+	mutable Bracket m_last{};
+	mutable bool m_haveLast = false;
+};
+
+} // namespace CompactStar::Physics::Evolution
+
+#endif /* CompactStar_Physics_Evolution_SequenceGeometry_H */
@@ -39,6 +39,7 @@
 
 #include <Zaki/Vector/DataSet.hpp>
 #include <cstddef>
+#include <string>
 
 namespace CompactStar::Core
 {
@@ -71,6 +72,15 @@ class StarContext
 	 */
 	explicit StarContext(const CompactStar::Core::StarProfile &prof);
 
+	/// Underlying profile (species columns, radial DataSet); nullptr if unbound.
+	const CompactStar::Core::StarProfile *Profile() const { return m_prof; }
+
+	/**
+	 * @brief Species fraction column by label (e.g. "10" n, "11" p, "0" e).
+	 * @return nullptr if unbound or the species is not present.
+	 */
+	const Zaki::Vector::DataColumn *Species(const std::string &label) const;
+
 	/// True iff bound to a profile and required columns were found.
 	bool IsValid() const { return m_prof != nullptr && m_r != nullptr && m_m != nullptr; }
 
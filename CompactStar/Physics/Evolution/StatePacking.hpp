@@ -22,6 +22,11 @@
  * abstract State base class and implemented by each concrete State block
  * (SpinState, ThermalState, ChemState, BNVState, ...).
  *
+ * The Bind* / Release* helpers are the zero-copy counterparts used on the
+ * RHS hot path: instead of copying y[] into the State blocks and the
+ * accumulated RHS back into dydt[], they alias the State blocks onto their
+ * slices of y[] and the RHSAccumulator blocks onto their slices of dydt[].
+ *
  * @ingroup PhysicsEvolution
  */
 
@@ -90,6 +95,43 @@ void ScatterRHSFromAccumulator(const RHSAccumulator &rhs,
 							   const StateLayout &layout,
 							   double *dydt);
 
+/**
+ * @brief Alias all active State blocks onto their slices of y[].
+ *
+ * For each active tag, State::BindView(y + offset) is called. Blocks that do
+ * not support views fall back to State::UnpackFrom(), so the result is
+ * always equivalent to UnpackStateVector().
+ *
+ * The caller must call ReleaseStateViews() before @p y goes out of scope.
+ * Drivers only see the StateVector through const references, so the
+ * const_cast on @p y is never used to write into the integrator's buffer.
+ *
+ * @throws std::runtime_error on null @p y or block-size mismatch.
+ */
+void BindStateViews(StateVector &state,
+					const StateLayout &layout,
+					const double *y);
+
+/**
+ * @brief Release views set by BindStateViews() (no data is copied back).
+ */
+void ReleaseStateViews(StateVector &state,
+					   const StateLayout &layout);
+
+/**
+ * @brief Bind each active RHSAccumulator block onto its slice of dydt[].
+ *
+ * After this call, RHSAccumulator::Clear() zeroes dydt[] directly and
+ * RHSAccumulator::AddTo() writes into it, so no scatter step is needed.
+ * Release with RHSAccumulator::ReleaseBlocks().
+ *
+ * @throws std::runtime_error on null @p dydt, unconfigured blocks, or
+ *         block-size mismatch.
+ */
+void BindRHSToArray(RHSAccumulator &rhs,
+					const StateLayout &layout,
+					double *dydt);
+
 } // namespace CompactStar::Physics::Evolution
 
 #endif /* CompactStar_Physics_Evolution_StatePacking_H */
\ No newline at end of file
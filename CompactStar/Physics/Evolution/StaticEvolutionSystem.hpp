@@ -0,0 +1,155 @@
+// -*- lsst-c++ -*-
+/*
+ * CompactStar
+ * See License file at the top of the source tree.
+ *
+ * Copyright (c) 2025
+ * Mohammadreza Zakeri
+ *
+ * MIT License — see LICENSE at repo root.
+ */
+
+/**
+ * @file StaticEvolutionSystem.hpp
+ * @brief EvolutionSystem with a compile-time driver set.
+ *
+ * EvolutionSystem calls every driver through IDriver::AccumulateRHS, one
+ * virtual call per driver per RHS evaluation, which prevents inlining of
+ * the small spin / dipole drivers. For a fixed physics setup the driver
+ * types are known at compile time:
+ *
+ *   StaticEvolutionSystem<Spin::MagneticDipole, Thermal::NeutrinoCooling>
+ *       sys(ctx, state, rhs, layout, dipole, cooling);
+ *
+ * The drivers are kept in a std::tuple and run with a fold expression using
+ * qualified (non-virtual) calls. This removes the virtual dispatch; the
+ * bodies themselves are in the drivers' .cpp files, so they are inlined
+ * only with link-time optimization (CompactStar_ENABLE_IPO, on by default
+ * where the toolchain supports it). Without LTO each call is a direct,
+ * non-inlined call.
+ *
+ * Everything else (StateLayout, observers, events, statistics,
+ * EvaluateSubset for MultirateIntegrator) is inherited from EvolutionSystem,
+ * so a StaticEvolutionSystem can be passed to GSLIntegrator and
+ * MultirateIntegrator unchanged.
+ *
+ * @ingroup PhysicsEvolution
+ */
+
+#ifndef CompactStar_Physics_Evolution_StaticEvolutionSystem_H
+#define CompactStar_Physics_Evolution_StaticEvolutionSystem_H
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "CompactStar/Physics/Driver/IDriver.hpp"
+#include "CompactStar/Physics/Evolution/EvolutionSystem.hpp"
+
+namespace CompactStar::Physics::Evolution
+{
+
+//==============================================================
+//                 StaticEvolutionSystem Class
+//==============================================================
+/**
+ * @class StaticEvolutionSystem
+ * @brief RHS functor whose drivers are composed at compile time.
+ *
+ * @tparam DriverTypes Concrete driver types (each derived from IDriver), in
+ *                     evaluation order.
+ */
+template <class... DriverTypes>
+class StaticEvolutionSystem final : public EvolutionSystem
+{
+	static_assert(sizeof...(DriverTypes) > 0,
+				  "StaticEvolutionSystem needs at least one driver type.");
+	static_assert((std::is_base_of_v<IDriver, DriverTypes> && ...),
+				  "StaticEvolutionSystem: every driver type must derive from IDriver.");
+
+  public:
+	/**
+	 * @brief Construct from statically typed drivers.
+	 *
+	 * Same contract as EvolutionSystem; the drivers are shared with the
+	 * base class (Drivers(), events, per-driver costs, EvaluateSubset).
+	 *
+	 * @throws std::runtime_error if any driver pointer is null, or for any
+	 *         reason EvolutionSystem's constructor throws.
+	 */
+	StaticEvolutionSystem(const DriverContext &ctx,
+						  StateVector &state,
+						  RHSAccumulator &rhs,
+						  const StateLayout &layout,
+						  std::shared_ptr<DriverTypes>... drivers)
+		: EvolutionSystem(ctx, state, rhs, layout, CheckedList(drivers...)),
+		  m_static(std::move(drivers)...)
+	{
+	}
+
+	/// Number of drivers (compile-time constant).
+	static constexpr std::size_t NumDrivers() { return sizeof...(DriverTypes); }
+
+	/// Driver @p I with its concrete type.
+	template <std::size_t I>
+	[[nodiscard]] const auto &DriverAt() const { return *std::get<I>(m_static); }
+
+  protected:
+	/// Fold over the drivers with non-virtual calls.
+	void AccumulateAll(double t) const override
+	{
+		AccumulateAll_(t, std::index_sequence_for<DriverTypes...>{});
+	}
+
+  private:
+	//--------------------------------------------------------------
+	template <std::size_t... I>
+	void AccumulateAll_(double t, std::index_sequence<I...>) const
+	{
+		(Run_<I>(t), ...);
+	}
+
+	//--------------------------------------------------------------
+	template <std::size_t I>
+	void Run_(double t) const
+	{
+		using D = std::tuple_element_t<I, std::tuple<DriverTypes...>>;
+		const D &drv = *std::get<I>(m_static);
+
+		if (ProfilingDrivers())
+		{
+			const auto t_start = std::chrono::steady_clock::now();
+			drv.D::AccumulateRHS(t, State(), RHS(), Context());
+			RecordDriverCall(I, std::chrono::duration<double>(
+									std::chrono::steady_clock::now() - t_start)
+									.count());
+		}
+		else
+		{
+			drv.D::AccumulateRHS(t, State(), RHS(), Context());
+			RecordDriverCall(I, 0.0);
+		}
+	}
+
+	//--------------------------------------------------------------
+	static std::vector<DriverPtr> CheckedList(const std::shared_ptr<DriverTypes> &...drivers)
+	{
+		if (!((drivers != nullptr) && ...))
+		{
+			throw std::runtime_error(
+				"StaticEvolutionSystem: constructed with a null driver pointer.");
+		}
+		return std::vector<DriverPtr>{DriverPtr(drivers)...};
+	}
+
+	std::tuple<std::shared_ptr<DriverTypes>...> m_static; ///< same objects as Drivers()
+};
+
+} // namespace CompactStar::Physics::Evolution
+
+#endif /* CompactStar_Physics_Evolution_StaticEvolutionSystem_H */
@@ -14,7 +14,10 @@
  * @brief Implementation of EvolutionSystem (RHS functor for dY/dt).
  */
 
+#include <algorithm>
+#include <chrono>
 #include <stdexcept>
+#include <string>
 
 #include "CompactStar/Physics/Driver/IDriver.hpp"
 #include "CompactStar/Physics/Evolution/EvolutionConfig.hpp"
@@ -34,6 +37,66 @@
 namespace CompactStar::Physics::Evolution
 {
 
+namespace
+{
+//--------------------------------------------------------------
+/**
+ * @brief Scope guard aliasing the State blocks onto y[] (and, optionally,
+ *        the RHSAccumulator blocks onto dydt[]).
+ *
+ * Views are released on scope exit, including when a driver or observer
+ * throws, so no State is ever left pointing into a stale integrator buffer.
+ */
+class ScopedStateViews
+{
+  public:
+	ScopedStateViews(StateVector &state,
+					 const StateLayout &layout,
+					 const double *y,
+					 RHSAccumulator *rhs = nullptr,
+					 double *dydt = nullptr)
+		: m_state(state), m_layout(layout), m_rhs(rhs)
+	{
+		try
+		{
+			BindStateViews(m_state, m_layout, y);
+			if (m_rhs)
+				BindRHSToArray(*m_rhs, m_layout, dydt);
+		}
+		catch (...)
+		{
+			Release();
+			throw;
+		}
+	}
+
+	~ScopedStateViews() { Release(); }
+
+	ScopedStateViews(const ScopedStateViews &) = delete;
+	ScopedStateViews &operator=(const ScopedStateViews &) = delete;
+
+  private:
+	void Release() noexcept
+	{
+		if (m_rhs)
+			m_rhs->ReleaseBlocks();
+		try
+		{
+			ReleaseStateViews(m_state, m_layout);
+		}
+		catch (...)
+		{
+			// Only reachable if a tag is active but unregistered, in which
+			// case BindStateViews already threw; nothing is left bound.
+		}
+	}
+
+	StateVector &m_state;
+	const StateLayout &m_layout;
+	RHSAccumulator *m_rhs;
+};
+} // namespace
+
 //--------------------------------------------------------------
 // EvolutionSystem::EvolutionSystem
 //--------------------------------------------------------------
@@ -59,6 +122,17 @@ EvolutionSystem::EvolutionSystem(const DriverContext &ctx,
 			"EvolutionSystem: constructed with no physics drivers. "
 			"At least one IDriver must be provided.");
 	}
+
+	m_profile_drivers = m_ctx.cfg->profile_drivers;
+	m_drv_calls.assign(m_drivers.size(), 0);
+	m_drv_time_s.assign(m_drivers.size(), 0.0);
+
+	// Collect driver-defined events.
+	for (const auto &drv : m_drivers)
+	{
+		if (drv)
+			drv->RegisterEvents(m_events);
+	}
 }
 
 //--------------------------------------------------------------
@@ -94,24 +168,14 @@ void EvolutionSystem::ValidateContext() const
 //--------------------------------------------------------------
 int EvolutionSystem::operator()(double t, const double y[], double dydt[]) const
 {
-	// 1) Unpack flat y[] into logical State blocks.
+	// 1) Alias the State blocks onto y[] and the RHS blocks onto dydt[].
 	//
-	// This uses the free helper defined in StatePacking.hpp:
-	//   UnpackStateVector(StateVector&, const StateLayout&, const double*)
-	UnpackStateVector(m_state, m_layout, y);
-
-	{
-		const auto &th = m_state.GetThermal();
-		const auto &sp = m_state.GetSpin();
-
-		// Z_LOG_INFO("DEBUG t=" + std::to_string(t) +
-		// 		   "  y[0]=" + std::to_string(y[0]) +
-		// 		   "  y[1]=" + std::to_string(y[1]) +
-		// 		   "  unpacked: Tinf=" + std::to_string(th.Tinf()) +
-		// 		   "  Omega=" + std::to_string(sp.Omega()));
-	}
+	// No data is copied: drivers read the ODE variables in place and
+	// RHSAccumulator::AddTo(...) writes straight into dydt[]
+	// (see BindStateViews / BindRHSToArray in StatePacking.hpp).
+	ScopedStateViews views(m_state, m_layout, y, &m_rhs, dydt);
 
-	// 2) Clear RHS accumulator before driver contributions.
+	// 2) Zero dydt[] (through the bound RHS blocks) before driver contributions.
 	m_rhs.Clear();
 
 	// 3) Let each physics driver accumulate its contribution to dY/dt.
@@ -122,34 +186,104 @@ int EvolutionSystem::operator()(double t, const double y[], double dydt[]) const
 	//   - adding their contributions into m_rhs via AddTo(...).
 	// const StarContext &starCtx = *m_ctx.star;
 
-	for (const auto &drv : m_drivers)
+	++m_rhs_calls;
+
+	AccumulateAll(t);
+
+	// 4) Nothing to scatter: the RHS blocks are bound onto dydt[].
+
+	// GSL convention: return 0 for success.
+	return 0;
+}
+
+//--------------------------------------------------------------
+// EvolutionSystem::AccumulateAll
+//--------------------------------------------------------------
+void EvolutionSystem::AccumulateAll(double t) const
+{
+	for (std::size_t k = 0; k < m_drivers.size(); ++k)
+		RunDriver(k, t);
+}
+
+//--------------------------------------------------------------
+// EvolutionSystem::EvaluateSubset
+//--------------------------------------------------------------
+int EvolutionSystem::EvaluateSubset(double t, const double y[], double dydt[],
+									const std::vector<std::size_t> &driver_indices) const
+{
+	ScopedStateViews views(m_state, m_layout, y, &m_rhs, dydt);
+	m_rhs.Clear();
+
+	++m_rhs_calls;
+
+	for (const std::size_t k : driver_indices)
 	{
-		if (!drv)
+		if (k >= m_drivers.size())
 		{
 			throw std::runtime_error(
-				"EvolutionSystem::operator(): encountered null driver pointer.");
+				"EvolutionSystem::EvaluateSubset: driver index out of range.");
 		}
+		RunDriver(k, t);
+	}
 
-		drv->AccumulateRHS(t, m_state, m_rhs, m_ctx);
+	return 0;
+}
+
+//--------------------------------------------------------------
+// EvolutionSystem::RunDriver
+//--------------------------------------------------------------
+void EvolutionSystem::RunDriver(std::size_t k, double t) const
+{
+	const auto &drv = m_drivers[k];
+	if (!drv)
+	{
+		throw std::runtime_error(
+			"EvolutionSystem::operator(): encountered null driver pointer.");
 	}
 
+	if (m_profile_drivers)
+	{
+		const auto t_start = std::chrono::steady_clock::now();
+		drv->AccumulateRHS(t, m_state, m_rhs, m_ctx);
+		RecordDriverCall(k, std::chrono::duration<double>(
+								std::chrono::steady_clock::now() - t_start)
+								.count());
+	}
+	else
 	{
-		// Temporarily add a getter if you don’t have one:
-		// double RHSAccumulator::Peek(StateTag tag, size_t i) const;
+		drv->AccumulateRHS(t, m_state, m_rhs, m_ctx);
+		RecordDriverCall(k, 0.0);
+	}
+}
+
+//--------------------------------------------------------------
+// EvolutionSystem::ResetStats
+//--------------------------------------------------------------
+void EvolutionSystem::ResetStats() const
+{
+	m_rhs_calls = 0;
+	std::fill(m_drv_calls.begin(), m_drv_calls.end(), 0);
+	std::fill(m_drv_time_s.begin(), m_drv_time_s.end(), 0.0);
+}
+
+//--------------------------------------------------------------
+// EvolutionSystem::DriverCosts
+//--------------------------------------------------------------
+std::vector<DriverCost> EvolutionSystem::DriverCosts() const
+{
+	std::vector<DriverCost> out;
+	out.reserve(m_drivers.size());
 
-		// Z_LOG_INFO("DEBUG rhs: Thermal[0]=" + std::to_string(m_rhs.Peek(State::StateTag::Thermal, 0)) +
-		// 		   "  Spin[0]=" + std::to_string(m_rhs.Peek(State::StateTag::Spin, 0)));
+	for (std::size_t k = 0; k < m_drivers.size(); ++k)
+	{
+		DriverCost c;
+		c.name = m_drivers[k] ? m_drivers[k]->Name() : "<null>";
+		c.calls = m_drv_calls[k];
+		c.total_s = m_drv_time_s[k];
+		out.push_back(std::move(c));
 	}
-	// 4) Scatter accumulated RHS blocks back into the flat dydt[] array.
-	//
-	// This uses the helper from StatePacking.hpp:
-	//   ScatterRHSFromAccumulator(const RHSAccumulator&, const StateLayout&, double*)
-	ScatterRHSFromAccumulator(m_rhs, m_layout, dydt);
 
-	// Z_LOG_INFO("DEBUG dydt[0]=" + std::to_string(dydt[0]) +
-	// 		   "  dydt[1]=" + std::to_string(dydt[1]));
-	// GSL convention: return 0 for success.
-	return 0;
+	return out;
 }
 
 //--------------------------------------------------------------
@@ -164,6 +298,62 @@ void EvolutionSystem::AddObserver(ObserverPtr obs)
 	m_observers.push_back(std::move(obs));
 }
 
+//--------------------------------------------------------------
+// EvolutionSystem::AddEvent
+//--------------------------------------------------------------
+void EvolutionSystem::AddEvent(EventSpec ev)
+{
+	if (!ev.g)
+	{
+		throw std::runtime_error("EvolutionSystem::AddEvent: event '" + ev.name +
+								 "' has no event function.");
+	}
+	m_events.push_back(std::move(ev));
+}
+
+//--------------------------------------------------------------
+// EvolutionSystem::EvaluateEvents
+//--------------------------------------------------------------
+void EvolutionSystem::EvaluateEvents(double t, const double *y, double *g_out) const
+{
+	if (m_events.empty())
+		return;
+
+	ScopedStateViews views(m_state, m_layout, y);
+
+	for (std::size_t i = 0; i < m_events.size(); ++i)
+		g_out[i] = m_events[i].g(t, m_state, m_ctx);
+}
+
+//--------------------------------------------------------------
+// EvolutionSystem::EvaluateEvent
+//--------------------------------------------------------------
+double EvolutionSystem::EvaluateEvent(std::size_t i, double t, const double *y) const
+{
+	if (i >= m_events.size())
+		throw std::runtime_error("EvolutionSystem::EvaluateEvent: event index out of range.");
+
+	ScopedStateViews views(m_state, m_layout, y);
+	return m_events[i].g(t, m_state, m_ctx);
+}
+
+//--------------------------------------------------------------
+// EvolutionSystem::NotifyEvent
+//--------------------------------------------------------------
+void EvolutionSystem::NotifyEvent(const EventRecord &ev, const double *y) const
+{
+	if (m_observers.empty())
+		return;
+
+	ScopedStateViews views(m_state, m_layout, y);
+
+	for (const auto &obs : m_observers)
+	{
+		if (obs)
+			obs->OnEvent(ev, m_state, m_ctx);
+	}
+}
+
 //--------------------------------------------------------------
 // EvolutionSystem::NotifyStart
 //--------------------------------------------------------------
@@ -172,8 +362,8 @@ void EvolutionSystem::NotifyStart(double t0, double t1, const double *y0) const
 	if (m_observers.empty())
 		return;
 
-	// Unpack y0 into logical StateVector so observers see consistent Y.
-	UnpackStateVector(m_state, m_layout, y0);
+	// Alias the StateVector onto y0 so observers see consistent Y.
+	ScopedStateViews views(m_state, m_layout, y0);
 
 	Observers::RunInfo run;
 	run.t0 = t0;
@@ -194,7 +384,7 @@ void EvolutionSystem::NotifySample(double t, const double *y, std::size_t sample
 	if (m_observers.empty())
 		return;
 
-	UnpackStateVector(m_state, m_layout, y);
+	ScopedStateViews views(m_state, m_layout, y);
 
 	Observers::SampleInfo s;
 	s.t = t;
@@ -210,16 +400,22 @@ void EvolutionSystem::NotifySample(double t, const double *y, std::size_t sample
 //--------------------------------------------------------------
 // EvolutionSystem::NotifyFinish
 //--------------------------------------------------------------
-void EvolutionSystem::NotifyFinish(double t, const double *y, bool ok) const
+void EvolutionSystem::NotifyFinish(double t, const double *y, bool ok,
+								   const IntegratorStats *stats) const
 {
+	// Copy (not view) the final state so the State blocks keep valid values
+	// after the integrator's buffer is gone.
+	UnpackStateVector(m_state, m_layout, y);
+
 	if (m_observers.empty())
 		return;
 
-	UnpackStateVector(m_state, m_layout, y);
-
 	Observers::FinishInfo fin;
 	fin.t_final = t;
 	fin.ok = ok;
+	fin.stats = stats;
+	if (stats)
+		fin.message = stats->message;
 
 	for (const auto &obs : m_observers)
 	{
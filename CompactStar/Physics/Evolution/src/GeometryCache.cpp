@@ -4,12 +4,15 @@
  * @brief See GeometryCache.hpp.
  *
  * Implementation policy:
- *  - Prefer DataColumn algebra (exp/log/pow, operator*, etc.)
- *  - Only do explicit loops when we must apply a per-row safety clamp
- *    (e.g., deriving Lambda from 1-2m/r).
+ *  - Every column is a flat aligned array; builders are plain loops over
+ *    raw pointers so the compiler can vectorise them.
+ *  - Derived columns are built under the (recursive) lock the first time
+ *    they are requested; a builder may request the columns it depends on.
+ *  - Once a slot is published (Slot::ready), reads take no lock.
  */
 
 #include "CompactStar/Physics/Evolution/GeometryCache.hpp"
+#include "CompactStar/Core/StarProfile.hpp"
 #include "CompactStar/Physics/Evolution/StarContext.hpp"
 
 #include <cmath>
@@ -31,94 +34,166 @@ GeometryCache::GeometryCache(const StarContext &ctx)
 // -------------------------------------------------------
 std::size_t GeometryCache::Size() const
 {
-	return m_r.Size();
+	return m_n;
 }
 
 // -------------------------------------------------------
 // GeometryCache::R
 // -------------------------------------------------------
-const Zaki::Vector::DataColumn &GeometryCache::R() const { return m_r; }
+GeometryColumn GeometryCache::R() const { return {m_r.data(), m_r.size()}; }
 
 // -------------------------------------------------------
 // GeometryCache::Mass in km
 // -------------------------------------------------------
-const Zaki::Vector::DataColumn &GeometryCache::Mass() const { return m_mass; }
+GeometryColumn GeometryCache::Mass() const { return {m_mass.data(), m_mass.size()}; }
 
 // -------------------------------------------------------
-// GeometryCache::Area
+// GeometryCache::Nu
 // -------------------------------------------------------
-const Zaki::Vector::DataColumn &GeometryCache::Area() const { return m_area; }
+GeometryColumn GeometryCache::Nu() const { return {m_nu.data(), m_nu.size()}; }
 
 // -------------------------------------------------------
-// GeometryCache::ExpNu
+// GeometryCache::Lambda
 // -------------------------------------------------------
-const Zaki::Vector::DataColumn &GeometryCache::ExpNu() const { return m_expNu; }
+GeometryColumn GeometryCache::Lambda() const { return {m_lambda.data(), m_lambda.size()}; }
 
 // -------------------------------------------------------
-// GeometryCache::ExpMinusNu
+// GeometryCache::Register
 // -------------------------------------------------------
-const Zaki::Vector::DataColumn &GeometryCache::ExpMinusNu() const { return m_expMinusNu; }
+GeometryCache::ColumnId GeometryCache::Register(const std::string &name, Builder build) const
+{
+	if (!build)
+		throw std::runtime_error("GeometryCache::Register: empty builder for column '" + name + "'.");
 
-// -------------------------------------------------------
-// GeometryCache::Exp2Nu
-// -------------------------------------------------------
-const Zaki::Vector::DataColumn &GeometryCache::Exp2Nu() const { return m_exp2Nu; }
+	std::lock_guard<std::recursive_mutex> lock(m_mtx);
+	return Register_(name, std::move(build));
+}
 
 // -------------------------------------------------------
-// GeometryCache::ExpLambda
+// GeometryCache::Register_
 // -------------------------------------------------------
-const Zaki::Vector::DataColumn &GeometryCache::ExpLambda() const { return m_expLam; }
+GeometryCache::ColumnId GeometryCache::Register_(const std::string &name, Builder build) const
+{
+	const std::size_t n_slots = m_numSlots.load(std::memory_order_relaxed);
+	for (std::size_t id = 0; id < n_slots; ++id)
+		if (m_slots[id]->name == name)
+			return id;
+
+	if (n_slots == kMaxColumns)
+		throw std::runtime_error("GeometryCache::Register: cannot add '" + name + "', all " +
+								 std::to_string(kMaxColumns) + " column slots are in use.");
+
+	auto slot = std::make_unique<Slot>();
+	slot->name = name;
+	slot->build = std::move(build);
+	m_slots[n_slots] = std::move(slot);
+	m_numSlots.store(n_slots + 1, std::memory_order_release);
+
+	return n_slots;
+}
 
 // -------------------------------------------------------
-// GeometryCache::ExpMinusLambda
+// GeometryCache::Find
 // -------------------------------------------------------
-const Zaki::Vector::DataColumn &GeometryCache::ExpMinusLambda() const { return m_expMinusLam; }
+GeometryCache::ColumnId GeometryCache::Find(const std::string &name) const
+{
+	std::lock_guard<std::recursive_mutex> lock(m_mtx);
+
+	const std::size_t n_slots = m_numSlots.load(std::memory_order_relaxed);
+	for (std::size_t id = 0; id < n_slots; ++id)
+		if (m_slots[id]->name == name)
+			return id;
+	return kNoColumn;
+}
 
 // -------------------------------------------------------
-// GeometryCache::ExpNuMinusLambda
+// GeometryCache::Column
 // -------------------------------------------------------
-const Zaki::Vector::DataColumn &GeometryCache::ExpNuMinusLambda() const { return m_expNuMinusLam; }
+GeometryColumn GeometryCache::Column(ColumnId id) const
+{
+	if (id >= m_numSlots.load(std::memory_order_acquire))
+		throw std::runtime_error("GeometryCache::Column: unknown column id " + std::to_string(id) + ".");
+
+	const Slot &slot = *m_slots[id];
+	if (!slot.ready.load(std::memory_order_acquire))
+		Materialise_(id);
+
+	return {slot.data.data(), slot.data.size()};
+}
+
+//--------------------------------------------------------------
+GeometryColumn GeometryCache::Column(const std::string &name) const
+{
+	const ColumnId id = Find(name);
+	if (id == kNoColumn)
+		throw std::runtime_error("GeometryCache::Column: no column named '" + name + "'.");
+	return Column(id);
+}
 
 // -------------------------------------------------------
-// GeometryCache::ExpMinusNuMinusLambda
+// GeometryCache::IsBuilt
 // -------------------------------------------------------
-const Zaki::Vector::DataColumn &GeometryCache::ExpMinusNuMinusLambda() const { return m_expMinusNuMinusLam; }
+bool GeometryCache::IsBuilt(ColumnId id) const
+{
+	if (id >= m_numSlots.load(std::memory_order_acquire))
+		return false;
+	return m_slots[id]->ready.load(std::memory_order_acquire);
+}
 
 // -------------------------------------------------------
-// GeometryCache::WV
+// GeometryCache::NumColumns
 // -------------------------------------------------------
-const Zaki::Vector::DataColumn &GeometryCache::WV() const { return m_wV; }
+std::size_t GeometryCache::NumColumns() const
+{
+	return m_numSlots.load(std::memory_order_acquire);
+}
 
 // -------------------------------------------------------
-// GeometryCache::WVExpNu
+// GeometryCache::WeightedSum
 // -------------------------------------------------------
-const Zaki::Vector::DataColumn &GeometryCache::WVExpNu() const { return m_wVExpNu; }
+double GeometryCache::WeightedSum(ColumnId weight, const double *f) const
+{
+	const double *w = Column(weight).Data();
+	const std::size_t n = m_n;
+
+	double sum = 0.0;
+#pragma omp simd reduction(+ : sum)
+	for (std::size_t i = 0; i < n; ++i)
+		sum += w[i] * f[i];
+	return sum;
+}
 
 // -------------------------------------------------------
-// GeometryCache::WVExp2Nu
+// GeometryCache::Materialise_
 // -------------------------------------------------------
-const Zaki::Vector::DataColumn &GeometryCache::WVExp2Nu() const { return m_wVExp2Nu; }
+void GeometryCache::Materialise_(ColumnId id) const
+{
+	std::lock_guard<std::recursive_mutex> lock(m_mtx);
+
+	Slot &slot = *m_slots[id];
+	if (slot.ready.load(std::memory_order_relaxed))
+		return;
+
+	Buffer data(m_n, 0.0);
+	slot.build(*this, data.data());
+
+	slot.data = std::move(data);
+	slot.ready.store(true, std::memory_order_release);
+}
 
 // -------------------------------------------------------
 // GeometryCache::DeriveLambdaFromMR_
 //
-// Only place we explicitly loop: we need denom clamp.
-// Everything else is DataColumn algebra.
+// Row-by-row because of the denom clamp.
 // -------------------------------------------------------
-Zaki::Vector::DataColumn
-GeometryCache::DeriveLambdaFromMR_(const Zaki::Vector::DataColumn &r,
-								   const Zaki::Vector::DataColumn &m,
-								   double eps)
+void GeometryCache::DeriveLambdaFromMR_(const double *r, const double *m,
+										std::size_t n, double *out,
+										double eps)
 {
-	const std::size_t N = std::min(r.Size(), m.Size());
-	Zaki::Vector::DataColumn Lambda;
-	Lambda.label = "Lambda(derived)";
-	Lambda.Reserve(N);
-
-	for (std::size_t i = 0; i < N; ++i)
+	for (std::size_t i = 0; i < n; ++i)
 	{
-		const double r_km = r.vals[i];
-		const double m_km = m.vals[i];
+		const double r_km = r[i];
+		const double m_km = m[i];
 
 		double denom = 1.0;
 		if (r_km > 0.0)
@@ -129,25 +204,22 @@ GeometryCache::DeriveLambdaFromMR_(const Zaki::Vector::DataColumn &r,
 		}
 
 		// Lambda = -0.5 * ln(denom)
-		Lambda.vals.emplace_back(-0.5 * std::log(denom));
+		out[i] = -0.5 * std::log(denom);
 	}
-
-	return Lambda;
 }
 
 // -------------------------------------------------------
 // GeometryCache::Build_
 //
-// Build with DataColumn expressions:
-//   Mass      = m(km)
+// Eager: r, m, nu, Lambda (copied into aligned arrays).
+// Lazy (registered here, in Builtin order):
 //   area      = 4*pi * r^2
-//   expNu     = exp(nu)
-//   exp2Nu    = expNu * expNu
-//   expLam    = exp(Lambda)
-//   exp(-Lam) = 1 / expLam  (via operator/(double, DataColumn))
-//   wV        = area * expLam
-//   wV*eNu    = wV * expNu
-//   wV*e2Nu   = wV * exp2Nu
+//   expNu     = exp(nu),  exp(-nu) = 1 / expNu,  exp2Nu = expNu^2
+//   expLam    = exp(Lambda),  exp(-Lam) = 1 / expLam
+//   mixed     = expNu * exp(-Lam),  exp(-nu) * exp(-Lam)
+//   wV        = area * expLam,  wV*eNu,  wV*e2Nu
+//   dr        = trapezoid weights of r
+//   quadW     = wV * dr
 // -------------------------------------------------------
 void GeometryCache::Build_(const StarContext &ctx)
 {
@@ -167,74 +239,76 @@ void GeometryCache::Build_(const StarContext &ctx)
 	if (!nu_col || nu_col->Size() != N)
 		throw std::runtime_error("GeometryCache: missing/invalid nu column (size mismatch)");
 
-	// -----------------------------
-	//    Copy primitive columns
-	//	 (we cache values locally)
-	// -----------------------------
-	m_r = *r_col;
-	m_r.label = "r(km)";
+	const bool have_mass = (m_col && m_col->Size() == N);
 
-	m_mass = *m_col;
-	m_mass.label = "m(km)";
 	// -----------------------------
-
+	// Primitive columns
 	// -----------------------------
+	m_n = N;
+	m_r.assign(r_col->vals.begin(), r_col->vals.end());
+	m_nu.assign(nu_col->vals.begin(), nu_col->vals.end());
+	if (have_mass)
+		m_mass.assign(m_col->vals.begin(), m_col->vals.end());
+
 	// Lambda: use profile if present, else derive from m,r
-	// -----------------------------
-	Zaki::Vector::DataColumn Lambda;
 	if (lam_col && lam_col->Size() == N)
 	{
-		Lambda = *lam_col;
-		Lambda.label = "Lambda";
+		m_lambda.assign(lam_col->vals.begin(), lam_col->vals.end());
 	}
 	else
 	{
-		if (!m_col || m_col->Size() != N)
+		if (!have_mass)
 			throw std::runtime_error("GeometryCache: Lambda missing and cannot derive it (need m(km) column)");
-		Lambda = DeriveLambdaFromMR_(m_r, *m_col, 1e-15);
+		m_lambda.assign(N, 0.0);
+		DeriveLambdaFromMR_(m_r.data(), m_mass.data(), N, m_lambda.data(), 1e-15);
 	}
 
 	// -----------------------------
-	// Area and metric exponentials (DataColumn algebra)
-	// -----------------------------
-	m_area = (4.0 * M_PI) * m_r.pow(2);
-	m_area.label = "4*pi*r^2";
-
-	m_expNu = exp(*nu_col);
-	m_expNu.label = "exp(nu)";
-
-	m_expMinusNu = 1.0 / m_expNu;
-	m_expMinusNu.label = "exp(-nu)";
-
-	m_exp2Nu = m_expNu * m_expNu;
-	m_exp2Nu.label = "exp(2*nu)";
-
-	m_expLam = exp(Lambda);
-	m_expLam.label = "exp(Lambda)";
-
-	m_expMinusLam = 1.0 / m_expLam;
-	m_expMinusLam.label = "exp(-Lambda)";
-
-	// -----------------------------
-	// Mixed metric products (common in transport)
+	// Built-in derived columns (ids must follow the Builtin enum)
 	// -----------------------------
-	m_expNuMinusLam = m_expNu * m_expMinusLam;
-	m_expNuMinusLam.label = "exp(nu - Lambda)";
-
-	m_expMinusNuMinusLam = m_expMinusNu * m_expMinusLam;
-	m_expMinusNuMinusLam.label = "exp(-(nu + Lambda))";
-
-	// -----------------------------
-	// Canonical weights
-	// -----------------------------
-	m_wV = m_area * m_expLam;
-	m_wV.label = "wV = 4*pi*r^2*exp(Lambda)";
-
-	m_wVExpNu = m_wV * m_expNu;
-	m_wVExpNu.label = "wV*exp(nu)";
-
-	m_wVExp2Nu = m_wV * m_exp2Nu;
-	m_wVExp2Nu.label = "wV*exp(2nu)";
+	using Geo = GeometryCache;
+
+	auto unary = [](const double *a, std::size_t n, double *out, auto op) {
+		for (std::size_t i = 0; i < n; ++i)
+			out[i] = op(a[i]);
+	};
+	auto product = [](ColumnId a, ColumnId b) {
+		return [a, b](const Geo &g, double *out) {
+			const double *x = g.Column(a).Data();
+			const double *y = g.Column(b).Data();
+			const std::size_t n = g.Size();
+			for (std::size_t i = 0; i < n; ++i)
+				out[i] = x[i] * y[i];
+		};
+	};
+
+	Register_("4*pi*r^2", [unary](const Geo &g, double *out) {
+		unary(g.m_r.data(), g.m_n, out, [](double r) { return 4.0 * M_PI * r * r; });
+	});
+	Register_("exp(nu)", [unary](const Geo &g, double *out) {
+		unary(g.m_nu.data(), g.m_n, out, [](double nu) { return std::exp(nu); });
+	});
+	Register_("exp(-nu)", [unary](const Geo &g, double *out) {
+		unary(g.ExpNu().Data(), g.m_n, out, [](double e) { return 1.0 / e; });
+	});
+	Register_("exp(2*nu)", product(kExpNu, kExpNu));
+	Register_("exp(Lambda)", [unary](const Geo &g, double *out) {
+		unary(g.m_lambda.data(), g.m_n, out, [](double lam) { return std::exp(lam); });
+	});
+	Register_("exp(-Lambda)", [unary](const Geo &g, double *out) {
+		unary(g.ExpLambda().Data(), g.m_n, out, [](double e) { return 1.0 / e; });
+	});
+	Register_("exp(nu - Lambda)", product(kExpNu, kExpMinusLambda));
+	Register_("exp(-(nu + Lambda))", product(kExpMinusNu, kExpMinusLambda));
+	Register_("wV = 4*pi*r^2*exp(Lambda)", product(kArea, kExpLambda));
+	Register_("wV*exp(nu)", product(kWV, kExpNu));
+	Register_("wV*exp(2nu)", product(kWV, kExp2Nu));
+
+	// Trapezoid quadrature weights (needs neighbouring rows: end-point halves)
+	Register_("dr(km)", [](const Geo &g, double *out) {
+		Core::TrapezoidWeights(g.m_r.data(), g.m_n, out);
+	});
+	Register_("wV*dr (km^3)", product(kWV, kDr));
 }
 // -------------------------------------------------------
-} // namespace CompactStar::Physics::Evolution
\ No newline at end of file
+} // namespace CompactStar::Physics::Evolution
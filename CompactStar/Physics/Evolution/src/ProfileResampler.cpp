@@ -0,0 +1,290 @@
+// -*- lsst-c++ -*-
+/*
+ * CompactStar
+ * See License file at the top of the source tree.
+ *
+ * Copyright (c) 2025
+ * Mohammadreza Zakeri
+ *
+ * MIT License — see LICENSE at repo root.
+ */
+
+/**
+ * @file ProfileResampler.cpp
+ * @brief Greedy error-controlled row selection for StarProfile decimation.
+ */
+
+#include "CompactStar/Physics/Evolution/ProfileResampler.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <queue>
+#include <stdexcept>
+#include <string>
+
+#include <Zaki/Util/Instrumentor.hpp>
+#include <Zaki/Util/Logger.hpp>
+
+namespace CompactStar::Physics::Evolution
+{
+
+namespace
+{
+/// Candidate segment [a, b] of fine rows (a, b kept) and its worst row.
+struct Segment
+{
+	std::size_t a = 0;
+	std::size_t b = 0;
+	std::size_t split = 0;
+	double err = 0.0;
+};
+
+/// Max-heap on the interpolation error.
+struct ByError
+{
+	bool operator()(const Segment &x, const Segment &y) const { return x.err < y.err; }
+};
+
+/// Max-heap on the radial width.
+struct ByWidth
+{
+	const std::vector<double> *r = nullptr;
+	bool operator()(const Segment &x, const Segment &y) const
+	{
+		return ((*r)[x.b] - (*r)[x.a]) < ((*r)[y.b] - (*r)[y.a]);
+	}
+};
+
+/**
+ * @brief Worst relative linear-interpolation error of the controlled series on [a, b].
+ *
+ * The series are pre-normalised by max|f|, so the error is already relative.
+ */
+Segment Measure(std::size_t a, std::size_t b,
+				const std::vector<double> &r,
+				const std::vector<std::vector<double>> &series)
+{
+	Segment s{a, b, a + (b - a) / 2, 0.0};
+	if (b - a < 2)
+		return s;
+
+	const double inv_dr = (r[b] > r[a]) ? 1.0 / (r[b] - r[a]) : 0.0;
+
+	for (const auto &f : series)
+	{
+		const double fa = f[a];
+		const double slope = (f[b] - fa) * inv_dr;
+		for (std::size_t i = a + 1; i < b; ++i)
+		{
+			const double e = std::abs(f[i] - (fa + slope * (r[i] - r[a])));
+			if (e > s.err)
+			{
+				s.err = e;
+				s.split = i;
+			}
+		}
+	}
+	return s;
+}
+
+/// Append a normalised copy of @p col (skipped if missing, mis-sized or identically zero).
+void AddSeries(std::vector<std::vector<double>> &series,
+			   const Zaki::Vector::DataColumn *col,
+			   std::size_t n)
+{
+	if (!col || col->Size() != n)
+		return;
+
+	double scale = 0.0;
+	for (std::size_t i = 0; i < n; ++i)
+		scale = std::max(scale, std::abs(col->vals[i]));
+	if (!(scale > 0.0) || !std::isfinite(scale))
+		return;
+
+	std::vector<double> f(n);
+	for (std::size_t i = 0; i < n; ++i)
+		f[i] = col->vals[i] / scale;
+	series.push_back(std::move(f));
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//  ResampleProfile
+// -----------------------------------------------------------------------------
+Core::StarProfile ResampleProfile(const Core::StarProfile &fine,
+								  const ResampleOptions &opts,
+								  ResampleReport *report)
+{
+	PROFILE_FUNCTION();
+
+	const Zaki::Vector::DataColumn *r_col = fine.GetRadius();
+	if (!r_col || r_col->Size() == 0)
+		throw std::runtime_error("ResampleProfile: profile has no radius column.");
+	if (opts.max_nodes < 2 || opts.min_nodes > opts.max_nodes)
+		throw std::runtime_error("ResampleProfile: need 2 <= max_nodes and min_nodes <= max_nodes.");
+
+	const std::size_t n = r_col->Size();
+	const std::vector<double> &r = r_col->vals;
+
+	if (report)
+	{
+		*report = ResampleReport{};
+		report->n_fine = n;
+	}
+
+	if (n <= std::max<std::size_t>(opts.min_nodes, 2))
+	{
+		if (report)
+		{
+			report->n_coarse = n;
+			report->rows.resize(n);
+			for (std::size_t i = 0; i < n; ++i)
+				report->rows[i] = i;
+		}
+		return fine;
+	}
+
+	// ---------------------------------------------------------------------
+	// 1) Controlled integrands (normalised on the fine grid)
+	// ---------------------------------------------------------------------
+	std::vector<std::vector<double>> series;
+
+	if (opts.control_structure)
+	{
+		AddSeries(series, fine.GetMass(), n);
+		AddSeries(series, fine.GetMetricNu(), n);
+		AddSeries(series, fine.GetMetricLambda(), n);
+		AddSeries(series, fine.GetPressure(), n);
+		AddSeries(series, fine.GetEnergyDensity(), n);
+		AddSeries(series, fine.GetBaryonDensity(), n);
+
+		// Volume weight r² e^λ (the common factor of every shell integral).
+		const Zaki::Vector::DataColumn *lam = fine.GetMetricLambda();
+		const Zaki::Vector::DataColumn *m = fine.GetMass();
+		Zaki::Vector::DataColumn wV("r^2 e^lambda", std::vector<double>(n, 0.0));
+		for (std::size_t i = 0; i < n; ++i)
+		{
+			double e_lam = 1.0;
+			if (lam && lam->Size() == n)
+				e_lam = std::exp(lam->vals[i]);
+			else if (m && m->Size() == n && r[i] > 0.0)
+				e_lam = 1.0 / std::sqrt(std::max(1.0 - 2.0 * m->vals[i] / r[i], 1.0e-15));
+			wV.vals[i] = r[i] * r[i] * e_lam;
+		}
+		AddSeries(series, &wV, n);
+	}
+
+	if (opts.control_species)
+	{
+		for (int idx : fine.species_idx)
+			AddSeries(series, fine.GetColumnPtr(idx), n);
+	}
+
+	for (const auto &g : opts.integrands)
+	{
+		Zaki::Vector::DataColumn col("integrand", std::vector<double>(n, 0.0));
+		for (std::size_t i = 0; i < n; ++i)
+			col.vals[i] = g(fine, i);
+		AddSeries(series, &col, n);
+	}
+
+	// ---------------------------------------------------------------------
+	// 2) Greedy refinement on the worst segment
+	// ---------------------------------------------------------------------
+	std::vector<char> keep(n, 0);
+	keep[0] = keep[n - 1] = 1;
+	std::size_t n_kept = 2;
+
+	std::priority_queue<Segment, std::vector<Segment>, ByError> by_err;
+	by_err.push(Measure(0, n - 1, r, series));
+
+	while (n_kept < opts.max_nodes && !by_err.empty())
+	{
+		const Segment s = by_err.top();
+		if (!(s.err > opts.rtol))
+			break;
+		by_err.pop();
+
+		keep[s.split] = 1;
+		++n_kept;
+		by_err.push(Measure(s.a, s.split, r, series));
+		by_err.push(Measure(s.split, s.b, r, series));
+	}
+
+	// ---------------------------------------------------------------------
+	// 3) Fill up to min_nodes by halving the widest segments
+	// ---------------------------------------------------------------------
+	if (n_kept < opts.min_nodes)
+	{
+		std::priority_queue<Segment, std::vector<Segment>, ByWidth> by_width(ByWidth{&r});
+		while (!by_err.empty())
+		{
+			by_width.push(by_err.top());
+			by_err.pop();
+		}
+
+		while (n_kept < opts.min_nodes && !by_width.empty())
+		{
+			const Segment s = by_width.top();
+			by_width.pop();
+			if (s.b - s.a < 2)
+				continue;
+
+			const std::size_t mid = s.a + (s.b - s.a) / 2;
+			keep[mid] = 1;
+			++n_kept;
+			by_width.push(Measure(s.a, mid, r, series));
+			by_width.push(Measure(mid, s.b, r, series));
+		}
+
+		while (!by_width.empty())
+		{
+			by_err.push(by_width.top());
+			by_width.pop();
+		}
+	}
+
+	const double max_err = by_err.empty() ? 0.0 : by_err.top().err;
+
+	// ---------------------------------------------------------------------
+	// 4) Copy every radial column at the kept rows
+	// ---------------------------------------------------------------------
+	std::vector<std::size_t> rows;
+	rows.reserve(n_kept);
+	for (std::size_t i = 0; i < n; ++i)
+		if (keep[i])
+			rows.push_back(i);
+
+	Core::StarProfile coarse = fine;
+	for (auto &col : coarse.radial.data_set)
+	{
+		if (col.Size() != n)
+			continue;
+
+		std::vector<double> v(rows.size());
+		for (std::size_t k = 0; k < rows.size(); ++k)
+			v[k] = col.vals[rows[k]];
+		col.vals = std::move(v);
+	}
+
+	if (max_err > opts.rtol)
+	{
+		Z_LOG_WARNING("ResampleProfile: max_nodes = " + std::to_string(opts.max_nodes) +
+					  " reached with relative error " + std::to_string(max_err) +
+					  " > rtol = " + std::to_string(opts.rtol) + ".");
+	}
+
+	Z_LOG_INFO("ResampleProfile: " + std::to_string(n) + " -> " + std::to_string(rows.size()) +
+			   " rows (max relative error " + std::to_string(max_err) + ").");
+
+	if (report)
+	{
+		report->n_coarse = rows.size();
+		report->max_error = max_err;
+		report->rows = std::move(rows);
+	}
+
+	return coarse;
+}
+
+} // namespace CompactStar::Physics::Evolution
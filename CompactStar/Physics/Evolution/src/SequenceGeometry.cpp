@@ -0,0 +1,332 @@
+// -*- lsst-c++ -*-
+/*
+ * CompactStar
+ * See License file at the top of the source tree.
+ *
+ * Copyright (c) 2025
+ * Mohammadreza Zakeri
+ *
+ * MIT License — see LICENSE at repo root.
+ */
+
+/**
+ * @file SequenceGeometry.cpp
+ * @brief See SequenceGeometry.hpp.
+ */
+
+#include "CompactStar/Physics/Evolution/SequenceGeometry.hpp"
+
+#include "CompactStar/Physics/Evolution/GeometryCache.hpp"
+#include "CompactStar/Physics/Evolution/StarContext.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <Zaki/Util/Instrumentor.hpp>
+#include <Zaki/Util/Logger.hpp>
+
+namespace CompactStar::Physics::Evolution
+{
+
+//--------------------------------------------------------------
+SequenceGeometry::SequenceGeometry(std::vector<Core::StarProfile> profiles,
+								   const Options &opts)
+	: m_opts(opts)
+{
+	PROFILE_FUNCTION();
+
+	if (profiles.size() < 2)
+		throw std::runtime_error("SequenceGeometry: need at least two profiles.");
+	if (m_opts.n_nodes < 2)
+		throw std::runtime_error("SequenceGeometry: n_nodes must be >= 2.");
+
+	m_x.resize(m_opts.n_nodes);
+	for (std::size_t j = 0; j < m_x.size(); ++j)
+		m_x[j] = static_cast<double>(j) / static_cast<double>(m_x.size() - 1);
+
+	// ---------------------------------------------------------------------
+	// 1) Nodes with exact contexts (profiles moved into stable storage)
+	// ---------------------------------------------------------------------
+	m_nodes.reserve(profiles.size());
+	for (auto &prof : profiles)
+	{
+		auto node = std::make_unique<Node>();
+		node->profile = std::move(prof);
+		node->s = ParameterOf_(node->profile.seq_point);
+		node->star = std::make_unique<StarContext>(node->profile);
+		node->geo = std::make_unique<GeometryCache>(*node->star);
+		m_nodes.push_back(std::move(node));
+	}
+
+	std::sort(m_nodes.begin(), m_nodes.end(),
+			  [](const std::unique_ptr<Node> &a, const std::unique_ptr<Node> &b) { return a->s < b->s; });
+
+	for (std::size_t k = 0; k + 1 < m_nodes.size(); ++k)
+	{
+		if (!(m_nodes[k + 1]->s > m_nodes[k]->s))
+			throw std::runtime_error("SequenceGeometry: profiles " + std::to_string(k) + " and " +
+									 std::to_string(k + 1) + " have the same sequence parameter " +
+									 std::to_string(m_nodes[k]->s) + ".");
+	}
+
+	// ---------------------------------------------------------------------
+	// 2) Common x = r/R grid
+	// ---------------------------------------------------------------------
+	for (auto &node : m_nodes)
+		Resample_(*node);
+
+	Z_LOG_INFO("SequenceGeometry: " + std::to_string(m_nodes.size()) + " profiles, s in [" +
+			   std::to_string(ParameterMin()) + ", " + std::to_string(ParameterMax()) + "], " +
+			   std::to_string(m_x.size()) + " grid nodes.");
+}
+
+//--------------------------------------------------------------
+SequenceGeometry::~SequenceGeometry() = default;
+
+//--------------------------------------------------------------
+double SequenceGeometry::ParameterOf_(const Core::SeqPoint &sp) const
+{
+	switch (m_opts.parameter)
+	{
+	case Parameter::CentralEnergyDensity:
+		return sp.ec;
+	case Parameter::BaryonNumber:
+	default:
+		return sp.b;
+	}
+}
+
+//--------------------------------------------------------------
+void SequenceGeometry::Resample_(Node &node) const
+{
+	const StarContext &star = *node.star;
+	const GeometryCache &geo = *node.geo;
+
+	const std::size_t n_src = geo.Size();
+	const GeometryColumn r = geo.R();
+	const double R = r[-1];
+	if (!(R > 0.0) || n_src < 2)
+		throw std::runtime_error("SequenceGeometry: profile with s = " + std::to_string(node.s) +
+								 " has no usable radius column.");
+
+	// Source columns (nullptr -> field stays zero)
+	std::vector<const double *> src(kNumFields + m_opts.species.size(), nullptr);
+	src[kMass] = geo.Mass().Size() == n_src ? geo.Mass().Data() : nullptr;
+	src[kNu] = geo.Nu().Data();
+	src[kLambda] = geo.Lambda().Data();
+
+	auto bind = [&](std::size_t f, const Zaki::Vector::DataColumn *col) {
+		if (col && col->Size() == n_src)
+			src[f] = col->vals.data();
+	};
+	bind(kBaryonDensity, star.BaryonDensity());
+	bind(kPressure, star.Pressure());
+	bind(kEnergyDensity, star.EnergyDensity());
+	for (std::size_t q = 0; q < m_opts.species.size(); ++q)
+		bind(kNumFields + q, star.Species(m_opts.species[q]));
+
+	node.fields.assign(src.size(), std::vector<double>(m_x.size(), 0.0));
+
+	// Linear interpolation in r with a monotone hunt (both grids ascending)
+	std::size_t i = 0;
+	for (std::size_t j = 0; j < m_x.size(); ++j)
+	{
+		const double rj = m_x[j] * R;
+		while (i + 2 < n_src && r[i + 1] <= rj)
+			++i;
+
+		const double dr = r[i + 1] - r[i];
+		const double t = (dr > 0.0) ? std::clamp((rj - r[i]) / dr, 0.0, 1.0) : 0.0;
+
+		node.fields[kRadius][j] = rj;
+		for (std::size_t f = 0; f < src.size(); ++f)
+		{
+			if (src[f])
+				node.fields[f][j] = (1.0 - t) * src[f][i] + t * src[f][i + 1];
+		}
+	}
+}
+
+//--------------------------------------------------------------
+double SequenceGeometry::ParameterAt(std::size_t k) const
+{
+	return m_nodes.at(k)->s;
+}
+
+//--------------------------------------------------------------
+const Core::StarProfile &SequenceGeometry::Profile(std::size_t k) const
+{
+	return m_nodes.at(k)->profile;
+}
+
+//--------------------------------------------------------------
+const StarContext &SequenceGeometry::Star(std::size_t k) const
+{
+	return *m_nodes.at(k)->star;
+}
+
+//--------------------------------------------------------------
+const GeometryCache &SequenceGeometry::Geometry(std::size_t k) const
+{
+	return *m_nodes.at(k)->geo;
+}
+
+//--------------------------------------------------------------
+SequenceGeometry::Bracket SequenceGeometry::Locate(double s) const
+{
+	std::lock_guard<std::mutex> lock(m_mtx);
+
+	if (m_haveLast && s == m_lastS)
+		return m_last;
+
+	const std::size_t n = m_nodes.size();
+	Bracket b;
+
+	if (!(s > m_nodes[0]->s))
+	{
+		b.k = 0;
+		b.w = 0.0;
+		b.clamped = (s < m_nodes[0]->s);
+	}
+	else if (!(s < m_nodes[n - 1]->s))
+	{
+		b.k = n - 2;
+		b.w = 1.0;
+		b.clamped = (s > m_nodes[n - 1]->s);
+	}
+	else
+	{
+		// Hunt from the previous bracket: s moves slowly between RHS calls.
+		std::size_t k = m_haveLast ? m_last.k : 0;
+		while (k + 2 < n && !(s < m_nodes[k + 1]->s))
+			++k;
+		while (k > 0 && s < m_nodes[k]->s)
+			--k;
+
+		b.k = k;
+		b.w = (s - m_nodes[k]->s) / (m_nodes[k + 1]->s - m_nodes[k]->s);
+	}
+
+	m_lastS = s;
+	m_last = b;
+	m_haveLast = true;
+	return b;
+}
+
+//--------------------------------------------------------------
+Core::SeqPoint SequenceGeometry::PointAt(double s) const
+{
+	const Bracket b = Locate(s);
+	const Core::SeqPoint &lo = m_nodes[b.k]->profile.seq_point;
+	const Core::SeqPoint &hi = m_nodes[b.k + 1]->profile.seq_point;
+	const double u = 1.0 - b.w;
+
+	return Core::SeqPoint(u * lo.ec + b.w * hi.ec, u * lo.m + b.w * hi.m,
+						  u * lo.r + b.w * hi.r, u * lo.pc + b.w * hi.pc,
+						  u * lo.b + b.w * hi.b, u * lo.I + b.w * hi.I);
+}
+
+//--------------------------------------------------------------
+std::size_t SequenceGeometry::SpeciesField(const std::string &label) const
+{
+	const auto it = std::find(m_opts.species.begin(), m_opts.species.end(), label);
+	if (it == m_opts.species.end())
+		throw std::runtime_error("SequenceGeometry::SpeciesField: species '" + label +
+								 "' was not requested in Options::species.");
+	return kNumFields + static_cast<std::size_t>(it - m_opts.species.begin());
+}
+
+//--------------------------------------------------------------
+void SequenceGeometry::Column(std::size_t field, double s, std::vector<double> &out) const
+{
+	if (field >= kNumFields + m_opts.species.size())
+		throw std::runtime_error("SequenceGeometry::Column: unknown field " + std::to_string(field) + ".");
+
+	const Bracket b = Locate(s);
+	const std::vector<double> &lo = m_nodes[b.k]->fields[field];
+	const std::vector<double> &hi = m_nodes[b.k + 1]->fields[field];
+	const double u = 1.0 - b.w;
+
+	out.resize(m_x.size());
+	for (std::size_t j = 0; j < out.size(); ++j)
+		out[j] = u * lo[j] + b.w * hi[j];
+}
+
+//--------------------------------------------------------------
+double SequenceGeometry::Value(std::size_t field, std::size_t j, double s) const
+{
+	if (field >= kNumFields + m_opts.species.size() || j >= m_x.size())
+		throw std::runtime_error("SequenceGeometry::Value: field or node out of range.");
+
+	const Bracket b = Locate(s);
+	return (1.0 - b.w) * m_nodes[b.k]->fields[field][j] + b.w * m_nodes[b.k + 1]->fields[field][j];
+}
+
+//--------------------------------------------------------------
+std::size_t SequenceGeometry::RegisterIntegral(const std::string &name, IntegralFn fn) const
+{
+	const std::size_t existing = FindIntegral(name);
+	if (existing != kNoIntegral)
+		return existing;
+
+	if (!fn)
+		throw std::runtime_error("SequenceGeometry::RegisterIntegral: empty function for '" + name + "'.");
+
+	// Evaluate outside the lock: fn may itself query this sequence.
+	std::vector<double> vals(m_nodes.size());
+	for (std::size_t k = 0; k < m_nodes.size(); ++k)
+		vals[k] = fn(*m_nodes[k]->star, *m_nodes[k]->geo);
+
+	std::unique_lock<std::shared_mutex> lock(m_integralsMtx);
+
+	// Another thread may have registered the same name meanwhile.
+	const std::size_t raced = FindIntegral_(name);
+	if (raced != kNoIntegral)
+		return raced;
+
+	m_integralNames.push_back(name);
+	m_integrals.push_back(std::move(vals));
+	return m_integrals.size() - 1;
+}
+
+//--------------------------------------------------------------
+std::size_t SequenceGeometry::FindIntegral(const std::string &name) const
+{
+	std::shared_lock<std::shared_mutex> lock(m_integralsMtx);
+	return FindIntegral_(name);
+}
+
+//--------------------------------------------------------------
+std::size_t SequenceGeometry::FindIntegral_(const std::string &name) const
+{
+	const auto it = std::find(m_integralNames.begin(), m_integralNames.end(), name);
+	return (it == m_integralNames.end())
+			   ? kNoIntegral
+			   : static_cast<std::size_t>(it - m_integralNames.begin());
+}
+
+//--------------------------------------------------------------
+double SequenceGeometry::Integral(std::size_t id, double s) const
+{
+	std::shared_lock<std::shared_mutex> lock(m_integralsMtx);
+	if (id >= m_integrals.size())
+		throw std::runtime_error("SequenceGeometry::Integral: unknown id " + std::to_string(id) + ".");
+
+	const Bracket b = Locate(s);
+	const std::vector<double> &v = m_integrals[id];
+	return (1.0 - b.w) * v[b.k] + b.w * v[b.k + 1];
+}
+
+//--------------------------------------------------------------
+double SequenceGeometry::IntegralSlope(std::size_t id, double s) const
+{
+	std::shared_lock<std::shared_mutex> lock(m_integralsMtx);
+	if (id >= m_integrals.size())
+		throw std::runtime_error("SequenceGeometry::IntegralSlope: unknown id " + std::to_string(id) + ".");
+
+	const Bracket b = Locate(s);
+	const std::vector<double> &v = m_integrals[id];
+	return (v[b.k + 1] - v[b.k]) / (m_nodes[b.k + 1]->s - m_nodes[b.k]->s);
+}
+
+} // namespace CompactStar::Physics::Evolution
@@ -59,6 +59,15 @@ double StarContext::ExpNuSurface() const
 	return std::exp((*m_nu)[-1]);
 }
 
+//--------------------------------------------------------------
+const Zaki::Vector::DataColumn *StarContext::Species(const std::string &label) const
+{
+	if (!m_prof)
+		return nullptr;
+
+	return m_prof->GetSpeciesPtr(label);
+}
+
 //==============================================================
 //                   Private helpers
 //==============================================================
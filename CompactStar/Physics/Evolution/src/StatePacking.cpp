@@ -142,15 +142,21 @@ void ScatterRHSFromAccumulator(const RHSAccumulator &rhs,
 									 "' is not configured.");
 		}
 
-		const auto &block = rhs.Block(tag);
-
-		if (block.size() != n)
+		if (rhs.BlockSize(tag) != n)
 		{
 			throw std::runtime_error("ScatterRHSFromAccumulator: size mismatch for tag '" +
 									 std::string(Physics::State::ToString(tag)) +
 									 "': RHS block size != layout.BlockSize().");
 		}
 
+		const double *block = rhs.BlockData(tag);
+
+		// Bound directly onto this slice (BindRHSToArray): already in place.
+		if (block == dydt + offset)
+		{
+			continue;
+		}
+
 		for (std::size_t j = 0; j < n; ++j)
 		{
 			dydt[offset + j] = block[j];
@@ -158,4 +164,104 @@ void ScatterRHSFromAccumulator(const RHSAccumulator &rhs,
 	}
 }
 
+//--------------------------------------------------------------
+// BindStateViews
+//--------------------------------------------------------------
+void BindStateViews(StateVector &state,
+					const StateLayout &layout,
+					const double *y)
+{
+	if (!y)
+	{
+		throw std::runtime_error("BindStateViews: null y pointer.");
+	}
+
+	for (std::size_t i = 0; i < NumStateTags(); ++i)
+	{
+		const auto tag = static_cast<Physics::State::StateTag>(i);
+
+		if (!layout.IsActive(tag))
+		{
+			continue;
+		}
+
+		const auto offset = layout.Offset(tag);
+		const auto n = layout.BlockSize(tag);
+
+		auto &block = state.Get(tag);
+
+		if (block.Size() != n)
+		{
+			throw std::runtime_error("BindStateViews: size mismatch for tag '" +
+									 std::string(Physics::State::ToString(tag)) +
+									 "': State::Size() != layout.BlockSize().");
+		}
+
+		// Drivers receive the StateVector by const reference, so the view is
+		// read-only in practice.
+		if (!block.BindView(const_cast<double *>(y + offset)))
+		{
+			block.UnpackFrom(y + offset);
+		}
+	}
+}
+
+//--------------------------------------------------------------
+// ReleaseStateViews
+//--------------------------------------------------------------
+void ReleaseStateViews(StateVector &state,
+					   const StateLayout &layout)
+{
+	for (std::size_t i = 0; i < NumStateTags(); ++i)
+	{
+		const auto tag = static_cast<Physics::State::StateTag>(i);
+
+		if (!layout.IsActive(tag))
+		{
+			continue;
+		}
+
+		state.Get(tag).ReleaseView();
+	}
+}
+
+//--------------------------------------------------------------
+// BindRHSToArray
+//--------------------------------------------------------------
+void BindRHSToArray(RHSAccumulator &rhs,
+					const StateLayout &layout,
+					double *dydt)
+{
+	if (!dydt)
+	{
+		throw std::runtime_error("BindRHSToArray: null dydt pointer.");
+	}
+
+	for (std::size_t i = 0; i < NumStateTags(); ++i)
+	{
+		const auto tag = static_cast<Physics::State::StateTag>(i);
+
+		if (!layout.IsActive(tag))
+		{
+			continue;
+		}
+
+		if (!rhs.IsConfigured(tag))
+		{
+			throw std::runtime_error("BindRHSToArray: RHS block for tag '" +
+									 std::string(Physics::State::ToString(tag)) +
+									 "' is not configured.");
+		}
+
+		if (rhs.BlockSize(tag) != layout.BlockSize(tag))
+		{
+			throw std::runtime_error("BindRHSToArray: size mismatch for tag '" +
+									 std::string(Physics::State::ToString(tag)) +
+									 "': RHS block size != layout.BlockSize().");
+		}
+
+		rhs.BindBlock(tag, dydt + layout.Offset(tag));
+	}
+}
+
 } // namespace CompactStar::Physics::Evolution
\ No newline at end of file
@@ -26,6 +26,8 @@
  * Present version implements a simple ODE-compatible state with two components:
  *   1. η_I              — dimensionless imbalance parameter (model-specific)
  *   2. spin_down_limit  — Γ_BNV limit inferred from pulsar spin-down
+ * and an optional third:
+ *   3. baryon_loss      — fractional baryon number lost, ΔB/B_0 (BNVSource)
  *
  * Additional DOFs can be added without touching the evolution core.
  *
@@ -39,6 +41,7 @@
 #include <vector>
 
 #include "CompactStar/Physics/State/State.hpp"
+#include "CompactStar/Physics/State/StateStorage.hpp"
 
 namespace CompactStar::Physics::State
 {
@@ -88,6 +91,8 @@ class BNVState : public State
 	 *   N = 2
 	 *     index 0 → η_I
 	 *     index 1 → spin_down_limit
+	 *   N = 3 additionally
+	 *     index 2 → baryon_loss (ΔB/B_0)
 	 *
 	 * We may expand this vector when implementing more elaborate BNV models.
 	 */
@@ -114,6 +119,18 @@ class BNVState : public State
 
 	/// Populate internal ODE components from a flat buffer.
 	void UnpackFrom(const double *src) override;
+
+	/// Alias the DOFs onto @p external (see State::BindView).
+	bool BindView(double *external) override
+	{
+		if (values_.empty() || !external)
+			return false;
+		values_.BindView(external);
+		return true;
+	}
+
+	/// Switch back to the owned DOF storage.
+	void ReleaseView() override { values_.ReleaseView(); }
 	// -------------------------------------------------------------
 	// Convenience accessors
 	// -------------------------------------------------------------
@@ -127,16 +144,18 @@ class BNVState : public State
 	/// Access component i (const).
 	const double &Value(std::size_t i) const { return values_.at(i); }
 
-	// Named accessors for the two canonical components
+	// Named accessors for the canonical components
 	double &EtaI() { return values_.at(0); }
 	double &SpinDownLimit() { return values_.at(1); }
+	double &BaryonLoss() { return values_.at(2); }
 
 	const double &EtaI() const { return values_.at(0); }
 	const double &SpinDownLimit() const { return values_.at(1); }
+	const double &BaryonLoss() const { return values_.at(2); }
 
   private:
 	/// Contiguous DOF vector, semantics determined by BNV model.
-	std::vector<double> values_;
+	StateStorage values_;
 };
 
 } // namespace CompactStar::Physics::State
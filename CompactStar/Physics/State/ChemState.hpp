@@ -37,6 +37,7 @@
 #include <vector>
 
 #include "CompactStar/Physics/State/State.hpp"
+#include "CompactStar/Physics/State/StateStorage.hpp"
 
 namespace CompactStar::Physics::State
 {
@@ -115,6 +116,18 @@ class ChemState : public State
 
 	/// Populate internal ODE components from a flat buffer.
 	void UnpackFrom(const double *src) override;
+
+	/// Alias the DOFs onto @p external (see State::BindView).
+	bool BindView(double *external) override
+	{
+		if (eta_.empty() || !external)
+			return false;
+		eta_.BindView(external);
+		return true;
+	}
+
+	/// Switch back to the owned DOF storage.
+	void ReleaseView() override { eta_.ReleaseView(); }
 	// ------------------------------------------------------------------
 	// Convenience accessors
 	// ------------------------------------------------------------------
@@ -130,7 +143,7 @@ class ChemState : public State
 
   private:
 	/// Packed vector of chemical imbalances \f$\eta_i\f\ (energy units).
-	std::vector<double> eta_;
+	StateStorage eta_;
 };
 
 } // namespace CompactStar::Physics::State
@@ -51,6 +51,7 @@
 #include <Zaki/Math/Math_Core.hpp>
 
 #include "CompactStar/Physics/State/State.hpp"
+#include "CompactStar/Physics/State/StateStorage.hpp"
 
 namespace CompactStar::Physics::State
 {
@@ -153,6 +154,18 @@ class SpinState : public State
 	 */
 	void UnpackFrom(const double *src) override;
 
+	/// Alias the DOFs onto @p external (see State::BindView).
+	bool BindView(double *external) override
+	{
+		if (values_.empty() || !external)
+			return false;
+		values_.BindView(external);
+		return true;
+	}
+
+	/// Switch back to the owned DOF storage.
+	void ReleaseView() override { values_.ReleaseView(); }
+
 	// ------------------------------------------------------------------
 	// Convenience accessors for dynamic DOFs
 	// ------------------------------------------------------------------
@@ -195,7 +208,7 @@ class SpinState : public State
 
   private:
 	/// Contiguous block of dynamic spin DOFs (e.g. Ω, Ω̇, ...).
-	std::vector<double> values_;
+	StateStorage values_;
 };
 
 } // namespace CompactStar::Physics::State
@@ -171,6 +171,31 @@ class State
 	 * previously produced by PackTo() (for the same state layout).
 	 */
 	virtual void UnpackFrom(const double *src) = 0;
+
+	// ---------------------------------------------------------------------
+	//  Zero-copy views (optional)
+	// ---------------------------------------------------------------------
+
+	/**
+	 * @brief Make this state read/write its DOFs directly in @p external.
+	 *
+	 * Used by the evolution system to alias the state onto its slice of the
+	 * flat y[] array for the duration of an RHS evaluation or observer
+	 * callback. @p external must hold at least Size() doubles and outlive
+	 * the binding.
+	 *
+	 * @return true if the view was bound; false if this state does not
+	 *         support views (callers then fall back to UnpackFrom()).
+	 */
+	virtual bool BindView(double *external)
+	{
+		(void)external;
+		return false;
+	}
+
+	/// Release a view set by BindView(); the owned storage is not updated.
+	virtual void ReleaseView() {}
+
 	// ------------------------------------------------------------------
 	// Diagnostics
 	// ------------------------------------------------------------------
@@ -0,0 +1,185 @@
+// -*- lsst-c++ -*-
+/*
+ * CompactStar
+ * See License file at the top of the source tree.
+ *
+ * Copyright (c) 2025
+ * Mohammadreza Zakeri
+ *
+ * MIT License — see LICENSE at repo root.
+ */
+
+/**
+ * @file StateStorage.hpp
+ * @brief Contiguous DOF storage that can be temporarily bound to external memory.
+ *
+ * Concrete State blocks (Spin/Thermal/Chem/BNV) keep their evolved DOFs in a
+ * StateStorage instead of a bare std::vector<double>. By default it behaves
+ * like an owning vector. During an RHS evaluation the evolution system can
+ * bind it to the corresponding slice of the integrator's flat y[] array, so
+ * that drivers read the ODE variables in place instead of from a copy.
+ *
+ * The logical size is always that of the owned buffer (set via assign());
+ * binding only redirects data().
+ *
+ * @ingroup PhysicsState
+ */
+
+#ifndef CompactStar_Physics_State_StateStorage_H
+#define CompactStar_Physics_State_StateStorage_H
+
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace CompactStar::Physics::State
+{
+
+/**
+ * @class StateStorage
+ * @brief Owning vector of DOFs with an optional non-owning view override.
+ *
+ * Provides the small subset of the std::vector interface used by the State
+ * classes (size, empty, data, operator[], at, assign, begin/end).
+ */
+class StateStorage
+{
+  public:
+	StateStorage() = default;
+
+	/**
+	 * @brief Copy the logical values (through data()) into an owned buffer.
+	 *
+	 * A copy never shares a view: copying a bound storage snapshots the
+	 * bound y[] slice, and the copy stays valid after it is released.
+	 */
+	StateStorage(const StateStorage &other)
+		: owned_(other.begin(), other.end())
+	{
+	}
+
+	/// Same as copy construction; any view of *this is released.
+	StateStorage &operator=(const StateStorage &other)
+	{
+		if (this != &other)
+		{
+			owned_.assign(other.begin(), other.end());
+		}
+		else if (view_)
+		{
+			owned_.assign(view_, view_ + owned_.size());
+		}
+		view_ = nullptr;
+		return *this;
+	}
+
+	/// Moves the owned buffer; a bound source is copied as above.
+	StateStorage(StateStorage &&other) noexcept
+		: owned_(std::move(other.owned_)),
+		  view_(other.view_)
+	{
+		if (view_)
+		{
+			owned_.assign(view_, view_ + owned_.size());
+			view_ = nullptr;
+		}
+		other.view_ = nullptr;
+	}
+
+	/// Same as move construction; any view of *this is released.
+	StateStorage &operator=(StateStorage &&other) noexcept
+	{
+		if (this != &other)
+		{
+			owned_ = std::move(other.owned_);
+			if (other.view_)
+				owned_.assign(other.view_, other.view_ + owned_.size());
+			other.view_ = nullptr;
+		}
+		else if (view_)
+		{
+			owned_.assign(view_, view_ + owned_.size());
+		}
+		view_ = nullptr;
+		return *this;
+	}
+
+	~StateStorage() = default;
+
+	// ---------------------------------------------------------------------
+	//  Size / storage
+	// ---------------------------------------------------------------------
+
+	/// Number of DOFs (owned size; unchanged by binding).
+	[[nodiscard]] std::size_t size() const noexcept { return owned_.size(); }
+
+	/// True if no DOFs are configured.
+	[[nodiscard]] bool empty() const noexcept { return owned_.empty(); }
+
+	/**
+	 * @brief Resize the owned buffer to @p n entries, all set to @p v.
+	 *
+	 * Any active view is released first.
+	 */
+	void assign(std::size_t n, double v)
+	{
+		view_ = nullptr;
+		owned_.assign(n, v);
+	}
+
+	// ---------------------------------------------------------------------
+	//  Element access (goes through the view when bound)
+	// ---------------------------------------------------------------------
+
+	double *data() noexcept { return view_ ? view_ : owned_.data(); }
+	const double *data() const noexcept { return view_ ? view_ : owned_.data(); }
+
+	double &operator[](std::size_t i) noexcept { return data()[i]; }
+	const double &operator[](std::size_t i) const noexcept { return data()[i]; }
+
+	double &at(std::size_t i)
+	{
+		if (i >= owned_.size())
+			throw std::out_of_range("StateStorage::at: index out of range.");
+		return data()[i];
+	}
+
+	const double &at(std::size_t i) const
+	{
+		if (i >= owned_.size())
+			throw std::out_of_range("StateStorage::at: index out of range.");
+		return data()[i];
+	}
+
+	double *begin() noexcept { return data(); }
+	double *end() noexcept { return data() + owned_.size(); }
+	const double *begin() const noexcept { return data(); }
+	const double *end() const noexcept { return data() + owned_.size(); }
+
+	// ---------------------------------------------------------------------
+	//  Views
+	// ---------------------------------------------------------------------
+
+	/**
+	 * @brief Redirect element access to @p external (must hold size() doubles).
+	 *
+	 * The owned buffer is left untouched and becomes visible again after
+	 * ReleaseView().
+	 */
+	void BindView(double *external) noexcept { view_ = external; }
+
+	/// Drop the external view (owned values are not updated).
+	void ReleaseView() noexcept { view_ = nullptr; }
+
+	/// True while bound to external memory.
+	[[nodiscard]] bool IsView() const noexcept { return view_ != nullptr; }
+
+  private:
+	std::vector<double> owned_;
+	double *view_ = nullptr;
+};
+
+} // namespace CompactStar::Physics::State
+
+#endif /* CompactStar_Physics_State_StateStorage_H */
@@ -40,6 +40,7 @@
 #include <vector>
 
 #include "CompactStar/Physics/State/State.hpp"
+#include "CompactStar/Physics/State/StateStorage.hpp"
 
 namespace CompactStar::Physics::State
 {
@@ -135,6 +136,18 @@ class ThermalState : public State
 
 	/// Populate internal ODE components from a flat buffer.
 	void UnpackFrom(const double *src) override;
+
+	/// Alias the DOFs onto @p external (see State::BindView).
+	bool BindView(double *external) override
+	{
+		if (values_.empty() || !external)
+			return false;
+		values_.BindView(external);
+		return true;
+	}
+
+	/// Switch back to the owned DOF storage.
+	void ReleaseView() override { values_.ReleaseView(); }
 	// ------------------------------------------------------------------
 	// Convenience accessors for ODE DOFs
 	// ------------------------------------------------------------------
@@ -246,7 +259,7 @@ class ThermalState : public State
 
   private:
 	/// Contiguous ODE thermal components (e.g. T∞, or multi-zone T1,T2,...).
-	std::vector<double> values_;
+	StateStorage values_;
 };
 
 } // namespace CompactStar::Physics::State
@@ -31,6 +31,12 @@ void ChemState::UnpackFrom(const double *src)
 		return;
 	}
 
+	// Already aliased onto src (zero-copy view): nothing to copy.
+	if (eta_.data() == src)
+	{
+		return;
+	}
+
 	for (std::size_t i = 0; i < n; ++i)
 	{
 		eta_[i] = src[i];
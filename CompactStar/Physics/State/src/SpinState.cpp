@@ -44,6 +44,12 @@ void SpinState::UnpackFrom(const double *src)
 		return;
 	}
 
+	// Already aliased onto src (zero-copy view): nothing to copy.
+	if (values_.data() == src)
+	{
+		return;
+	}
+
 	for (std::size_t i = 0; i < n; ++i)
 	{
 		values_[i] = src[i];